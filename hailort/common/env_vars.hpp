@@ -18,6 +18,10 @@ namespace hailort
 
 #define HAILORT_CONSOLE_LOGGER_LEVEL_ENV_VAR ("HAILORT_CONSOLE_LOGGER_LEVEL")
 
+/* Max number of messages queued for the log files writer thread (default 8192) - messages above it are dropped. If set
+    to 0, the log files are written synchronously by the logging threads. */
+#define HAILORT_LOGGER_QUEUE_SIZE_ENV_VAR ("HAILORT_LOGGER_QUEUE_SIZE")
+
 #define SCHEDULER_MON_ENV_VAR ("HAILO_MONITOR")
 #define SCHEDULER_MON_ENV_VAR_VALUE ("1")
 
@@ -28,6 +32,26 @@ namespace hailort
 
 #define PROFILER_FILE_ENV_VAR ("HAILO_TRACE_PATH")
 
+/* Number of threads running vdma transfer completion callbacks (default 1). If set to 0, the callbacks run inline on
+    the interrupts thread - only for latency-critical applications whose callbacks are cheap. */
+#define HAILO_COMPLETION_THREADS_ENV_VAR ("HAILO_COMPLETION_THREADS")
+
+/* Max size (in MB) of the freed buffers memory cached for reuse by the pooled heap Buffers slab allocator
+    (default 64). If set to 0, freed buffers are returned to the system. */
+#define HAILO_BUFFER_SLAB_MAX_CACHED_MB_ENV_VAR ("HAILO_BUFFER_SLAB_MAX_CACHED_MB")
+
+/* If set to "1", large slab-allocated heap buffers are advised to be backed by huge pages (linux only) */
+#define HAILO_BUFFER_SLAB_HUGE_PAGES_ENV_VAR ("HAILO_BUFFER_SLAB_HUGE_PAGES")
+#define HAILO_BUFFER_SLAB_HUGE_PAGES_ENV_VAR_VALUE ("1")
+
+/* Max number of consecutive frames of an async vdma stream that are packed into a single DMA transfer, with a single
+    interrupt (default 1 - no coalescing). Only used by streams whose frame size is a multiple of the descriptor page
+    size. The number of frames is tuned automatically so a transfer takes at most HAILO_TRANSFER_COALESCING_LATENCY_US. */
+#define HAILO_TRANSFER_COALESCING_MAX_FRAMES_ENV_VAR ("HAILO_TRANSFER_COALESCING_MAX_FRAMES")
+
+/* Latency cap (in microseconds) of a coalesced DMA transfer (default 1000) */
+#define HAILO_TRANSFER_COALESCING_LATENCY_US_ENV_VAR ("HAILO_TRANSFER_COALESCING_LATENCY_US")
+
 } /* namespace hailort */
 
 #endif /* HAILO_ENV_VARS_HPP_ */
\ No newline at end of file
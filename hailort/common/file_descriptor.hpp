@@ -18,6 +18,23 @@
 namespace hailort
 {
 
+// Identifies the file a fd refers to (e.g. a dma-buf). Unlike the fd itself, which is recycled by the OS once it is
+// closed, it isn't reused for another file as long as the file is open.
+struct FileIdentity
+{
+    uint64_t device = 0;
+    uint64_t inode = 0;
+
+    bool operator==(const FileIdentity &other) const
+    {
+        return (device == other.device) && (inode == other.inode);
+    }
+    bool operator!=(const FileIdentity &other) const
+    {
+        return !(*this == other);
+    }
+};
+
 class FileDescriptor
 {
   public:
@@ -40,6 +57,10 @@ class FileDescriptor
 
     Expected<FileDescriptor> duplicate();
 
+    static Expected<FileIdentity> get_identity(int fd);
+    // Returns false if fd was closed, or now refers to another file
+    static bool refers_to(int fd, const FileIdentity &identity);
+
   private:
     underlying_handle_t m_fd;
 };
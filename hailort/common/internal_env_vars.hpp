@@ -89,6 +89,12 @@ namespace hailort
 #define DDR_ACTION_LIST_ENV_VAR ("HAILO_DDR_ACTION_LIST")
 #define DDR_ACTION_LIST_ENV_VAR_VALUE ("1")
 
+/* If set - boundary channels cache the descriptors programmed for each (buffer, offset) and skip re-binding a buffer
+    to descriptors that already point to it (useful when cycling over a small set of pre-mapped buffers).
+    The cache doesn't keep the buffers mapped - once a buffer is unmapped, its descriptors are re-programmed on their
+    next use. */
+#define HAILO_CACHE_DESC_PROGRAMS_ENV_VAR ("HAILO_CACHE_DESC_PROGRAMS")
+
 /* Forces using descriptor-lists instead of CCB for config-channels on h1x devices */
 #define HAILO_FORCE_CONF_CHANNEL_OVER_DESC_ENV_VAR ("HAILO_FORCE_CONF_CHANNEL_OVER_DESC")
 
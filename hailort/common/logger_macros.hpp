@@ -13,9 +13,13 @@
 
 #include "hailo/hailort.h"
 
+#include <atomic>
+#include <chrono>
+
 #define SPDLOG_NO_EXCEPTIONS
 
-/* Minimum log level availble at compile time */
+/* Minimum log level availble at compile time - messages below it are compiled out (including the formatting of their
+   arguments). Can be overridden with the HAILO_LOG_ACTIVE_LEVEL cmake option. */
 #ifndef SPDLOG_ACTIVE_LEVEL
 #ifndef NDEBUG
 #define SPDLOG_ACTIVE_LEVEL (SPDLOG_LEVEL_DEBUG)
@@ -79,6 +83,79 @@ do{\
 #define LOGGER__ERROR(...)  LOGGER_TO_SPDLOG(SPDLOG_ERROR, __VA_ARGS__)
 #define LOGGER__CRITICAL(...)  LOGGER_TO_SPDLOG(SPDLOG_CRITICAL, __VA_ARGS__)
 
+/* Per callsite limit of the LOGGER__X_RATE_LIMITED macros - at most LOGGER_RATE_LIMIT_BURST messages are printed
+   in every LOGGER_RATE_LIMIT_INTERVAL, the rest are counted and summarized in the next printed message. */
+#define LOGGER_RATE_LIMIT_BURST (10)
+#define LOGGER_RATE_LIMIT_INTERVAL (std::chrono::seconds(1))
+
+// Rate limit state of a single log callsite. Lock free, and approximate under contention (a few messages above the
+// burst may pass while the window is reset).
+class LogRateLimiter final
+{
+public:
+    constexpr LogRateLimiter() : m_window_start(0), m_window_count(0), m_suppressed_count(0) {}
+
+    // Returns true if the message should be printed. On true, suppressed_count is set to the number of messages that
+    // were dropped since the previous printed one.
+    bool should_log(uint64_t &suppressed_count)
+    {
+        constexpr auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            LOGGER_RATE_LIMIT_INTERVAL).count();
+        const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+        auto window_start = m_window_start.load(std::memory_order_relaxed);
+        if (((now - window_start) >= interval) &&
+            m_window_start.compare_exchange_strong(window_start, now, std::memory_order_relaxed)) {
+            m_window_count.store(0, std::memory_order_relaxed);
+        }
+
+        if (m_window_count.fetch_add(1, std::memory_order_relaxed) < LOGGER_RATE_LIMIT_BURST) {
+            suppressed_count = m_suppressed_count.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        m_suppressed_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+private:
+    std::atomic<std::chrono::steady_clock::rep> m_window_start;
+    std::atomic<uint32_t> m_window_count;
+    std::atomic<uint64_t> m_suppressed_count;
+};
+
+// For logs on per-frame or shutdown paths, that may be printed thousands of times during an incident.
+// The limiter is consulted only if the level is enabled, so filtered messages don't consume the burst.
+#define LOGGER_TO_SPDLOG_RATE_LIMITED(spdlog_level, level, ...)\
+do{\
+    EXPAND(ASSERT_NOT_PRINTF_FORMAT(__VA_ARGS__));\
+    if (spdlog::default_logger_raw()->should_log(spdlog_level)) {\
+        static hailort::LogRateLimiter _rate_limiter;\
+        uint64_t _suppressed_count = 0;\
+        if (_rate_limiter.should_log(_suppressed_count)) {\
+            if (0 != _suppressed_count) {\
+                level("{} similar messages were suppressed (rate limited)", _suppressed_count);\
+            }\
+            level(__VA_ARGS__);\
+        }\
+    }\
+} while(0) // NOLINT: clang complains about this code never executing
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+#define LOGGER__INFO_RATE_LIMITED(...)  LOGGER_TO_SPDLOG_RATE_LIMITED(spdlog::level::info, SPDLOG_INFO, __VA_ARGS__)
+#else
+#define LOGGER__INFO_RATE_LIMITED(...)  (void)0
+#endif
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+#define LOGGER__WARN_RATE_LIMITED(...)  LOGGER_TO_SPDLOG_RATE_LIMITED(spdlog::level::warn, SPDLOG_WARN, __VA_ARGS__)
+#else
+#define LOGGER__WARN_RATE_LIMITED(...)  (void)0
+#endif
+#define LOGGER__WARNING_RATE_LIMITED  LOGGER__WARN_RATE_LIMITED
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
+#define LOGGER__ERROR_RATE_LIMITED(...)  LOGGER_TO_SPDLOG_RATE_LIMITED(spdlog::level::err, SPDLOG_ERROR, __VA_ARGS__)
+#else
+#define LOGGER__ERROR_RATE_LIMITED(...)  (void)0
+#endif
+
 } /* namespace hailort */
 
 #endif /* _LOGGER_MACROS_HPP_ */
\ No newline at end of file
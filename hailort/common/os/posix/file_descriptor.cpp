@@ -11,6 +11,7 @@
 #include "common/logger_macros.hpp"
 #include "common/file_descriptor.hpp"
 #include <errno.h>
+#include <sys/stat.h>
 
 namespace hailort
 {
@@ -44,4 +45,25 @@ Expected<FileDescriptor> FileDescriptor::duplicate()
     return new_fd;
 }
 
+Expected<FileIdentity> FileDescriptor::get_identity(int fd)
+{
+    struct stat fd_stat = {};
+    if (0 != fstat(fd, &fd_stat)) {
+        LOGGER__ERROR("Failed to stat fd {}. errno={}", fd, errno);
+        return make_unexpected(HAILO_FILE_OPERATION_FAILURE);
+    }
+
+    FileIdentity identity;
+    identity.device = static_cast<uint64_t>(fd_stat.st_dev);
+    identity.inode = static_cast<uint64_t>(fd_stat.st_ino);
+    return identity;
+}
+
+bool FileDescriptor::refers_to(int fd, const FileIdentity &identity)
+{
+    struct stat fd_stat = {};
+    return (0 == fstat(fd, &fd_stat)) && (static_cast<uint64_t>(fd_stat.st_dev) == identity.device) &&
+        (static_cast<uint64_t>(fd_stat.st_ino) == identity.inode);
+}
+
 } /* namespace hailort */
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file shared_library.cpp
+ * @brief Wrapper around a dynamically loaded shared library for Unix
+ **/
+
+#include "common/shared_library.hpp"
+#include "common/logger_macros.hpp"
+
+#include <dlfcn.h>
+
+namespace hailort
+{
+
+Expected<SharedLibrary> SharedLibrary::open(const std::string &path)
+{
+    auto handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (nullptr == handle) {
+        LOGGER__ERROR("Failed loading shared library {}: {}", path, dlerror());
+        return make_unexpected(HAILO_OPEN_FILE_FAILURE);
+    }
+
+    return SharedLibrary(handle, path);
+}
+
+SharedLibrary::SharedLibrary(void *handle, const std::string &path) :
+    m_handle(handle),
+    m_path(path)
+{}
+
+SharedLibrary::~SharedLibrary()
+{
+    if (nullptr != m_handle) {
+        if (0 != dlclose(m_handle)) {
+            LOGGER__ERROR("Failed unloading shared library {}: {}", m_path, dlerror());
+        }
+    }
+}
+
+SharedLibrary::SharedLibrary(SharedLibrary &&other) noexcept :
+    m_handle(std::exchange(other.m_handle, nullptr)),
+    m_path(std::move(other.m_path))
+{}
+
+Expected<void*> SharedLibrary::get_symbol(const std::string &symbol_name) const
+{
+    // Clear any previous error, since a symbol may legally be NULL
+    dlerror();
+    auto symbol = dlsym(m_handle, symbol_name.c_str());
+    auto error = dlerror();
+    if (nullptr != error) {
+        LOGGER__ERROR("Failed finding symbol {} in shared library {}: {}", symbol_name, m_path, error);
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    return symbol;
+}
+
+} /* namespace hailort */
@@ -40,4 +40,17 @@ Expected<FileDescriptor> FileDescriptor::duplicate()
     return make_unexpected(HAILO_NOT_IMPLEMENTED);
 }
 
+Expected<FileIdentity> FileDescriptor::get_identity(int fd)
+{
+    (void)fd;
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
+bool FileDescriptor::refers_to(int fd, const FileIdentity &identity)
+{
+    (void)fd;
+    (void)identity;
+    return false;
+}
+
 } /* namespace hailort */
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file shared_library.cpp
+ * @brief Wrapper around a dynamically loaded shared library for Windows
+ **/
+
+#include "common/shared_library.hpp"
+#include "common/logger_macros.hpp"
+
+#include <windows.h>
+
+namespace hailort
+{
+
+Expected<SharedLibrary> SharedLibrary::open(const std::string &path)
+{
+    auto handle = LoadLibraryA(path.c_str());
+    if (nullptr == handle) {
+        LOGGER__ERROR("Failed loading shared library {}. last_error={}", path, GetLastError());
+        return make_unexpected(HAILO_OPEN_FILE_FAILURE);
+    }
+
+    return SharedLibrary(reinterpret_cast<void*>(handle), path);
+}
+
+SharedLibrary::SharedLibrary(void *handle, const std::string &path) :
+    m_handle(handle),
+    m_path(path)
+{}
+
+SharedLibrary::~SharedLibrary()
+{
+    if (nullptr != m_handle) {
+        if (0 == FreeLibrary(reinterpret_cast<HMODULE>(m_handle))) {
+            LOGGER__ERROR("Failed unloading shared library {}. last_error={}", m_path, GetLastError());
+        }
+    }
+}
+
+SharedLibrary::SharedLibrary(SharedLibrary &&other) noexcept :
+    m_handle(std::exchange(other.m_handle, nullptr)),
+    m_path(std::move(other.m_path))
+{}
+
+Expected<void*> SharedLibrary::get_symbol(const std::string &symbol_name) const
+{
+    auto symbol = GetProcAddress(reinterpret_cast<HMODULE>(m_handle), symbol_name.c_str());
+    if (nullptr == symbol) {
+        LOGGER__ERROR("Failed finding symbol {} in shared library {}. last_error={}", symbol_name, m_path, GetLastError());
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    return reinterpret_cast<void*>(symbol);
+}
+
+} /* namespace hailort */
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file shared_library.hpp
+ * @brief Wrapper around a dynamically loaded shared library (dlopen/LoadLibrary)
+ **/
+
+#ifndef _HAILO_SHARED_LIBRARY_HPP_
+#define _HAILO_SHARED_LIBRARY_HPP_
+
+#include "hailo/expected.hpp"
+#include "common/utils.hpp"
+
+#include <string>
+
+namespace hailort
+{
+
+// The library is unloaded when the object is destroyed, so it must outlive any object or function taken from it.
+class SharedLibrary final
+{
+public:
+    static Expected<SharedLibrary> open(const std::string &path);
+
+    ~SharedLibrary();
+    SharedLibrary(const SharedLibrary &other) = delete;
+    SharedLibrary &operator=(const SharedLibrary &other) = delete;
+    SharedLibrary(SharedLibrary &&other) noexcept;
+    SharedLibrary &operator=(SharedLibrary &&other) = delete;
+
+    Expected<void*> get_symbol(const std::string &symbol_name) const;
+
+    // FuncPtrType is a function pointer type
+    template<typename FuncPtrType>
+    Expected<FuncPtrType> get_function(const std::string &function_name) const
+    {
+        TRY(auto symbol, get_symbol(function_name));
+        return reinterpret_cast<FuncPtrType>(symbol);
+    }
+
+    const std::string &path() const { return m_path; }
+
+private:
+    SharedLibrary(void *handle, const std::string &path);
+
+    void *m_handle;
+    std::string m_path;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SHARED_LIBRARY_HPP_ */
@@ -10,7 +10,15 @@
 #ifndef _THREAD_POOL_HPP_
 #define _THREAD_POOL_HPP_
 
-#include "async_thread.hpp"
+#include "hailo/event.hpp"
+
+#include "common/async_thread.hpp"
+#include "common/logger_macros.hpp"
+
+#include <queue>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
 
 namespace hailort {
 
@@ -36,7 +44,7 @@ public:
 
                     hailo_status status = func();
                     if (HAILO_SUCCESS != status) {
-                        LOGGER__ERROR("thread failed with status {}");
+                        LOGGER__ERROR("thread failed with status {}", status);
                     }
                }
             }
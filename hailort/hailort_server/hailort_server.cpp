@@ -463,11 +463,52 @@ int main()
 
         std::vector<BufferPtr> inputs; // TODO: add infer vector pool
         inputs.reserve(infer_model_info->inputs_names.size());
+        // The dma-buf fds of the inputs, kept open until the inference is done
+        std::vector<std::shared_ptr<FileDescriptor>> input_dmabuf_fds;
         uint32_t buffer_size_index = 0;
 
+        auto is_dmabuf_buffer = [&request_struct] (uint32_t buffer_index) {
+            const auto &indices = request_struct.dmabuf_input_buffer_indices;
+            return std::find(indices.begin(), indices.end(), buffer_index) != indices.end();
+        };
+
         for (const auto &input_name : infer_model_info->inputs_names) {
             TRY_AS_HRPC_STATUS(auto input, bindings->input(input_name), RunAsyncSerializer);
 
+            if (is_dmabuf_buffer(buffer_size_index)) {
+                // The input (or all of its planes) was passed as dma-buf fds, so it's imported directly without a copy
+                const auto frame_size = infer_model_info->input_streams_sizes.at(input_name);
+                hailo_pix_buffer_t pix_buffer{};
+                pix_buffer.memory_type = HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF;
+                size_t read_size = 0;
+                while (read_size < frame_size) {
+                    CHECK_AS_HRPC_STATUS(buffer_size_index < request_struct.input_buffer_sizes.size(), HAILO_INTERNAL_FAILURE,
+                        RunAsyncSerializer);
+                    CHECK_AS_HRPC_STATUS(is_dmabuf_buffer(buffer_size_index), HAILO_INVALID_OPERATION, RunAsyncSerializer);
+                    CHECK_AS_HRPC_STATUS(pix_buffer.number_of_planes < MAX_NUMBER_OF_PLANES, HAILO_INVALID_OPERATION,
+                        RunAsyncSerializer);
+                    uint32_t current_size = request_struct.input_buffer_sizes[buffer_size_index++];
+                    CHECK_AS_HRPC_STATUS(read_size + current_size <= frame_size, HAILO_INTERNAL_FAILURE, RunAsyncSerializer);
+
+                    TRY_AS_HRPC_STATUS(auto fd, server_context->connection().read_dmabuf_fd(), RunAsyncSerializer);
+                    auto &plane = pix_buffer.planes[pix_buffer.number_of_planes++];
+                    plane.fd = *fd;
+                    plane.bytes_used = current_size;
+                    plane.plane_size = current_size;
+                    input_dmabuf_fds.emplace_back(fd);
+
+                    read_size += current_size;
+                }
+
+                // Keeps the inputs indices aligned with inputs_names (nothing returns to the pool for this input)
+                inputs.emplace_back(nullptr);
+                auto status = (1 == pix_buffer.number_of_planes) ?
+                    input.set_dma_buffer(hailo_dma_buffer_t{pix_buffer.planes[0].fd, pix_buffer.planes[0].bytes_used}) :
+                    input.set_pix_buffer(pix_buffer);
+                CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
+                continue;
+            }
+
             TRY_AS_HRPC_STATUS(auto buffer_ptr, buffer_pool_per_cim[configured_infer_model_handle]->acquire_buffer(input_name),
                 RunAsyncSerializer);
 
@@ -505,12 +546,16 @@ int main()
 
         auto infer_lambda =
             [bindings = bindings.release(), callback_id, server_context, inputs, outputs, &buffer_pool_per_cim, configured_infer_model_handle,
-                infer_model_info]
+                infer_model_info, input_dmabuf_fds]
             (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
                 return configured_infer_model->run_async(bindings,
-                    [callback_id, server_context, inputs, outputs, &buffer_pool_per_cim, configured_infer_model_handle, infer_model_info]
+                    [callback_id, server_context, inputs, outputs, &buffer_pool_per_cim, configured_infer_model_handle, infer_model_info,
+                        input_dmabuf_fds]
                         (const AsyncInferCompletionInfo &completion_info) {
                     for (uint32_t i = 0; i < inputs.size(); i++) {
+                        if (nullptr == inputs[i]) {
+                            continue; // dma-buf input
+                        }
                         auto status = buffer_pool_per_cim[configured_infer_model_handle]->return_to_pool(infer_model_info->inputs_names[i], inputs[i]);
                         if (status != HAILO_SUCCESS) {
                             LOGGER__CRITICAL("return_to_pool failed for input {}, status = {}. Server should restart!", infer_model_info->inputs_names[i], status);
@@ -58,7 +58,7 @@ Expected<std::shared_ptr<ServiceNetworkGroupBufferPool>> ServiceNetworkGroupBuff
 }
 
 ServiceNetworkGroupBufferPool::ServiceNetworkGroupBufferPool(EventPtr shutdown_event, uint32_t vdevice_handle) :
-    m_stream_name_to_buffer_pool(), m_mapped_buffers(), m_shutdown_event(shutdown_event), m_vdevice_handle(vdevice_handle), m_is_shutdown(false)
+    m_stream_name_to_buffer_pool(), m_mapped_buffers(), m_shm_name_to_mapping(), m_shutdown_event(shutdown_event), m_vdevice_handle(vdevice_handle), m_is_shutdown(false)
 {}
 
 hailo_status ServiceNetworkGroupBufferPool::allocate_pool(const std::string &name,
@@ -119,6 +119,37 @@ hailo_status ServiceNetworkGroupBufferPool::return_to_pool(const std::string &st
     return HAILO_SUCCESS;
 }
 
+Expected<BufferPtr> ServiceNetworkGroupBufferPool::get_shared_memory_buffer(const std::string &shm_name, size_t size,
+    hailo_dma_buffer_direction_t direction)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto mapping = m_shm_name_to_mapping.find(shm_name);
+        if (m_shm_name_to_mapping.end() != mapping) {
+            if (mapping->second.buffer->size() == size) {
+                return BufferPtr(mapping->second.buffer);
+            }
+            // The client re-created the buffer with a different size
+            m_shm_name_to_mapping.erase(mapping);
+        }
+    }
+
+    // Opening and mapping the buffer is done without holding m_mutex, since it calls the VDevice
+    TRY(auto buffer, Buffer::create_shared(size, BufferStorageParams::open_shared_memory(shm_name)));
+
+    auto map_buffer_lambda = [direction](std::shared_ptr<VDevice> vdevice, BufferPtr buffer) {
+        return DmaMappedBuffer::create(*vdevice, buffer->data(), buffer->size(), direction);
+    };
+    auto &vdevice_manager = ServiceResourceManager<VDevice>::get_instance();
+    TRY(auto mapped_buffer,
+        vdevice_manager.execute<Expected<DmaMappedBuffer>>(m_vdevice_handle, map_buffer_lambda, buffer));
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // If another request mapped the same buffer meanwhile, the first mapping is kept and ours is released
+    auto mapping = m_shm_name_to_mapping.emplace(shm_name, SharedMemoryMapping{buffer, std::move(mapped_buffer)});
+    return BufferPtr(mapping.first->second.buffer);
+}
+
 hailo_status ServiceNetworkGroupBufferPool::shutdown()
 {
     {
@@ -48,13 +48,25 @@ public:
     hailo_status return_to_pool(const std::string &stream_name, BufferPtr buffer);
     hailo_status shutdown();
 
+    // Returns the client's shared-memory buffer with the given name. The buffer is opened and mapped to the device on
+    // the first request, and later requests (the client recycles its buffers) reuse the same mapping.
+    Expected<BufferPtr> get_shared_memory_buffer(const std::string &shm_name, size_t size,
+        hailo_dma_buffer_direction_t direction);
+
 private:
     Expected<BasicBufferPoolPtr> create_stream_buffer_pool(size_t buffer_size,
         size_t buffer_count, hailo_dma_buffer_direction_t direction, EventPtr shutdown_event);
 
+    struct SharedMemoryMapping {
+        BufferPtr buffer;
+        // Declared after the buffer so it is unmapped before the shared memory is closed.
+        DmaMappedBuffer mapped_buffer;
+    };
+
     std::unordered_map<stream_name_t, BasicBufferPoolPtr> m_stream_name_to_buffer_pool;
     // This is in order to keep the DmaMappedBuffer buffers alive while using the buffers pool.
     std::vector<DmaMappedBuffer> m_mapped_buffers;
+    std::unordered_map<std::string, SharedMemoryMapping> m_shm_name_to_mapping;
     EventPtr m_shutdown_event;
     uint32_t m_vdevice_handle;
     std::mutex m_mutex;
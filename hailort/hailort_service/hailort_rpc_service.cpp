@@ -28,6 +28,7 @@
 #include "net_flow/ops_metadata/yolov5_seg_op_metadata.hpp"
 
 #include "hef/layer_info.hpp"
+#include "utils/buffer_storage.hpp"
 
 #include <thread>
 
@@ -460,6 +461,33 @@ grpc::Status HailoRtRpcService::VDevice_get_callback_id(grpc::ServerContext*,
     return grpc::Status::OK;
 }
 
+grpc::Status HailoRtRpcService::VDevice_get_callback_ids(grpc::ServerContext*,
+    const VDevice_get_callback_ids_Request* request, VDevice_get_callback_ids_Reply* reply)
+{
+    auto lambda = [](std::shared_ptr<VDeviceCallbacksQueue> cb_queue, size_t max_count, std::chrono::milliseconds linger) {
+        return cb_queue->dequeue_batch(max_count, linger);
+    };
+
+    const auto max_count = std::max(static_cast<size_t>(request->max_count()), size_t(1));
+    const auto linger = std::chrono::milliseconds(request->linger_ms());
+    auto &cb_queue_manager = ServiceResourceManager<VDeviceCallbacksQueue>::get_instance();
+    auto cb_ids_expected = cb_queue_manager.execute<Expected<std::vector<ProtoCallbackIdentifier>>>(
+        request->identifier().vdevice_handle(), lambda, max_count, linger);
+    if (cb_ids_expected.status() == HAILO_SHUTDOWN_EVENT_SIGNALED) {
+        reply->set_status(static_cast<uint32_t>(HAILO_SHUTDOWN_EVENT_SIGNALED));
+        return grpc::Status::OK;
+    }
+    CHECK_EXPECTED_AS_RPC_STATUS(cb_ids_expected, reply);
+
+    auto proto_callback_ids = reply->mutable_callback_ids();
+    proto_callback_ids->Reserve(static_cast<int>(cb_ids_expected->size()));
+    for (auto &cb_id : cb_ids_expected.value()) {
+        proto_callback_ids->Add(std::move(cb_id));
+    }
+    reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
+    return grpc::Status::OK;
+}
+
 grpc::Status HailoRtRpcService::VDevice_finish_callback_listener(grpc::ServerContext*,
     const VDevice_finish_callback_listener_Request* request, VDevice_finish_callback_listener_Reply* reply)
 {
@@ -559,8 +587,8 @@ hailo_status HailoRtRpcService::add_input_named_buffer(const ProtoTransferReques
     BufferPtr buffer;
     MemoryView mem_view;
     if (proto_stream_transfer_request.has_shared_memory_identifier()) {
-        TRY(buffer, Buffer::create_shared(proto_stream_transfer_request.shared_memory_identifier().size(),
-            BufferStorageParams::open_shared_memory(proto_stream_transfer_request.shared_memory_identifier().name())));
+        TRY(buffer, get_shm_buffer_from_cng_pool(ng_handle, proto_stream_transfer_request.shared_memory_identifier(),
+            HAILO_DMA_BUFFER_DIRECTION_H2D));
         mem_view = MemoryView(*buffer);
     } else {
         auto *data = reinterpret_cast<const uint8_t*>(proto_stream_transfer_request.data().c_str());
@@ -570,7 +598,7 @@ hailo_status HailoRtRpcService::add_input_named_buffer(const ProtoTransferReques
         } else {
             // The memory is not aligned to 8, therefore we need to copy the data into a buffer
             TRY(buffer, Buffer::create_shared(data, proto_stream_transfer_request.data().size(),
-                BufferStorageParams::create_dma()));
+                PooledHeapStorage::create_params()));
             mem_view = MemoryView(*buffer);
         }
     }
@@ -614,8 +642,7 @@ hailo_status HailoRtRpcService::add_output_named_buffer(const ProtoTransferReque
     auto shm_identifier = proto_stream_transfer_request.shared_memory_identifier();
     
     if (is_shared_mem) {
-        TRY(buffer, Buffer::create_shared(shm_identifier.size(),
-            BufferStorageParams::open_shared_memory(shm_identifier.name())));
+        TRY(buffer, get_shm_buffer_from_cng_pool(ng_handle, shm_identifier, HAILO_DMA_BUFFER_DIRECTION_D2H));
     } else {
         TRY(buffer, acquire_buffer_from_cng_pool(ng_handle, stream_name));
     }
@@ -710,6 +737,22 @@ Expected<BufferPtr> HailoRtRpcService::acquire_buffer_from_cng_pool(uint32_t ng_
     return buffer;
 }
 
+Expected<BufferPtr> HailoRtRpcService::get_shm_buffer_from_cng_pool(uint32_t ng_handle,
+    const ProtoShmBufferIdentifier &shm_identifier, hailo_dma_buffer_direction_t direction)
+{
+    auto &cng_buffer_pool_manager = ServiceResourceManager<ServiceNetworkGroupBufferPool>::get_instance();
+    auto lambda_get_shm_buffer = [direction](std::shared_ptr<ServiceNetworkGroupBufferPool> cng_buffer_pool,
+        const std::string &shm_name, size_t size) {
+        return cng_buffer_pool->get_shared_memory_buffer(shm_name, size, direction);
+    };
+    TRY(auto buffer,
+        cng_buffer_pool_manager.execute<Expected<BufferPtr>>(
+            ng_handle, lambda_get_shm_buffer, shm_identifier.name(), static_cast<size_t>(shm_identifier.size()))
+    );
+
+    return buffer;
+}
+
 grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_infer_async(grpc::ServerContext*,
     const ConfiguredNetworkGroup_infer_async_Request *raw_request, ConfiguredNetworkGroup_infer_async_Reply *reply)
 {
@@ -1221,7 +1264,7 @@ void serialize_op_matadata(hailort::net_flow::OpMetadata &op_metadata, ProtoOpMe
         (op_metadata.type() == net_flow::OperationType::YOLOV5SEG) | (op_metadata.type() == net_flow::OperationType::IOU)) {
         // NMS fields
         hailort::net_flow::NmsOpMetadata* nms_op_metadata = static_cast<hailort::net_flow::NmsOpMetadata*>(&op_metadata);
-        auto &nms_config = nms_op_metadata->nms_config();
+        const auto nms_config = nms_op_metadata->nms_config();
         auto nms_config_proto = op_metadata_proto->mutable_nms_post_process_config();
         nms_config_proto->set_nms_score_th(nms_config.nms_score_th);
         nms_config_proto->set_nms_iou_th(nms_config.nms_iou_th);
@@ -1944,6 +1987,29 @@ grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_set_nms_max_accumulated_m
     return grpc::Status::OK;
 }
 
+grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_update_nms_config(grpc::ServerContext*,
+    const ConfiguredNetworkGroup_update_nms_config_Request *request,
+    ConfiguredNetworkGroup_update_nms_config_Reply *reply)
+{
+    std::map<std::string, NmsConfigUpdate> updates;
+    for (const auto &proto_update : request->updates()) {
+        NmsConfigUpdate update;
+        update.score_threshold = proto_update.score_threshold();
+        update.iou_threshold = proto_update.iou_threshold();
+        updates[proto_update.edge_name()] = update;
+    }
+
+    auto lambda = [](std::shared_ptr<ConfiguredNetworkGroup> cng, const std::map<std::string, NmsConfigUpdate> &updates) {
+        return cng->update_nms_config(updates);
+    };
+    auto &manager = ServiceResourceManager<ConfiguredNetworkGroup>::get_instance();
+    auto status = manager.execute(request->identifier().network_group_handle(), lambda, updates);
+    CHECK_SUCCESS_AS_RPC_STATUS(status, reply);
+
+    reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
+    return grpc::Status::OK;
+}
+
 grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_get_stream_names_from_vstream_name(grpc::ServerContext*,
     const ConfiguredNetworkGroup_get_stream_names_from_vstream_name_Request *request,
     ConfiguredNetworkGroup_get_stream_names_from_vstream_name_Reply *reply)
@@ -2362,6 +2428,24 @@ grpc::Status HailoRtRpcService::OutputVStream_set_nms_max_proposals_per_class(gr
     return grpc::Status::OK;
 }
 
+grpc::Status HailoRtRpcService::OutputVStream_update_nms_config(grpc::ServerContext*,
+    const VStream_update_nms_config_Request *request, VStream_update_nms_config_Reply *reply)
+{
+    NmsConfigUpdate update;
+    update.score_threshold = request->score_threshold();
+    update.iou_threshold = request->iou_threshold();
+
+    auto lambda = [](std::shared_ptr<OutputVStream> output_vstream, const NmsConfigUpdate &update) {
+        return output_vstream->update_nms_config(update);
+    };
+    auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
+    auto status = manager.execute(request->identifier().vstream_handle(), lambda, update);
+    CHECK_SUCCESS_AS_RPC_STATUS(status, reply, "update_nms_config failed");
+
+    reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
+    return grpc::Status::OK;
+}
+
 grpc::Status HailoRtRpcService::OutputVStream_set_nms_max_accumulated_mask_size(grpc::ServerContext*,
     const VStream_set_nms_max_accumulated_mask_size_Request *request, VStream_set_nms_max_accumulated_mask_size_Reply *reply)
 {
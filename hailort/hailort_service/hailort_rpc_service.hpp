@@ -56,6 +56,8 @@ public:
         VDevice_get_default_streams_interface_Reply* reply) override;
     virtual grpc::Status VDevice_get_callback_id(grpc::ServerContext*, const VDevice_get_callback_id_Request* request,
         VDevice_get_callback_id_Reply* reply) override;
+    virtual grpc::Status VDevice_get_callback_ids(grpc::ServerContext*, const VDevice_get_callback_ids_Request* request,
+        VDevice_get_callback_ids_Reply* reply) override;
     virtual grpc::Status VDevice_finish_callback_listener(grpc::ServerContext*, const VDevice_finish_callback_listener_Request* request,
         VDevice_finish_callback_listener_Reply* reply) override;
 
@@ -125,6 +127,8 @@ public:
         const VStream_set_nms_max_proposals_per_class_Request *request, VStream_set_nms_max_proposals_per_class_Reply*) override;
     virtual grpc::Status OutputVStream_set_nms_max_accumulated_mask_size(grpc::ServerContext *ctx,
         const VStream_set_nms_max_accumulated_mask_size_Request *request, VStream_set_nms_max_accumulated_mask_size_Reply*) override;
+    virtual grpc::Status OutputVStream_update_nms_config(grpc::ServerContext *ctx,
+        const VStream_update_nms_config_Request *request, VStream_update_nms_config_Reply*) override;
 
     virtual grpc::Status ConfiguredNetworkGroup_dup_handle(grpc::ServerContext *ctx, const ConfiguredNetworkGroup_dup_handle_Request *request,
         ConfiguredNetworkGroup_dup_handle_Reply*) override;
@@ -211,6 +215,9 @@ public:
     virtual grpc::Status ConfiguredNetworkGroup_set_nms_max_accumulated_mask_size(grpc::ServerContext*,
         const ConfiguredNetworkGroup_set_nms_max_accumulated_mask_size_Request *request,
         ConfiguredNetworkGroup_set_nms_max_accumulated_mask_size_Reply *reply) override;
+    virtual grpc::Status ConfiguredNetworkGroup_update_nms_config(grpc::ServerContext*,
+        const ConfiguredNetworkGroup_update_nms_config_Request *request,
+        ConfiguredNetworkGroup_update_nms_config_Reply *reply) override;
     virtual grpc::Status ConfiguredNetworkGroup_get_stream_names_from_vstream_name(grpc::ServerContext*,
         const ConfiguredNetworkGroup_get_stream_names_from_vstream_name_Request *request,
         ConfiguredNetworkGroup_get_stream_names_from_vstream_name_Reply *reply) override;
@@ -246,6 +253,8 @@ private:
     void enqueue_cb_identifier(uint32_t vdevice_handle, ProtoCallbackIdentifier &&cb_identifier);
     hailo_status return_buffer_to_cng_pool(uint32_t ng_handle, const std::string &output_name, BufferPtr buffer);
     Expected<BufferPtr> acquire_buffer_from_cng_pool(uint32_t ng_handle, const std::string &output_name);
+    Expected<BufferPtr> get_shm_buffer_from_cng_pool(uint32_t ng_handle, const ProtoShmBufferIdentifier &shm_identifier,
+        hailo_dma_buffer_direction_t direction);
     Expected<size_t> output_vstream_frame_size(uint32_t vstream_handle);
     hailo_status update_buffer_size_in_pool(uint32_t vstream_handle, uint32_t network_group_handle);
     void shutdown_configured_network_groups_by_pids(std::set<uint32_t> &pids);
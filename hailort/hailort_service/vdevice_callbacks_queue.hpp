@@ -68,6 +68,28 @@ public:
         return callback_id;
     }
 
+    // Blocks until a callback id is ready, then collects more ready callback ids (up to max_count), waiting at most
+    // linger for each of them. Returns HAILO_SHUTDOWN_EVENT_SIGNALED only if no callback id was collected.
+    Expected<std::vector<ProtoCallbackIdentifier>> dequeue_batch(size_t max_count, std::chrono::milliseconds linger)
+    {
+        TRY_WITH_ACCEPTABLE_STATUS(HAILO_SHUTDOWN_EVENT_SIGNALED, auto first_callback_id,
+            m_callbacks_ids_queue.dequeue());
+
+        std::vector<ProtoCallbackIdentifier> callback_ids;
+        callback_ids.reserve(max_count);
+        callback_ids.emplace_back(first_callback_id.release());
+        while (callback_ids.size() < max_count) {
+            auto callback_id = m_callbacks_ids_queue.dequeue(linger);
+            if (!callback_id) {
+                // Timeout or shutdown - the collected callbacks are returned, shutdown will be returned on next call
+                break;
+            }
+            callback_ids.emplace_back(callback_id.release());
+        }
+
+        return callback_ids;
+    }
+
     hailo_status shutdown()
     {
         return m_shutdown_event->signal();
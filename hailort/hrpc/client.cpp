@@ -62,6 +62,7 @@ hailo_status Client::connect()
         if ((status != HAILO_SUCCESS) && (status != HAILO_COMMUNICATION_CLOSED)) { // TODO: Use this to prevent future requests
             LOGGER__ERROR("Error in message loop - {}", status);
         }
+        fail_pending_reply_callbacks();
     });
     return HAILO_SUCCESS;
 }
@@ -81,13 +82,24 @@ hailo_status Client::message_loop()
         }
 
         std::shared_ptr<ResultEvent> event = nullptr;
+        std::function<void(Expected<Buffer>)> reply_callback = nullptr;
         {
             std::unique_lock<std::mutex> lock(m_events_mutex);
             m_events_cv.wait(lock, [this, &header] () {
-                return contains(m_events, header.message_id);
+                return contains(m_events, header.message_id) || contains(m_reply_callbacks, header.message_id);
             });
-            event = m_events[header.message_id];
-            m_events.erase(header.message_id);
+            if (contains(m_reply_callbacks, header.message_id)) {
+                reply_callback = std::move(m_reply_callbacks[header.message_id]);
+                m_reply_callbacks.erase(header.message_id);
+            } else {
+                event = m_events[header.message_id];
+                m_events.erase(header.message_id);
+            }
+        }
+
+        if (reply_callback) {
+            reply_callback(std::move(message));
+            continue;
         }
 
         auto status = event->signal(std::move(message));
@@ -97,6 +109,21 @@ hailo_status Client::message_loop()
     return HAILO_SUCCESS;
 }
 
+void Client::fail_pending_reply_callbacks()
+{
+    std::unordered_map<uint32_t, std::function<void(Expected<Buffer>)>> reply_callbacks;
+    {
+        std::unique_lock<std::mutex> lock(m_events_mutex);
+        m_is_message_loop_done = true;
+        reply_callbacks = std::move(m_reply_callbacks);
+        m_reply_callbacks.clear();
+    }
+
+    for (auto &reply_callback : reply_callbacks) {
+        reply_callback.second(make_unexpected(HAILO_COMMUNICATION_CLOSED));
+    }
+}
+
 Expected<Buffer> Client::execute_request(HailoRpcActionID action_id, const MemoryView &request,
     std::function<hailo_status(RpcConnection)> write_buffers_callback)
 {
@@ -129,6 +156,36 @@ Expected<Buffer> Client::execute_request(HailoRpcActionID action_id, const Memor
     return event->release();
 }
 
+hailo_status Client::execute_request_async(HailoRpcActionID action_id, const MemoryView &request,
+    std::function<hailo_status(RpcConnection)> write_buffers_callback,
+    std::function<void(Expected<Buffer>)> reply_callback)
+{
+    std::unique_lock<std::mutex> lock(m_write_mutex);
+    rpc_message_header_t header;
+    header.size = static_cast<uint32_t>(request.size());
+    header.message_id = m_messages_sent++;
+    header.action_id = static_cast<uint32_t>(action_id);
+
+    // The reply callback is registered before the request is sent, so the message loop never waits for it
+    {
+        std::unique_lock<std::mutex> events_lock(m_events_mutex);
+        CHECK(!m_is_message_loop_done, HAILO_COMMUNICATION_CLOSED, "Connection is closed, can't execute async request");
+        m_reply_callbacks[header.message_id] = std::move(reply_callback);
+    }
+
+    auto status = m_connection.write_message(header, request);
+    if ((HAILO_SUCCESS == status) && write_buffers_callback) {
+        status = write_buffers_callback(m_connection);
+    }
+    if (HAILO_SUCCESS != status) {
+        // The request (or part of it) wasn't sent, so no reply will arrive
+        std::unique_lock<std::mutex> events_lock(m_events_mutex);
+        m_reply_callbacks.erase(header.message_id);
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
 
 void Client::register_custom_reply(HailoRpcActionID action_id,
     std::function<hailo_status(const MemoryView&, RpcConnection connection)> callback)
@@ -48,10 +48,18 @@ public:
     hailo_status connect();
     Expected<Buffer> execute_request(HailoRpcActionID action_id, const MemoryView &request,
         std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
+    // Sends the request without waiting for its reply. reply_callback is called with the reply from the message loop
+    // thread, so it must not execute requests itself.
+    hailo_status execute_request_async(HailoRpcActionID action_id, const MemoryView &request,
+        std::function<hailo_status(RpcConnection)> write_buffers_callback,
+        std::function<void(Expected<Buffer>)> reply_callback);
     void register_custom_reply(HailoRpcActionID action_id, std::function<hailo_status(const MemoryView&, RpcConnection connection)> callback);
+    bool supports_fd_passing() const { return m_connection.supports_fd_passing(); }
 
 protected:
     hailo_status message_loop();
+    // Called once the message loop exits - no replies will arrive anymore
+    void fail_pending_reply_callbacks();
 
     std::string m_device_id;
     bool m_is_running;
@@ -59,6 +67,8 @@ protected:
     RpcConnection m_connection;
     std::thread m_thread;
     std::unordered_map<uint32_t, std::shared_ptr<ResultEvent>> m_events;
+    std::unordered_map<uint32_t, std::function<void(Expected<Buffer>)>> m_reply_callbacks;
+    bool m_is_message_loop_done = false; // Guarded by m_events_mutex
     std::unordered_map<HailoRpcActionID, std::function<hailo_status(const MemoryView&, RpcConnection)>> m_custom_callbacks;
     uint32_t m_messages_sent = 0;
     std::mutex m_write_mutex;
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file dmabuf_fd_cache.cpp
+ * @brief Per-connection cache of the dma-buf fds passed over the connection
+ **/
+
+#include "dmabuf_fd_cache.hpp"
+#include "common/utils.hpp"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace hrpc
+{
+
+Expected<DmaBufFdCache::WriteSlot> DmaBufFdCache::get_write_slot(int fd)
+{
+#ifdef _WIN32
+    (void)fd;
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+#else
+    TRY(auto identity, FileDescriptor::get_identity(fd));
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // The cached dma-bufs are held by the duplicates, so a matching slot holds this dma-buf and needs no other check
+    for (uint32_t slot = 0; slot < SLOTS_COUNT; slot++) {
+        const auto &entry = m_write_entries[slot];
+        if ((nullptr != entry.fd) && (entry.identity == identity)) {
+            return WriteSlot{slot, false, identity, nullptr};
+        }
+    }
+
+    // A miss sends the fd anyway, so this is where the slots of the released dma-bufs are freed
+    drop_released_write_entries();
+
+    // Empty slots are the least recently used
+    uint32_t lru_slot = 0;
+    for (uint32_t slot = 1; slot < SLOTS_COUNT; slot++) {
+        if (m_write_entries[slot].last_used < m_write_entries[lru_slot].last_used) {
+            lru_slot = slot;
+        }
+    }
+
+    auto dup_fd = ::dup(fd);
+    CHECK(dup_fd >= 0, HAILO_OPEN_FILE_FAILURE, "Failed to duplicate dma-buf fd {}, errno = {}", fd, errno);
+    auto fd_ptr = make_unique_nothrow<FileDescriptor>(dup_fd);
+    if (nullptr == fd_ptr) {
+        ::close(dup_fd);
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    return WriteSlot{lru_slot, true, identity, std::move(fd_ptr)};
+#endif
+}
+
+void DmaBufFdCache::commit_write_slot(int fd, WriteSlot &&write_slot)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_write_counter++;
+
+    auto &entry = m_write_entries[write_slot.slot];
+    if (write_slot.is_new_fd) {
+        entry.identity = write_slot.identity;
+        entry.fd = std::move(write_slot.fd);
+    }
+    entry.caller_fd = fd;
+    entry.last_used = m_write_counter;
+}
+
+void DmaBufFdCache::drop_released_write_entries()
+{
+    for (auto &entry : m_write_entries) {
+        if ((nullptr != entry.fd) && !FileDescriptor::refers_to(entry.caller_fd, entry.identity)) {
+            // The slot is taken first by the next new dma-buf, which replaces the fd held by the reader
+            entry = WriteEntry();
+        }
+    }
+}
+
+hailo_status DmaBufFdCache::set_read_fd(uint32_t slot, std::shared_ptr<FileDescriptor> fd)
+{
+    CHECK(slot < SLOTS_COUNT, HAILO_INVALID_ARGUMENT, "Invalid dma-buf cache slot {}", slot);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_read_fds[slot] = fd;
+    return HAILO_SUCCESS;
+}
+
+Expected<std::shared_ptr<FileDescriptor>> DmaBufFdCache::get_read_fd(uint32_t slot)
+{
+    CHECK(slot < SLOTS_COUNT, HAILO_INVALID_ARGUMENT, "Invalid dma-buf cache slot {}", slot);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    CHECK(nullptr != m_read_fds[slot], HAILO_NOT_FOUND, "No dma-buf is cached in slot {}", slot);
+    return std::shared_ptr<FileDescriptor>(m_read_fds[slot]);
+}
+
+} // namespace hrpc
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file dmabuf_fd_cache.hpp
+ * @brief Per-connection cache of the dma-buf fds passed over the connection
+ **/
+
+#ifndef _DMABUF_FD_CACHE_HPP_
+#define _DMABUF_FD_CACHE_HPP_
+
+#include "hailo/expected.hpp"
+#include "common/file_descriptor.hpp"
+
+#include <array>
+#include <memory>
+#include <mutex>
+
+using namespace hailort;
+
+namespace hrpc
+{
+
+/**
+ * Both edges of a connection hold the same slots - the writer decides which slot each dma-buf is cached in, and sends
+ * the fd itself only when the dma-buf isn't already in its slot. The reader keeps the fds it received, so recycled
+ * buffers (e.g. a camera ring) are imported only once.
+ * The writer identifies the dma-bufs by their FileIdentity, and holds a duplicate of the fd of each cached dma-buf, so
+ * the identity can't be reused for another buffer while it's cached. Once the caller's fd (the one the dma-buf was last
+ * written with) is closed, the slot is freed on the next miss, so the writer doesn't keep released buffers alive.
+ * The reader isn't notified of that - it keeps the fd of each slot open until the slot is reused, so each connection
+ * holds at most SLOTS_COUNT released dma-bufs on the reader side.
+ */
+class DmaBufFdCache final
+{
+public:
+    static constexpr uint32_t SLOTS_COUNT = 32;
+
+    struct WriteSlot {
+        uint32_t slot;
+        bool is_new_fd; // The fd must be sent, replacing the one cached in the slot by the reader
+        FileIdentity identity;
+        std::unique_ptr<FileDescriptor> fd; // The duplicate to cache if is_new_fd
+    };
+
+    // Writer side. get_write_slot doesn't change the cache - the slot is updated by commit_write_slot once the fd was
+    // sent, so a failed send doesn't leave the writer assuming that the reader holds the fd. The calls of each write
+    // must not interleave with other writes.
+    Expected<WriteSlot> get_write_slot(int fd);
+    void commit_write_slot(int fd, WriteSlot &&write_slot);
+
+    // Reader side. The fds are shared, so a fd replaced in its slot stays open until its last user releases it.
+    hailo_status set_read_fd(uint32_t slot, std::shared_ptr<FileDescriptor> fd);
+    Expected<std::shared_ptr<FileDescriptor>> get_read_fd(uint32_t slot);
+
+private:
+    // Must be called with m_mutex held
+    void drop_released_write_entries();
+
+    struct WriteEntry {
+        FileIdentity identity;
+        std::unique_ptr<FileDescriptor> fd; // Holds the dma-buf while it's cached
+        int caller_fd = -1; // The caller's fd the dma-buf was last written with (not owned by the cache)
+        uint64_t last_used = 0;
+    };
+
+    std::mutex m_mutex;
+    std::array<WriteEntry, SLOTS_COUNT> m_write_entries;
+    uint64_t m_write_counter = 0;
+    std::array<std::shared_ptr<FileDescriptor>, SLOTS_COUNT> m_read_fds;
+};
+
+} // namespace hrpc
+
+#endif // _DMABUF_FD_CACHE_HPP_
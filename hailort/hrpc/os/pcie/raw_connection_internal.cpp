@@ -12,8 +12,11 @@
 #include "common/utils.hpp"
 #include "common/internal_env_vars.hpp"
 #include "hailo/hailort.h"
+#include "hailo/hailort_common.hpp"
 #include "vdma/driver/hailort_driver.hpp"
 
+#include <array>
+
 // TODO: Remove this after we can choose ports in the driver
 #define DEFAULT_PCIE_PORT (12133)
 
@@ -28,16 +31,47 @@ uint16_t get_pcie_port()
 
 using namespace hrpc;
 
+// The chunks are much smaller than PcieSession::max_transfer_size(), so a message is split to several chunks that can
+// be in flight together. Both edges split the messages the same way, so the size patterns of the session still match.
+static constexpr size_t PIPELINE_CHUNK_SIZE = 1024 * 1024;
+static constexpr size_t MAX_CHUNKS_IN_FLIGHT = 4;
+// The session transfers must be a multiple of 8 bytes
+static constexpr size_t TRANSFER_SIZE_ALIGNMENT = 8;
+
+// Both edges must split the messages to the same chunks, so the version is bumped whenever the split changes.
+// Version 2 - messages are split to PIPELINE_CHUNK_SIZE chunks (version 1 peers send no hello at all).
+static constexpr uint32_t PCIE_CONNECTION_VERSION = 2;
+static constexpr uint32_t PCIE_CONNECTION_HELLO_MAGIC = 0x48524350;
+static const std::chrono::milliseconds PCIE_CONNECTION_HELLO_TIMEOUT(10000);
+
+struct PcieConnectionHello {
+    uint32_t magic;
+    uint32_t version;
+};
+static_assert(0 == (sizeof(PcieConnectionHello) % TRANSFER_SIZE_ALIGNMENT), "Invalid PcieConnectionHello size");
+
+static Expected<std::vector<Buffer>> create_staging_buffers()
+{
+    assert(PIPELINE_CHUNK_SIZE <= PcieSession::max_transfer_size());
+
+    std::vector<Buffer> buffers;
+    buffers.reserve(MAX_CHUNKS_IN_FLIGHT);
+    for (size_t i = 0; i < MAX_CHUNKS_IN_FLIGHT; i++) {
+        TRY(auto buffer, Buffer::create(PIPELINE_CHUNK_SIZE, BufferStorageParams::create_dma()));
+        buffers.emplace_back(std::move(buffer));
+    }
+    return buffers;
+}
+
 Expected<std::shared_ptr<ConnectionContext>> PcieConnectionContext::create_client_shared(const std::string &device_id)
 {
-    const auto max_size = PcieSession::max_transfer_size();
-    TRY(auto write_buffer, Buffer::create(static_cast<size_t>(max_size), BufferStorageParams::create_dma()));
-    TRY(auto read_buffer, Buffer::create(static_cast<size_t>(max_size), BufferStorageParams::create_dma()));
+    TRY(auto write_staging_buffers, create_staging_buffers());
+    TRY(auto read_staging_buffers, create_staging_buffers());
 
     if (device_id.size() > 0) {
         TRY(auto driver, HailoRTDriver::create_pcie(device_id));
         auto ptr = make_shared_nothrow<PcieConnectionContext>(std::move(driver), false,
-            std::move(write_buffer), std::move(read_buffer));
+            std::move(write_staging_buffers), std::move(read_staging_buffers));
         CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
         return std::dynamic_pointer_cast<ConnectionContext>(ptr);
     }
@@ -47,20 +81,19 @@ Expected<std::shared_ptr<ConnectionContext>> PcieConnectionContext::create_clien
 
     TRY(auto driver, HailoRTDriver::create(device_infos[0].device_id, device_infos[0].dev_path));
     auto ptr = make_shared_nothrow<PcieConnectionContext>(std::move(driver), false,
-        std::move(write_buffer), std::move(read_buffer));
+        std::move(write_staging_buffers), std::move(read_staging_buffers));
     CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
     return std::dynamic_pointer_cast<ConnectionContext>(ptr);
 }
 
 Expected<std::shared_ptr<ConnectionContext>> PcieConnectionContext::create_server_shared()
 {
-    const auto max_size = PcieSession::max_transfer_size();
-    TRY(auto write_buffer, Buffer::create(static_cast<size_t>(max_size), BufferStorageParams::create_dma()));
-    TRY(auto read_buffer, Buffer::create(static_cast<size_t>(max_size), BufferStorageParams::create_dma()));
+    TRY(auto write_staging_buffers, create_staging_buffers());
+    TRY(auto read_staging_buffers, create_staging_buffers());
 
     TRY(auto driver, HailoRTDriver::create_pcie_ep());
     auto ptr = make_shared_nothrow<PcieConnectionContext>(std::move(driver), true,
-        std::move(write_buffer), std::move(read_buffer));
+        std::move(write_staging_buffers), std::move(read_staging_buffers));
     CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
     return std::dynamic_pointer_cast<ConnectionContext>(ptr);
 }
@@ -105,6 +138,9 @@ Expected<std::shared_ptr<RawConnection>> PcieRawConnection::accept()
     status = new_conn->set_session(std::move(session));
     CHECK_SUCCESS(status);
 
+    status = new_conn->exchange_hello(true);
+    CHECK_SUCCESS(status);
+
     return std::dynamic_pointer_cast<RawConnection>(new_conn);
 }
 
@@ -122,43 +158,163 @@ hailo_status PcieRawConnection::connect()
     auto status = set_session(std::move(session));
     CHECK_SUCCESS(status);
 
+    status = exchange_hello(false);
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status PcieRawConnection::exchange_hello(bool is_server)
+{
+    const PcieConnectionHello local_hello{PCIE_CONNECTION_HELLO_MAGIC, PCIE_CONNECTION_VERSION};
+    if (!is_server) {
+        auto status = write(reinterpret_cast<const uint8_t*>(&local_hello), sizeof(local_hello),
+            PCIE_CONNECTION_HELLO_TIMEOUT);
+        CHECK_SUCCESS(status, "Failed sending the pcie connection hello");
+    }
+
+    PcieConnectionHello remote_hello{};
+    auto status = read(reinterpret_cast<uint8_t*>(&remote_hello), sizeof(remote_hello), PCIE_CONNECTION_HELLO_TIMEOUT);
+    CHECK_SUCCESS(status, "Failed receiving the pcie connection hello (the peer may be of an older HailoRT version)");
+    CHECK(PCIE_CONNECTION_HELLO_MAGIC == remote_hello.magic, HAILO_INVALID_SERVICE_VERSION,
+        "Invalid pcie connection hello magic {:#x} (the peer may be of an older HailoRT version)", remote_hello.magic);
+    CHECK(PCIE_CONNECTION_VERSION == remote_hello.version, HAILO_INVALID_SERVICE_VERSION,
+        "Incompatible pcie connection version {} (expected {})", remote_hello.version, PCIE_CONNECTION_VERSION);
+
+    if (is_server) {
+        status = write(reinterpret_cast<const uint8_t*>(&local_hello), sizeof(local_hello),
+            PCIE_CONNECTION_HELLO_TIMEOUT);
+        CHECK_SUCCESS(status, "Failed sending the pcie connection hello");
+    }
+
     return HAILO_SUCCESS;
 }
 
+void PcieTransfersTracker::transfer_done(hailo_status status)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if ((HAILO_SUCCESS == m_status) && (HAILO_SUCCESS != status)) {
+            m_status = status;
+        }
+        m_done_count++;
+    }
+    m_cv.notify_all();
+}
+
+hailo_status PcieTransfersTracker::wait_for_transfers(size_t transfers_count, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool was_successful = m_cv.wait_for(lock, timeout, [this, transfers_count] () -> bool {
+        return (m_done_count >= transfers_count) || (HAILO_SUCCESS != m_status);
+    });
+    CHECK(was_successful, HAILO_TIMEOUT, "Timeout waiting for transfer completion");
+
+    return m_status;
+}
+
+hailo_status PcieRawConnection::launch_write_chunk(const uint8_t *chunk, size_t chunk_size, size_t chunk_index,
+    std::shared_ptr<PcieTransfersTracker> tracker)
+{
+    const auto alignment = OsUtils::get_dma_able_alignment();
+    auto &staging_buffer = m_context->write_staging_buffer(chunk_index);
+    const auto chunk_address = reinterpret_cast<size_t>(chunk);
+    const auto head_size = HailoRTCommon::align_to(chunk_address, alignment) - chunk_address;
+
+    std::vector<TransferBuffer> transfer_buffers;
+    if (0 == head_size) {
+        transfer_buffers.emplace_back(MemoryView(const_cast<uint8_t*>(chunk), chunk_size));
+    } else if ((chunk_size <= head_size) || (0 != (head_size % TRANSFER_SIZE_ALIGNMENT))) {
+        // Small chunks, and chunks whose head can't be a transfer buffer by itself, are staged whole
+        memcpy(staging_buffer.data(), chunk, chunk_size);
+        transfer_buffers.emplace_back(MemoryView(staging_buffer.data(), chunk_size));
+    } else {
+        // Same as VdmaInputStream - only the head up to the first aligned address is staged
+        memcpy(staging_buffer.data(), chunk, head_size);
+        transfer_buffers.emplace_back(MemoryView(staging_buffer.data(), head_size));
+        transfer_buffers.emplace_back(MemoryView(const_cast<uint8_t*>(chunk + head_size), chunk_size - head_size));
+    }
+
+    return m_session->write_async(TransferRequest(std::move(transfer_buffers), [tracker](hailo_status status) {
+        tracker->transfer_done(status);
+    }));
+}
+
+Expected<size_t> PcieRawConnection::launch_read_chunk(uint8_t *chunk, size_t chunk_size, size_t chunk_index,
+    std::shared_ptr<PcieTransfersTracker> tracker)
+{
+    const auto alignment = OsUtils::get_dma_able_alignment();
+    auto &staging_buffer = m_context->read_staging_buffer(chunk_index);
+    const bool is_aligned = (0 == (reinterpret_cast<size_t>(chunk) % alignment));
+
+    // The user buffer must own the full cache lines it's read to, so only its whole aligned pages are read directly
+    const size_t direct_size = is_aligned ? (chunk_size - (chunk_size % alignment)) : 0;
+    const size_t staged_size = chunk_size - direct_size;
+
+    std::vector<TransferBuffer> transfer_buffers;
+    if (direct_size > 0) {
+        transfer_buffers.emplace_back(MemoryView(chunk, direct_size));
+    }
+    if (staged_size > 0) {
+        transfer_buffers.emplace_back(MemoryView(staging_buffer.data(), staged_size));
+    }
+
+    auto status = m_session->read_async(TransferRequest(std::move(transfer_buffers), [tracker](hailo_status status) {
+        tracker->transfer_done(status);
+    }));
+    if (HAILO_SUCCESS != status) {
+        return make_unexpected(status);
+    }
+
+    return Expected<size_t>(staged_size);
+}
+
 hailo_status PcieRawConnection::write(const uint8_t *buffer, size_t size, std::chrono::milliseconds timeout)
 {
     if (0 == size) {
         return HAILO_SUCCESS;
     }
 
-    const auto alignment = OsUtils::get_dma_able_alignment();
-    const auto max_size = PcieSession::max_transfer_size();
-    bool is_aligned = ((reinterpret_cast<uintptr_t>(buffer) % alignment )== 0);
-
-    size_t bytes_written = 0;
-    while (bytes_written < size) {
-        size_t amount_to_write = 0;
-        auto size_left = size - bytes_written;
-        if (is_aligned) {
-            amount_to_write = std::min(static_cast<size_t>(size_left), static_cast<size_t>(max_size));
-            auto status = m_session->write(buffer + bytes_written, amount_to_write, timeout);
-            if (HAILO_STREAM_ABORT == status) {
-                return HAILO_COMMUNICATION_CLOSED;
-            }
-            CHECK_SUCCESS(status);
-        } else {
-            amount_to_write = std::min(static_cast<size_t>(size_left), m_context->write_buffer().size());
-            memcpy(m_context->write_buffer().data(), buffer + bytes_written, amount_to_write);
-            auto status = m_session->write(m_context->write_buffer().data(), amount_to_write, timeout);
+    auto tracker = make_shared_nothrow<PcieTransfersTracker>();
+    CHECK_NOT_NULL(tracker, HAILO_OUT_OF_HOST_MEMORY);
+
+    size_t chunks_count = 0;
+    auto status = write_chunks(buffer, size, timeout, tracker, chunks_count);
+    if ((HAILO_SUCCESS != status) && (0 < chunks_count)) {
+        abort_chunks_in_flight();
+    }
+    return status;
+}
+
+hailo_status PcieRawConnection::write_chunks(const uint8_t *buffer, size_t size, std::chrono::milliseconds timeout,
+    std::shared_ptr<PcieTransfersTracker> tracker, size_t &chunks_count)
+{
+    chunks_count = 0;
+    for (size_t offset = 0; offset < size; offset += PIPELINE_CHUNK_SIZE) {
+        if (chunks_count >= MAX_CHUNKS_IN_FLIGHT) {
+            // The chunks complete in order, so once the oldest chunk in flight is done its staging buffer is free
+            auto status = tracker->wait_for_transfers(chunks_count - MAX_CHUNKS_IN_FLIGHT + 1, timeout);
             if (HAILO_STREAM_ABORT == status) {
                 return HAILO_COMMUNICATION_CLOSED;
             }
             CHECK_SUCCESS(status);
         }
 
-        bytes_written += amount_to_write;
+        const auto chunk_size = std::min(size - offset, PIPELINE_CHUNK_SIZE);
+        auto status = launch_write_chunk(buffer + offset, chunk_size, chunks_count, tracker);
+        if (HAILO_STREAM_ABORT == status) {
+            return HAILO_COMMUNICATION_CLOSED;
+        }
+        CHECK_SUCCESS(status);
+        chunks_count++;
     }
 
+    auto status = tracker->wait_for_transfers(chunks_count, timeout);
+    if (HAILO_STREAM_ABORT == status) {
+        return HAILO_COMMUNICATION_CLOSED;
+    }
+    CHECK_SUCCESS(status);
+
     return HAILO_SUCCESS;
 }
 
@@ -168,38 +324,80 @@ hailo_status PcieRawConnection::read(uint8_t *buffer, size_t size, std::chrono::
         return HAILO_SUCCESS;
     }
 
-    const auto alignment = OsUtils::get_dma_able_alignment();
-    const auto max_size = PcieSession::max_transfer_size();
-    bool is_aligned = ((reinterpret_cast<uintptr_t>(buffer) % alignment) == 0);
-
-    size_t bytes_read = 0;
-    while (bytes_read < size) {
-        size_t amount_to_read = 0;
-        auto size_left = size - bytes_read;
-        if (is_aligned) {
-            amount_to_read = std::min(static_cast<size_t>(size_left), static_cast<size_t>(max_size));
-            auto status = m_session->read(buffer + bytes_read, amount_to_read, timeout);
-            if (HAILO_STREAM_ABORT == status) {
-                return HAILO_COMMUNICATION_CLOSED;
-            }
-            CHECK_SUCCESS(status);
-        } else {
-            amount_to_read = std::min(static_cast<size_t>(size_left), m_context->read_buffer().size());
-            auto status = m_session->read(m_context->read_buffer().data(), amount_to_read, timeout);
-            if (HAILO_STREAM_ABORT == status) {
-                return HAILO_COMMUNICATION_CLOSED;
+    auto tracker = make_shared_nothrow<PcieTransfersTracker>();
+    CHECK_NOT_NULL(tracker, HAILO_OUT_OF_HOST_MEMORY);
+
+    size_t chunks_count = 0;
+    auto status = read_chunks(buffer, size, timeout, tracker, chunks_count);
+    if ((HAILO_SUCCESS != status) && (0 < chunks_count)) {
+        abort_chunks_in_flight();
+    }
+    return status;
+}
+
+hailo_status PcieRawConnection::read_chunks(uint8_t *buffer, size_t size, std::chrono::milliseconds timeout,
+    std::shared_ptr<PcieTransfersTracker> tracker, size_t &chunks_count)
+{
+    // The staged part at the end of each chunk in flight (by its staging buffer), copied out once the chunk is done
+    std::array<MemoryView, MAX_CHUNKS_IN_FLIGHT> staged_parts;
+    chunks_count = 0;
+    size_t chunks_done = 0;
+    auto complete_oldest_chunk = [&] () -> hailo_status {
+        auto status = tracker->wait_for_transfers(chunks_done + 1, timeout);
+        if (HAILO_STREAM_ABORT == status) {
+            return HAILO_COMMUNICATION_CLOSED;
+        }
+        CHECK_SUCCESS(status);
+
+        auto &staged_part = staged_parts[chunks_done % MAX_CHUNKS_IN_FLIGHT];
+        if (!staged_part.empty()) {
+            memcpy(staged_part.data(), m_context->read_staging_buffer(chunks_done).data(), staged_part.size());
+        }
+        chunks_done++;
+        return HAILO_SUCCESS;
+    };
+
+    for (size_t offset = 0; offset < size; offset += PIPELINE_CHUNK_SIZE) {
+        if ((chunks_count - chunks_done) >= MAX_CHUNKS_IN_FLIGHT) {
+            auto status = complete_oldest_chunk();
+            if (HAILO_COMMUNICATION_CLOSED == status) {
+                return status;
             }
             CHECK_SUCCESS(status);
+        }
 
-            memcpy(buffer + bytes_read, m_context->read_buffer().data(), amount_to_read);
+        const auto chunk_size = std::min(size - offset, PIPELINE_CHUNK_SIZE);
+        auto staged_size = launch_read_chunk(buffer + offset, chunk_size, chunks_count, tracker);
+        if (HAILO_STREAM_ABORT == staged_size.status()) {
+            return HAILO_COMMUNICATION_CLOSED;
         }
+        CHECK_EXPECTED_AS_STATUS(staged_size);
+        staged_parts[chunks_count % MAX_CHUNKS_IN_FLIGHT] =
+            MemoryView(buffer + offset + chunk_size - staged_size.value(), staged_size.value());
+        chunks_count++;
+    }
 
-        bytes_read += amount_to_read;
+    while (chunks_done < chunks_count) {
+        auto status = complete_oldest_chunk();
+        if (HAILO_COMMUNICATION_CLOSED == status) {
+            return status;
+        }
+        CHECK_SUCCESS(status);
     }
 
     return HAILO_SUCCESS;
 }
 
+void PcieRawConnection::abort_chunks_in_flight()
+{
+    // Closing the session aborts its channels and completes all their pending transfers, so once it returns no chunk
+    // accesses the user buffer or the staging buffers
+    auto status = m_session->close();
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed closing the pcie session after a failed transfer, status {}", status);
+    }
+}
+
 hailo_status PcieRawConnection::close()
 {
     auto status = m_session->close();
@@ -15,6 +15,8 @@
 #include "hrpc/raw_connection.hpp"
 
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <condition_variable>
 
 using namespace hailort;
@@ -29,29 +31,65 @@ public:
     static Expected<std::shared_ptr<ConnectionContext>> create_server_shared();
 
     PcieConnectionContext(std::shared_ptr<HailoRTDriver> &&driver, bool is_accepting,
-        Buffer &&write_buffer, Buffer &&read_buffer)
+        std::vector<Buffer> &&write_staging_buffers, std::vector<Buffer> &&read_staging_buffers)
         : ConnectionContext(is_accepting), m_driver(std::move(driver)),
-            m_write_buffer(std::move(write_buffer)), m_read_buffer(std::move(read_buffer)),
+            m_write_staging_buffers(std::move(write_staging_buffers)),
+            m_read_staging_buffers(std::move(read_staging_buffers)),
             m_conn_count(0) {}
 
     virtual ~PcieConnectionContext() = default;
 
     std::shared_ptr<HailoRTDriver> driver() { return m_driver; }
-    Buffer &write_buffer() { return m_write_buffer; }
-    Buffer &read_buffer() { return m_read_buffer; }
+    // A ring of staging buffers, one for each chunk in flight. Used only for the parts of the chunks that can't be
+    // transferred from/to the user buffer directly.
+    Buffer &write_staging_buffer(size_t chunk_index)
+    {
+        return m_write_staging_buffers[chunk_index % m_write_staging_buffers.size()];
+    }
+    Buffer &read_staging_buffer(size_t chunk_index)
+    {
+        return m_read_staging_buffers[chunk_index % m_read_staging_buffers.size()];
+    }
 
     hailo_status wait_for_available_connection();
     void mark_connection_closed();
 
 private:
     std::shared_ptr<HailoRTDriver> m_driver;
-    Buffer m_write_buffer;
-    Buffer m_read_buffer;
+    std::vector<Buffer> m_write_staging_buffers;
+    std::vector<Buffer> m_read_staging_buffers;
     uint32_t m_conn_count;
     std::mutex m_mutex;
     std::condition_variable m_cv;
 };
 
+// Counts the completed transfers of a single write/read. It is shared with the transfers callbacks, so it stays valid
+// if the write/read returns (on timeout or failure) before all of its transfers completed.
+class PcieTransfersTracker final
+{
+public:
+    void transfer_done(hailo_status status);
+
+    // Waits until transfers_count transfers completed, or until any of the transfers failed
+    hailo_status wait_for_transfers(size_t transfers_count, std::chrono::milliseconds timeout);
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    size_t m_done_count = 0;
+    hailo_status m_status = HAILO_SUCCESS;
+};
+
+/**
+ * The writes/reads are split into chunks, and several chunks are kept in flight, so the launch of a chunk (and the
+ * copy of its staged part) overlaps the transfer of the previous ones.
+ * The chunks are transferred from/to the user buffer directly where possible, and only their unaligned head (on write)
+ * or partial tail page (on read) goes through a staging buffer. Unaligned reads go through the staging buffer whole,
+ * since the user buffer must own the full cache lines it's read to.
+ * If a write/read fails while some of its chunks are in flight, the session is closed (aborting the chunks), since
+ * they may still access the user buffer and the staging buffers. The connection can't be used afterwards.
+ * Since both edges must split the messages the same way, they exchange a PcieConnectionHello once connected.
+ */
 class PcieRawConnection : public RawConnection
 {
 public:
@@ -71,6 +109,19 @@ public:
     explicit PcieRawConnection(std::shared_ptr<PcieConnectionContext> context) : m_context(context) {}
 private:
     hailo_status set_session(PcieSession &&session);
+    // The client sends its hello first, and the server replies with its own
+    hailo_status exchange_hello(bool is_server);
+    // chunks_count is set to the number of launched chunks, which may still be in flight on failure
+    hailo_status write_chunks(const uint8_t *buffer, size_t size, std::chrono::milliseconds timeout,
+        std::shared_ptr<PcieTransfersTracker> tracker, size_t &chunks_count);
+    hailo_status read_chunks(uint8_t *buffer, size_t size, std::chrono::milliseconds timeout,
+        std::shared_ptr<PcieTransfersTracker> tracker, size_t &chunks_count);
+    void abort_chunks_in_flight();
+    hailo_status launch_write_chunk(const uint8_t *chunk, size_t chunk_size, size_t chunk_index,
+        std::shared_ptr<PcieTransfersTracker> tracker);
+    // Returns the size of the staged part at the end of the chunk, to be copied out once the chunk completes
+    Expected<size_t> launch_read_chunk(uint8_t *chunk, size_t chunk_size, size_t chunk_index,
+        std::shared_ptr<PcieTransfersTracker> tracker);
 
     std::shared_ptr<PcieConnectionContext> m_context;
     std::shared_ptr<PcieSession> m_session;
@@ -47,7 +47,7 @@ Expected<std::shared_ptr<OsRawConnection>> OsRawConnection::create_localhost_ser
     result = ::listen(fd, 5);
     CHECK_AS_EXPECTED(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Listen error, errno = {}", errno);
 
-    auto ptr = make_shared_nothrow<OsRawConnection>(fd, context);
+    auto ptr = make_shared_nothrow<OsRawConnection>(fd, context, true);
     CHECK_NOT_NULL_AS_EXPECTED(ptr, HAILO_OUT_OF_HOST_MEMORY);
     return ptr;
 }
@@ -57,7 +57,7 @@ Expected<std::shared_ptr<OsRawConnection>> OsRawConnection::create_localhost_cli
     int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
     CHECK_AS_EXPECTED(fd >= 0, HAILO_OPEN_FILE_FAILURE, "Socket creation error, errno = {}", errno);
     
-    auto ptr = make_shared_nothrow<OsRawConnection>(fd, context);
+    auto ptr = make_shared_nothrow<OsRawConnection>(fd, context, true);
     CHECK_NOT_NULL_AS_EXPECTED(ptr, HAILO_OUT_OF_HOST_MEMORY);
     return ptr;
 }
@@ -151,7 +151,7 @@ Expected<std::shared_ptr<RawConnection>> OsRawConnection::accept()
     int fd = ::accept(m_fd, nullptr, nullptr);
     CHECK_AS_EXPECTED(fd >= 0, HAILO_FILE_OPERATION_FAILURE, "Accept error, errno = {}", errno);
 
-    std::shared_ptr<RawConnection> ptr = make_shared_nothrow<OsRawConnection>(fd, m_context);
+    std::shared_ptr<RawConnection> ptr = make_shared_nothrow<OsRawConnection>(fd, m_context, m_is_unix_socket);
     CHECK_NOT_NULL_AS_EXPECTED(ptr, HAILO_OUT_OF_HOST_MEMORY);
 
     return ptr;
@@ -247,4 +247,97 @@ hailo_status OsRawConnection::close()
     CHECK(0 == result, HAILO_CLOSE_FAILURE, "Socket close failed, errno = {}", errno);
 
     return HAILO_SUCCESS;
-}
\ No newline at end of file
+}
+
+hailo_status OsRawConnection::write_fd(int fd)
+{
+    CHECK(m_is_unix_socket, HAILO_NOT_SUPPORTED, "Passing fds is supported only over unix-socket");
+
+    uint8_t data = 0;
+    struct iovec iov = {&data, sizeof(data)};
+    union {
+        struct cmsghdr align;
+        char buffer[CMSG_SPACE(sizeof(int))];
+    } control = {};
+
+    struct msghdr message = {};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+    ssize_t result = ::sendmsg(m_fd, &message, MSG_NOSIGNAL);
+    CHECK(result == sizeof(data), HAILO_FILE_OPERATION_FAILURE, "Write fd error, errno = {}", errno);
+
+    return HAILO_SUCCESS;
+}
+
+static hailo_status validate_fd_message(struct msghdr &message, size_t received_size)
+{
+    CHECK(sizeof(uint8_t) == received_size, HAILO_FILE_OPERATION_FAILURE, "Read fd error, received {} bytes",
+        received_size);
+    CHECK(0 == (message.msg_flags & MSG_CTRUNC), HAILO_FILE_OPERATION_FAILURE, "Read fd error, control data truncated");
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+    CHECK((nullptr != cmsg) && (SOL_SOCKET == cmsg->cmsg_level) && (SCM_RIGHTS == cmsg->cmsg_type) &&
+        (CMSG_LEN(sizeof(int)) == cmsg->cmsg_len) && (nullptr == CMSG_NXTHDR(&message, cmsg)),
+        HAILO_FILE_OPERATION_FAILURE, "Read fd error, expected a single fd");
+
+    return HAILO_SUCCESS;
+}
+
+static void close_received_fds(struct msghdr &message)
+{
+    for (auto cmsg = CMSG_FIRSTHDR(&message); nullptr != cmsg; cmsg = CMSG_NXTHDR(&message, cmsg)) {
+        if ((SOL_SOCKET != cmsg->cmsg_level) || (SCM_RIGHTS != cmsg->cmsg_type) || (cmsg->cmsg_len < CMSG_LEN(0))) {
+            continue;
+        }
+        const size_t fds_count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (size_t i = 0; i < fds_count; i++) {
+            int fd = -1;
+            memcpy(&fd, CMSG_DATA(cmsg) + (i * sizeof(int)), sizeof(int));
+            (void)::close(fd);
+        }
+    }
+}
+
+Expected<int> OsRawConnection::read_fd()
+{
+    CHECK(m_is_unix_socket, HAILO_NOT_SUPPORTED, "Passing fds is supported only over unix-socket");
+
+    uint8_t data = 0;
+    struct iovec iov = {&data, sizeof(data)};
+    union {
+        struct cmsghdr align;
+        char buffer[CMSG_SPACE(sizeof(int))];
+    } control = {};
+
+    struct msghdr message = {};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+
+    ssize_t result = ::recvmsg(m_fd, &message, MSG_CMSG_CLOEXEC);
+    if (0 == result) {
+        return make_unexpected(HAILO_COMMUNICATION_CLOSED); // 0 means the communication is closed
+    }
+    CHECK(result > 0, HAILO_FILE_OPERATION_FAILURE, "Read fd error, errno = {}", errno);
+
+    // The received fds are already open in this process, so they are closed if the message isn't valid
+    auto status = validate_fd_message(message, static_cast<size_t>(result));
+    if (HAILO_SUCCESS != status) {
+        close_received_fds(message);
+        return make_unexpected(status);
+    }
+
+    int fd = -1;
+    memcpy(&fd, CMSG_DATA(CMSG_FIRSTHDR(&message)), sizeof(int));
+    return fd;
+}
@@ -45,7 +45,12 @@ public:
         std::chrono::milliseconds timeout = DEFAULT_READ_TIMEOUT) override;
     virtual hailo_status close() override;
 
-    OsRawConnection(int fd, std::shared_ptr<OsConnectionContext> context) : m_fd(fd), m_context(context) {}
+    virtual bool supports_fd_passing() const override { return m_is_unix_socket; }
+    virtual hailo_status write_fd(int fd) override;
+    virtual Expected<int> read_fd() override;
+
+    OsRawConnection(int fd, std::shared_ptr<OsConnectionContext> context, bool is_unix_socket = false) :
+        m_fd(fd), m_context(context), m_is_unix_socket(is_unix_socket) {}
 private:
     static Expected<std::shared_ptr<OsRawConnection>> create_by_addr_server(std::shared_ptr<OsConnectionContext> context,
         const std::string &ip, uint16_t port);
@@ -61,6 +66,7 @@ private:
 
     int m_fd;
     std::shared_ptr<OsConnectionContext> m_context;
+    bool m_is_unix_socket;
 };
 
 } // namespace hrpc
@@ -54,6 +54,12 @@ public:
     virtual hailo_status read(uint8_t *buffer, size_t size,
         std::chrono::milliseconds timeout = DEFAULT_READ_TIMEOUT) = 0;
     virtual hailo_status close() = 0;
+
+    // Only connections within the same machine (unix-socket) can pass file descriptors. Each fd is sent along with a
+    // single byte of the stream, so it keeps its order relative to the data written before/after it.
+    virtual bool supports_fd_passing() const { return false; }
+    virtual hailo_status write_fd(int /*fd*/) { return HAILO_NOT_SUPPORTED; }
+    virtual Expected<int> read_fd() { return make_unexpected(HAILO_NOT_SUPPORTED); }
 };
 
 } // namespace hrpc
@@ -8,6 +8,7 @@
  **/
 
 #include "rpc_connection.hpp"
+#include "utils/buffer_storage.hpp"
 
 namespace hrpc
 {
@@ -39,7 +40,8 @@ Expected<Buffer> RpcConnection::read_message(rpc_message_header_t &header) {
     CHECK_AS_EXPECTED(RPC_MESSAGE_MAGIC == header.magic, HAILO_INTERNAL_FAILURE, "Invalid magic! {} != {}",
         header.magic, RPC_MESSAGE_MAGIC);
 
-    TRY(auto buffer, Buffer::create(header.size, BufferStorageParams::create_dma()));
+    // Short-lived (freed once the message is handled), so its memory is taken from the slab allocator
+    TRY(auto buffer, Buffer::create(header.size, PooledHeapStorage::create_params()));
     status = m_raw->read(buffer.data(), header.size);
     if (HAILO_COMMUNICATION_CLOSED == status) {
         return make_unexpected(status);
@@ -71,6 +73,62 @@ hailo_status RpcConnection::read_buffer(MemoryView buffer)
     return HAILO_SUCCESS;
 }
 
+bool RpcConnection::supports_fd_passing() const
+{
+    return (nullptr != m_raw) && m_raw->supports_fd_passing();
+}
+
+hailo_status RpcConnection::write_dmabuf_fd(int fd)
+{
+    CHECK_NOT_NULL(m_dmabuf_fd_cache, HAILO_OUT_OF_HOST_MEMORY);
+    TRY(auto write_slot, m_dmabuf_fd_cache->get_write_slot(fd));
+
+    rpc_dmabuf_header_t header = {write_slot.slot, write_slot.is_new_fd ? 1u : 0u};
+    auto status = m_raw->write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    if (HAILO_COMMUNICATION_CLOSED == status) {
+        return make_unexpected(status);
+    }
+    CHECK_SUCCESS(status);
+
+    if (write_slot.is_new_fd) {
+        status = m_raw->write_fd(fd);
+        if (HAILO_COMMUNICATION_CLOSED == status) {
+            return make_unexpected(status);
+        }
+        CHECK_SUCCESS(status);
+    }
+
+    m_dmabuf_fd_cache->commit_write_slot(fd, std::move(write_slot));
+    return HAILO_SUCCESS;
+}
+
+Expected<std::shared_ptr<FileDescriptor>> RpcConnection::read_dmabuf_fd()
+{
+    CHECK_NOT_NULL(m_dmabuf_fd_cache, HAILO_OUT_OF_HOST_MEMORY);
+
+    rpc_dmabuf_header_t header = {};
+    auto status = m_raw->read(reinterpret_cast<uint8_t*>(&header), sizeof(header));
+    if (HAILO_COMMUNICATION_CLOSED == status) {
+        return make_unexpected(status);
+    }
+    CHECK_SUCCESS(status);
+
+    if (0 != header.is_new_fd) {
+        auto fd = m_raw->read_fd();
+        if (HAILO_COMMUNICATION_CLOSED == fd.status()) {
+            return make_unexpected(fd.status());
+        }
+        CHECK_EXPECTED(fd);
+
+        auto fd_ptr = make_shared_nothrow<FileDescriptor>(fd.value());
+        CHECK_NOT_NULL(fd_ptr, HAILO_OUT_OF_HOST_MEMORY);
+        status = m_dmabuf_fd_cache->set_read_fd(header.slot, fd_ptr);
+        CHECK_SUCCESS(status);
+    }
+
+    return m_dmabuf_fd_cache->get_read_fd(header.slot);
+}
+
 hailo_status RpcConnection::close()
 {
     if (m_raw) {
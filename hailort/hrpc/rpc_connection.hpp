@@ -11,6 +11,7 @@
 #define _RPC_CONNECTION_HPP_
 
 #include "raw_connection.hpp"
+#include "dmabuf_fd_cache.hpp"
 
 #include "hailo/buffer.hpp"
 #include "common/utils.hpp"
@@ -29,13 +30,20 @@ struct rpc_message_header_t
     uint32_t message_id;
     uint32_t action_id;
 };
+
+struct rpc_dmabuf_header_t
+{
+    uint32_t slot;
+    uint32_t is_new_fd; // The fd follows the header
+};
 #pragma pack(pop)
 
 class RpcConnection
 {
 public:
     RpcConnection() = default;
-    explicit RpcConnection(std::shared_ptr<RawConnection> raw) : m_raw(raw) {}
+    explicit RpcConnection(std::shared_ptr<RawConnection> raw) :
+        m_raw(raw), m_dmabuf_fd_cache(make_shared_nothrow<DmaBufFdCache>()) {}
 
     hailo_status write_message(const rpc_message_header_t &header, const MemoryView &buffer);
     Expected<Buffer> read_message(rpc_message_header_t &header);
@@ -43,10 +51,17 @@ public:
     hailo_status write_buffer(const MemoryView &buffer);
     hailo_status read_buffer(MemoryView buffer);
 
+    // dma-buf fds are passed through the connection's DmaBufFdCache - a fd is sent only if its dma-buf isn't cached
+    // by the other edge yet. Supported only if the raw connection can pass fds.
+    bool supports_fd_passing() const;
+    hailo_status write_dmabuf_fd(int fd);
+    Expected<std::shared_ptr<FileDescriptor>> read_dmabuf_fd();
+
     hailo_status close();
 
 private:
     std::shared_ptr<RawConnection> m_raw;
+    std::shared_ptr<DmaBufFdCache> m_dmabuf_fd_cache;
 };
 
 } // namespace hrpc
@@ -12,6 +12,7 @@
 #include "hailo/hailort_common.hpp"
 #include "hailo/hailort_defaults.hpp"
 #include "common/utils.hpp"
+#include "utils/buffer_storage.hpp"
 
 // https://github.com/protocolbuffers/protobuf/tree/master/cmake#notes-on-compiler-warnings
 #if defined(_MSC_VER)
@@ -41,7 +42,7 @@ Expected<Buffer> CreateVDeviceSerializer::serialize_request(const hailo_vdevice_
     proto_params->set_group_id(params.group_id == nullptr ? "" : std::string(params.group_id));
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CreateVDevice'");
@@ -76,7 +77,7 @@ Expected<Buffer> CreateVDeviceSerializer::serialize_reply(hailo_status status, r
     auto proto_vdevice_handle = reply.mutable_vdevice_handle();
     proto_vdevice_handle->set_id(vdevice_handle);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CreateVDevice'");
@@ -102,7 +103,7 @@ Expected<Buffer> DestroyVDeviceSerializer::serialize_request(rpc_object_handle_t
     proto_vdevice_handle->set_id(vdevice_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'DestroyVDevice'");
 
@@ -124,7 +125,7 @@ Expected<Buffer> DestroyVDeviceSerializer::serialize_reply(hailo_status status)
     VDevice_Destroy_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'DestroyVDevice'");
@@ -153,7 +154,7 @@ Expected<Buffer> CreateInferModelSerializer::serialize_request(rpc_object_handle
     request.set_name(name);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CreateVInferModel'");
 
@@ -178,7 +179,7 @@ Expected<Buffer> CreateInferModelSerializer::serialize_reply(hailo_status status
     auto proto_infer_model_handle = reply.mutable_infer_model_handle();
     proto_infer_model_handle->set_id(infer_model_handle);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CreateVInferModel'");
@@ -204,7 +205,7 @@ Expected<Buffer> DestroyInferModelSerializer::serialize_request(rpc_object_handl
     proto_infer_model_handle->set_id(infer_model_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'DestroyInferModel'");
 
@@ -226,7 +227,7 @@ Expected<Buffer> DestroyInferModelSerializer::serialize_reply(hailo_status statu
     InferModel_Destroy_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'DestroyInferModel'");
@@ -281,7 +282,7 @@ Expected<Buffer> CreateConfiguredInferModelSerializer::serialize_request(rpc_cre
     request.set_latency_flag(static_cast<uint32_t>(params.latency_flag));
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CreateConfiguredInferModel'");
 
@@ -338,7 +339,7 @@ Expected<Buffer> CreateConfiguredInferModelSerializer::serialize_reply(hailo_sta
     proto_configured_infer_model_handle->set_id(configured_infer_handle);
     reply.set_async_queue_size(async_queue_size);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CreateConfiguredInferModel'");
@@ -365,7 +366,7 @@ Expected<Buffer> DestroyConfiguredInferModelSerializer::serialize_request(rpc_ob
     proto_infer_model_handle->set_id(configured_infer_model_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'DestroyConfiguredInferModel'");
 
@@ -387,7 +388,7 @@ Expected<Buffer> DestroyConfiguredInferModelSerializer::serialize_reply(hailo_st
     ConfiguredInferModel_Destroy_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'DestroyConfiguredInferModel'");
@@ -415,7 +416,7 @@ Expected<Buffer> SetSchedulerTimeoutSerializer::serialize_request(rpc_object_han
     request.set_timeout(static_cast<uint32_t>(timeout.count()));
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerTimeout'");
 
@@ -438,7 +439,7 @@ Expected<Buffer> SetSchedulerTimeoutSerializer::serialize_reply(hailo_status sta
     ConfiguredInferModel_SetSchedulerTimeout_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerTimeout'");
@@ -465,7 +466,7 @@ Expected<Buffer> SetSchedulerThresholdSerializer::serialize_request(rpc_object_h
     request.set_threshold(threshold);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerThreshold'");
 
@@ -488,7 +489,7 @@ Expected<Buffer> SetSchedulerThresholdSerializer::serialize_reply(hailo_status s
     ConfiguredInferModel_SetSchedulerThreshold_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerThreshold'");
@@ -515,7 +516,7 @@ Expected<Buffer> SetSchedulerPrioritySerializer::serialize_request(rpc_object_ha
     request.set_priority(priority);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerPriority'");
 
@@ -538,7 +539,7 @@ Expected<Buffer> SetSchedulerPrioritySerializer::serialize_reply(hailo_status st
     ConfiguredInferModel_SetSchedulerPriority_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerPriority'");
@@ -564,7 +565,7 @@ Expected<Buffer> GetHwLatencyMeasurementSerializer::serialize_request(rpc_object
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'GetHwLatencyMeasurement'");
 
@@ -587,7 +588,7 @@ Expected<Buffer> GetHwLatencyMeasurementSerializer::serialize_reply(hailo_status
     reply.set_status(status);
     reply.set_avg_hw_latency(avg_hw_latency);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'GetHwLatencyMeasurement'");
@@ -613,7 +614,7 @@ Expected<Buffer> ActivateSerializer::serialize_request(rpc_object_handle_t confi
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'Activate'");
 
@@ -635,7 +636,7 @@ Expected<Buffer> ActivateSerializer::serialize_reply(hailo_status status)
     ConfiguredInferModel_Activate_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'Activate'");
@@ -661,7 +662,7 @@ Expected<Buffer> DeactivateSerializer::serialize_request(rpc_object_handle_t con
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'Deactivate'");
 
@@ -683,7 +684,7 @@ Expected<Buffer> DeactivateSerializer::serialize_reply(hailo_status status)
     ConfiguredInferModel_Deactivate_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'Deactivate'");
@@ -709,7 +710,7 @@ Expected<Buffer> ShutdownSerializer::serialize_request(rpc_object_handle_t confi
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'Shutdown'");
 
@@ -731,7 +732,7 @@ Expected<Buffer> ShutdownSerializer::serialize_reply(hailo_status status)
     ConfiguredInferModel_Shutdown_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'Shutdown'");
@@ -763,9 +764,11 @@ Expected<Buffer> RunAsyncSerializer::serialize_request(const RunAsyncSerializer:
     proto_cb_handle->set_id(request_struct.callback_handle);
 
     *request.mutable_input_buffer_sizes() = {request_struct.input_buffer_sizes.begin(), request_struct.input_buffer_sizes.end()};
+    *request.mutable_dmabuf_input_buffer_indices() = {request_struct.dmabuf_input_buffer_indices.begin(),
+        request_struct.dmabuf_input_buffer_indices.end()};
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'RunAsync'");
 
@@ -781,12 +784,15 @@ Expected<RunAsyncSerializer::Request> RunAsyncSerializer::deserialize_request(
         HAILO_RPC_FAILED, "Failed to de-serialize 'RunAsync'");
 
     std::vector<uint32_t> input_buffer_sizes(request.input_buffer_sizes().begin(), request.input_buffer_sizes().end());
+    std::vector<uint32_t> dmabuf_input_buffer_indices(request.dmabuf_input_buffer_indices().begin(),
+        request.dmabuf_input_buffer_indices().end());
 
     RunAsyncSerializer::Request request_struct;
     request_struct.configured_infer_model_handle = request.configured_infer_model_handle().id();
     request_struct.infer_model_handle = request.infer_model_handle().id();
     request_struct.callback_handle = request.callback_handle().id();
     request_struct.input_buffer_sizes = input_buffer_sizes;
+    request_struct.dmabuf_input_buffer_indices = dmabuf_input_buffer_indices;
     return request_struct;
 }
 
@@ -795,7 +801,7 @@ Expected<Buffer> RunAsyncSerializer::serialize_reply(hailo_status status)
     ConfiguredInferModel_AsyncInfer_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'RunAsync'");
@@ -825,7 +831,7 @@ Expected<Buffer> CallbackCalledSerializer::serialize_reply(hailo_status status,
     auto proto_cim_handle = reply.mutable_configured_infer_model_handle();
     proto_cim_handle->set_id(configured_infer_model_handle);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CallbackCalled'");
@@ -850,7 +856,7 @@ Expected<Buffer> CreateDeviceSerializer::serialize_request()
     Device_Create_Request request;
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CreateDevice'");
@@ -876,7 +882,7 @@ Expected<Buffer> CreateDeviceSerializer::serialize_reply(hailo_status status, rp
     auto proto_device_handle = reply.mutable_device_handle();
     proto_device_handle->set_id(device_handle);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'CreateDevice'");
@@ -902,7 +908,7 @@ Expected<Buffer> DestroyDeviceSerializer::serialize_request(rpc_object_handle_t
     proto_device_handle->set_id(device_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'DestroyDevice'");
 
@@ -924,7 +930,7 @@ Expected<Buffer> DestroyDeviceSerializer::serialize_reply(hailo_status status)
     Device_Destroy_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'DestroyDevice'");
@@ -950,7 +956,7 @@ Expected<Buffer> IdentifyDeviceSerializer::serialize_request(rpc_object_handle_t
     proto_device_handle->set_id(device_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'IdentifyDevice'");
 
@@ -995,7 +1001,7 @@ Expected<Buffer> IdentifyDeviceSerializer::serialize_reply(hailo_status status,
     fw_version->set_minor_value(identity.fw_version.minor);
     fw_version->set_revision_value(identity.fw_version.revision);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'IdentifyDevice'");
@@ -1048,7 +1054,7 @@ Expected<Buffer> ExtendedDeviceInfoSerializer::serialize_request(rpc_object_hand
     proto_device_handle->set_id(device_handle);
 
     // TODO (HRT-14732) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), PooledHeapStorage::create_params()));
     CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'ExtendedDeviceInfo'");
 
@@ -1103,7 +1109,7 @@ Expected<Buffer> ExtendedDeviceInfoSerializer::serialize_reply(hailo_status stat
         soc_pm_values->Add(extended_info.soc_pm_values[i]);
     }
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
+    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), PooledHeapStorage::create_params()));
 
     CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to serialize 'ExtendedDeviceInfo'");
@@ -242,6 +242,8 @@ public:
         rpc_object_handle_t infer_model_handle;
         rpc_object_handle_t callback_handle;
         std::vector<uint32_t> input_buffer_sizes;
+        // Indices (in input_buffer_sizes) of the buffers passed as dma-buf fds, instead of being written
+        std::vector<uint32_t> dmabuf_input_buffer_indices;
     };
 
     static Expected<Buffer> serialize_request(const Request &request_struct);
@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file async_infer_benchmarks.cpp
+ * @brief Benchmarks of ConfiguredInferModel::run_async over a ring of pre-mapped buffers, with and without the boundary
+ *        channels descriptor programs cache (HAILO_CACHE_DESC_PROGRAMS). Requires a device, and a hef given by
+ *        HAILO_BENCHMARK_HEF_PATH (the benchmarks are skipped otherwise).
+ **/
+
+#include "hailo/vdevice.hpp"
+#include "hailo/infer_model.hpp"
+#include "common/utils.hpp"
+#include "common/internal_env_vars.hpp"
+#include "utils.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <unistd.h>
+
+
+namespace hailort
+{
+
+#define HAILO_BENCHMARK_HEF_PATH_ENV_VAR ("HAILO_BENCHMARK_HEF_PATH")
+
+static const std::chrono::milliseconds BENCHMARK_TIMEOUT(10000);
+
+// The vdevice is created once, and is shared by all the benchmark cases
+static Expected<VDevice*> get_benchmark_vdevice()
+{
+    static std::unique_ptr<VDevice> vdevice = nullptr;
+    if (nullptr == vdevice) {
+        TRY(vdevice, VDevice::create());
+    }
+    return vdevice.get();
+}
+
+// The buffers of a single frame, mapped to the vdevice for as long as they live
+class MappedFrameBuffers final
+{
+public:
+    MappedFrameBuffers(VDevice &vdevice) : m_vdevice(vdevice) {}
+    MappedFrameBuffers(MappedFrameBuffers &&other) = default;
+    MappedFrameBuffers(const MappedFrameBuffers &other) = delete;
+    MappedFrameBuffers &operator=(const MappedFrameBuffers &other) = delete;
+
+    ~MappedFrameBuffers()
+    {
+        for (auto &mapping : m_mappings) {
+            (void)m_vdevice.dma_unmap(mapping.first.data(), mapping.first.size(), mapping.second);
+        }
+    }
+
+    Expected<MemoryView> add(size_t size, hailo_dma_buffer_direction_t direction)
+    {
+        // Output buffers must be page aligned (also in size), see InferStream::set_buffer
+        const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        TRY(auto buffer, Buffer::create(DIV_ROUND_UP(size, page_size) * page_size, BufferStorageParams::create_dma()));
+        CHECK_SUCCESS(m_vdevice.dma_map(buffer.data(), buffer.size(), direction));
+        m_buffers.emplace_back(std::move(buffer));
+        m_mappings.emplace_back(MemoryView(m_buffers.back()), direction);
+        return MemoryView(m_buffers.back().data(), size);
+    }
+
+private:
+    VDevice &m_vdevice;
+    std::vector<Buffer> m_buffers;
+    std::vector<std::pair<MemoryView, hailo_dma_buffer_direction_t>> m_mappings;
+};
+
+// Each iteration launches a frame with the next bindings of a ring of buffers_count pre-mapped bindings. With the
+// cache, a buffer launched again at the same descriptors isn't re-programmed by the driver.
+static void BM_async_infer_premapped_ring(benchmark::State &state)
+{
+    const bool should_cache_desc_programs = (0 != state.range(0));
+    const auto buffers_count = static_cast<size_t>(state.range(1));
+    const auto hef_path = get_env_variable(HAILO_BENCHMARK_HEF_PATH_ENV_VAR);
+    auto vdevice = get_benchmark_vdevice();
+    if (!hef_path || !vdevice) {
+        state.SkipWithError("No device or hef (set HAILO_BENCHMARK_HEF_PATH)");
+        return;
+    }
+
+    // The boundary channels read it only when the model is configured
+    if (0 != setenv(HAILO_CACHE_DESC_PROGRAMS_ENV_VAR, should_cache_desc_programs ? "1" : "0", 1)) {
+        state.SkipWithError("Failed setting HAILO_CACHE_DESC_PROGRAMS");
+        return;
+    }
+    auto infer_model = vdevice.value()->create_infer_model(hef_path.value());
+    if (!infer_model) {
+        state.SkipWithError("Failed creating infer model");
+        return;
+    }
+    auto configured_infer_model = infer_model.value()->configure();
+    (void)unsetenv(HAILO_CACHE_DESC_PROGRAMS_ENV_VAR);
+    if (!configured_infer_model) {
+        state.SkipWithError("Failed configuring infer model");
+        return;
+    }
+
+    std::vector<MappedFrameBuffers> frames_buffers;
+    std::vector<ConfiguredInferModel::Bindings> bindings_ring;
+    for (size_t i = 0; i < buffers_count; i++) {
+        frames_buffers.emplace_back(*vdevice.value());
+        auto bindings = configured_infer_model->create_bindings();
+        if (!bindings) {
+            state.SkipWithError("Failed creating bindings");
+            return;
+        }
+        for (const auto &input : infer_model.value()->inputs()) {
+            auto buffer = frames_buffers.back().add(input.get_frame_size(), HAILO_DMA_BUFFER_DIRECTION_H2D);
+            if (!buffer || (HAILO_SUCCESS != bindings->input(input.name())->set_buffer(buffer.value()))) {
+                state.SkipWithError("Failed setting input buffer");
+                return;
+            }
+        }
+        for (const auto &output : infer_model.value()->outputs()) {
+            auto buffer = frames_buffers.back().add(output.get_frame_size(), HAILO_DMA_BUFFER_DIRECTION_D2H);
+            if (!buffer || (HAILO_SUCCESS != bindings->output(output.name())->set_buffer(buffer.value()))) {
+                state.SkipWithError("Failed setting output buffer");
+                return;
+            }
+        }
+        bindings_ring.emplace_back(bindings.release());
+    }
+
+    // The job of each bindings is waited for before its buffers are launched again
+    std::vector<AsyncInferJob> jobs(buffers_count);
+    size_t index = 0;
+    for (auto _ : state) {
+        auto &job = jobs[index % buffers_count];
+        auto status = job.wait(BENCHMARK_TIMEOUT);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Failed waiting for job");
+            return;
+        }
+        status = configured_infer_model->wait_for_async_ready(BENCHMARK_TIMEOUT);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Failed waiting for async ready");
+            return;
+        }
+        auto new_job = configured_infer_model->run_async(bindings_ring[index % buffers_count]);
+        if (!new_job) {
+            state.SkipWithError("Failed launching job");
+            return;
+        }
+        job = new_job.release();
+        index++;
+    }
+    for (auto &job : jobs) {
+        if (HAILO_SUCCESS != job.wait(BENCHMARK_TIMEOUT)) {
+            state.SkipWithError("Failed waiting for job");
+            return;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_async_infer_premapped_ring)->Args({0, 4})->Args({1, 4})->Args({0, 16})->Args({1, 16})->UseRealTime();
+
+} /* namespace hailort */
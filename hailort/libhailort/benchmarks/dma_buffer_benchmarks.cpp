@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file dma_buffer_benchmarks.cpp
+ * @brief Benchmarks of the dma-buf CPU mappings (cached and uncached). The dma-bufs are memfd backed, created through
+ *        /dev/udmabuf (the benchmarks are skipped if it's unavailable).
+ **/
+
+#include "utils/dma_buffer_utils.hpp"
+#include "common/file_descriptor.hpp"
+#include "common/utils.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <linux/udmabuf.h>
+
+#include <vector>
+
+
+namespace hailort
+{
+
+#define UDMABUF_DEVICE_PATH ("/dev/udmabuf")
+
+static Expected<FileDescriptor> create_udmabuf(size_t size)
+{
+    FileDescriptor memfd(memfd_create("hailort_benchmark", MFD_ALLOW_SEALING));
+    CHECK_AS_EXPECTED(0 <= memfd, HAILO_OPEN_FILE_FAILURE, "Failed to create memfd, errno = {}", errno);
+    CHECK_AS_EXPECTED(0 == ftruncate(memfd, static_cast<off_t>(size)), HAILO_FILE_OPERATION_FAILURE,
+        "Failed to resize memfd, errno = {}", errno);
+    // udmabuf requires the memfd to be sealed against shrinking
+    CHECK_AS_EXPECTED(0 == fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK), HAILO_FILE_OPERATION_FAILURE,
+        "Failed to seal memfd, errno = {}", errno);
+
+    FileDescriptor udmabuf_device(open(UDMABUF_DEVICE_PATH, O_RDWR | O_CLOEXEC));
+    CHECK_AS_EXPECTED(0 <= udmabuf_device, HAILO_OPEN_FILE_FAILURE, "Failed to open {}, errno = {}",
+        UDMABUF_DEVICE_PATH, errno);
+
+    struct udmabuf_create create = {};
+    create.memfd = static_cast<__u32>(memfd);
+    create.flags = UDMABUF_FLAGS_CLOEXEC;
+    create.offset = 0;
+    create.size = size;
+    // The dma-buf holds a reference to the memfd, so the memfd can be closed
+    FileDescriptor dmabuf(ioctl(udmabuf_device, UDMABUF_CREATE, &create));
+    CHECK_AS_EXPECTED(0 <= dmabuf, HAILO_FILE_OPERATION_FAILURE, "Failed to create udmabuf, errno = {}", errno);
+
+    return dmabuf;
+}
+
+static Expected<std::vector<FileDescriptor>> create_udmabufs(size_t size, size_t count)
+{
+    std::vector<FileDescriptor> dmabufs;
+    dmabufs.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        TRY(auto dmabuf, create_udmabuf(size));
+        dmabufs.emplace_back(std::move(dmabuf));
+    }
+    return dmabufs;
+}
+
+static size_t frame_size_aligned_to_page()
+{
+    const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return ((640 * 640 * 3) + page_size - 1) / page_size * page_size;
+}
+
+// Each iteration maps and unmaps the next dma-buf of a ring of buffers_count dma-bufs (e.g. a camera ring)
+template <bool IS_CACHED>
+static void BM_dma_buffer_map_ring(benchmark::State &state)
+{
+    const auto buffers_count = static_cast<size_t>(state.range(0));
+    const auto size = frame_size_aligned_to_page();
+    auto dmabufs = create_udmabufs(size, buffers_count);
+    if (!dmabufs) {
+        state.SkipWithError("Failed creating udmabufs (is /dev/udmabuf available?)");
+        return;
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        hailo_dma_buffer_t dma_buffer = {dmabufs.value()[index % buffers_count], size};
+        auto mapping = IS_CACHED ?
+            DmaBufferUtils::mmap_dma_buffer_cached(dma_buffer, BufferProtection::READ) :
+            DmaBufferUtils::mmap_dma_buffer(dma_buffer, BufferProtection::READ);
+        if (!mapping) {
+            state.SkipWithError("Failed mapping dma-buf");
+            return;
+        }
+        benchmark::DoNotOptimize(mapping->data()[0]);
+        auto status = IS_CACHED ?
+            DmaBufferUtils::munmap_dma_buffer_cached(dma_buffer, mapping.value(), BufferProtection::READ) :
+            DmaBufferUtils::munmap_dma_buffer(dma_buffer, mapping.value(), BufferProtection::READ);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Failed unmapping dma-buf");
+            return;
+        }
+        index++;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK_TEMPLATE(BM_dma_buffer_map_ring, false)->Arg(1)->Arg(32);
+BENCHMARK_TEMPLATE(BM_dma_buffer_map_ring, true)->Arg(1)->Arg(32);
+
+// Each iteration maps a new dma-buf through the cache and closes it - the cache must drop the mappings of the closed
+// dma-bufs (a cache miss each time), so the memory stays bounded
+static void BM_dma_buffer_map_cached_released(benchmark::State &state)
+{
+    const auto size = frame_size_aligned_to_page();
+    for (auto _ : state) {
+        auto dmabuf = create_udmabuf(size);
+        if (!dmabuf) {
+            state.SkipWithError("Failed creating udmabuf (is /dev/udmabuf available?)");
+            return;
+        }
+
+        hailo_dma_buffer_t dma_buffer = {dmabuf.value(), size};
+        auto mapping = DmaBufferUtils::mmap_dma_buffer_cached(dma_buffer, BufferProtection::READ);
+        if (!mapping) {
+            state.SkipWithError("Failed mapping dma-buf");
+            return;
+        }
+        auto status = DmaBufferUtils::munmap_dma_buffer_cached(dma_buffer, mapping.value(), BufferProtection::READ);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Failed unmapping dma-buf");
+            return;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_dma_buffer_map_cached_released);
+
+} /* namespace hailort */
@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file hrpc_benchmarks.cpp
+ * @brief Benchmarks of the hrpc run_async submission, over the unix-socket connection within a single process (with the
+ *        inputs copied or passed as memfd fds)
+ **/
+
+#include "hrpc/client.hpp"
+#include "hrpc/server.hpp"
+#include "hrpc_protocol/serializer.hpp"
+#include "common/internal_env_vars.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <algorithm>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+namespace hailort
+{
+
+static const size_t CONNECT_ATTEMPTS = 100;
+static const std::chrono::milliseconds CONNECT_RETRY_INTERVAL(10);
+static const std::chrono::milliseconds BENCHMARK_TIMEOUT(10000);
+
+// Mimics the transport part of the hailort server's RUN_ASYNC action - reads the inputs and replies, without inferring
+class RunAsyncBenchmarkServer final : public hrpc::Server
+{
+public:
+    RunAsyncBenchmarkServer(std::shared_ptr<hrpc::ConnectionContext> connection_context) :
+        hrpc::Server(connection_context)
+    {
+        hrpc::Dispatcher dispatcher;
+        dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
+        [] (const MemoryView &request, hrpc::ServerContextPtr server_context) -> Expected<Buffer> {
+            TRY(auto request_struct, RunAsyncSerializer::deserialize_request(request));
+            const auto &dmabuf_indices = request_struct.dmabuf_input_buffer_indices;
+            for (uint32_t i = 0; i < request_struct.input_buffer_sizes.size(); i++) {
+                if (std::find(dmabuf_indices.begin(), dmabuf_indices.end(), i) != dmabuf_indices.end()) {
+                    TRY(auto fd, server_context->connection().read_dmabuf_fd());
+                    continue;
+                }
+                TRY(auto input, Buffer::create(request_struct.input_buffer_sizes[i], BufferStorageParams::create_dma()));
+                CHECK_SUCCESS_AS_EXPECTED(server_context->connection().read_buffer(MemoryView(input)));
+            }
+            return RunAsyncSerializer::serialize_reply(HAILO_SUCCESS);
+        });
+        set_dispatcher(dispatcher);
+    }
+
+private:
+    virtual hailo_status cleanup_client_resources(hrpc::RpcConnection) override
+    {
+        return HAILO_SUCCESS;
+    }
+};
+
+// The server and client are created once, and are never destroyed since Server::serve() doesn't return.
+// Notice that the unix-socket address is fixed, so the benchmarks can't run alongside a hailort server.
+static Expected<std::shared_ptr<hrpc::Client>> get_benchmark_client()
+{
+    static std::shared_ptr<hrpc::Client> *client = nullptr;
+    if (nullptr != client) {
+        return Expected<std::shared_ptr<hrpc::Client>>(*client);
+    }
+
+    CHECK(0 == setenv(HAILO_SOCKET_COM_ADDR_SERVER_ENV_VAR, HAILO_SOCKET_COM_ADDR_UNIX_SOCKET, 1), HAILO_INTERNAL_FAILURE);
+    CHECK(0 == setenv(HAILO_SOCKET_COM_ADDR_CLIENT_ENV_VAR, HAILO_SOCKET_COM_ADDR_UNIX_SOCKET, 1), HAILO_INTERNAL_FAILURE);
+
+    TRY(auto server_context, hrpc::ConnectionContext::create_server_shared());
+    auto server = new (std::nothrow) RunAsyncBenchmarkServer(server_context);
+    CHECK_NOT_NULL(server, HAILO_OUT_OF_HOST_MEMORY);
+    std::thread([server] { (void)server->serve(); }).detach();
+
+    auto new_client = make_shared_nothrow<hrpc::Client>("");
+    CHECK_NOT_NULL(new_client, HAILO_OUT_OF_HOST_MEMORY);
+    // The server may still be creating its socket
+    auto status = HAILO_UNINITIALIZED;
+    for (size_t i = 0; (i < CONNECT_ATTEMPTS) && (HAILO_SUCCESS != status); i++) {
+        status = new_client->connect();
+        if (HAILO_SUCCESS != status) {
+            std::this_thread::sleep_for(CONNECT_RETRY_INTERVAL);
+        }
+    }
+    CHECK_SUCCESS(status);
+
+    client = new (std::nothrow) std::shared_ptr<hrpc::Client>(new_client);
+    CHECK_NOT_NULL(client, HAILO_OUT_OF_HOST_MEMORY);
+    return Expected<std::shared_ptr<hrpc::Client>>(*client);
+}
+
+static Expected<Buffer> create_run_async_request(size_t input_size, bool is_dmabuf = false)
+{
+    RunAsyncSerializer::Request request{};
+    request.configured_infer_model_handle = 1;
+    request.infer_model_handle = 2;
+    request.callback_handle = 3;
+    request.input_buffer_sizes = {static_cast<uint32_t>(input_size)};
+    if (is_dmabuf) {
+        request.dmabuf_input_buffer_indices = {0};
+    }
+    return RunAsyncSerializer::serialize_request(request);
+}
+
+// Each request waits for its reply before the next one is sent
+static void BM_hrpc_run_async_round_trip(benchmark::State &state)
+{
+    const auto input_size = static_cast<size_t>(state.range(0));
+    auto client = get_benchmark_client();
+    auto request = create_run_async_request(input_size);
+    auto input = Buffer::create(input_size, BufferStorageParams::create_dma());
+    if (!client || !request || !input) {
+        state.SkipWithError("Failed creating benchmark resources");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto reply = client.value()->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
+            MemoryView(*request), [&input] (hrpc::RpcConnection connection) {
+            return connection.write_buffer(MemoryView(*input));
+        });
+        if (!reply || (HAILO_SUCCESS != RunAsyncSerializer::deserialize_reply(MemoryView(*reply)))) {
+            state.SkipWithError("Failed executing request");
+            return;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * input_size));
+}
+BENCHMARK(BM_hrpc_run_async_round_trip)->Arg(1024)->Arg(640 * 640 * 3)->UseRealTime();
+
+// The requests are sent one-way (as ConfiguredInferModelHrpcClient::run_async does), the replies are waited for once
+// all the requests were sent
+static void BM_hrpc_run_async_one_way(benchmark::State &state)
+{
+    const auto input_size = static_cast<size_t>(state.range(0));
+    auto client = get_benchmark_client();
+    auto request = create_run_async_request(input_size);
+    auto input = Buffer::create(input_size, BufferStorageParams::create_dma());
+    if (!client || !request || !input) {
+        state.SkipWithError("Failed creating benchmark resources");
+        return;
+    }
+
+    struct Replies {
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t count = 0;
+        hailo_status status = HAILO_SUCCESS;
+    };
+    auto replies = std::make_shared<Replies>();
+    auto reply_callback = [replies] (Expected<Buffer> reply) {
+        auto status = reply ? RunAsyncSerializer::deserialize_reply(MemoryView(*reply)) : reply.status();
+        {
+            std::unique_lock<std::mutex> lock(replies->mutex);
+            replies->count++;
+            if (HAILO_SUCCESS != status) {
+                replies->status = status;
+            }
+        }
+        replies->cv.notify_one();
+    };
+
+    size_t requests_count = 0;
+    for (auto _ : state) {
+        auto status = client.value()->execute_request_async(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
+            MemoryView(*request), [&input] (hrpc::RpcConnection connection) {
+            return connection.write_buffer(MemoryView(*input));
+        }, reply_callback);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Failed executing request");
+            return;
+        }
+        requests_count++;
+    }
+
+    std::unique_lock<std::mutex> lock(replies->mutex);
+    bool done = replies->cv.wait_for(lock, BENCHMARK_TIMEOUT, [&] { return replies->count == requests_count; });
+    if (!done || (HAILO_SUCCESS != replies->status)) {
+        state.SkipWithError("Failed waiting for replies");
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * input_size));
+}
+BENCHMARK(BM_hrpc_run_async_one_way)->Arg(1024)->Arg(640 * 640 * 3)->UseRealTime();
+
+#if defined(__linux__)
+// Each request passes the next fd of a ring of buffers_count memfds (standing in for dma-bufs, which are passed the
+// same way). A ring larger than the connection's DmaBufFdCache sends the fd with every request, a smaller one only once.
+static void BM_hrpc_run_async_dmabuf_round_trip(benchmark::State &state)
+{
+    const auto buffers_count = static_cast<size_t>(state.range(0));
+    const size_t input_size = 640 * 640 * 3;
+    auto client = get_benchmark_client();
+    auto request = create_run_async_request(input_size, true);
+    if (!client || !request) {
+        state.SkipWithError("Failed creating benchmark resources");
+        return;
+    }
+    if (!client.value()->supports_fd_passing()) {
+        state.SkipWithError("The connection can't pass fds");
+        return;
+    }
+
+    std::vector<FileDescriptor> memfds;
+    memfds.reserve(buffers_count);
+    for (size_t i = 0; i < buffers_count; i++) {
+        FileDescriptor memfd(memfd_create("hailort_benchmark", 0));
+        if ((0 > memfd) || (0 != ftruncate(memfd, static_cast<off_t>(input_size)))) {
+            state.SkipWithError("Failed creating memfd");
+            return;
+        }
+        memfds.emplace_back(std::move(memfd));
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        const int fd = memfds[index % buffers_count];
+        auto reply = client.value()->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
+            MemoryView(*request), [fd] (hrpc::RpcConnection connection) {
+            return connection.write_dmabuf_fd(fd);
+        });
+        if (!reply || (HAILO_SUCCESS != RunAsyncSerializer::deserialize_reply(MemoryView(*reply)))) {
+            state.SkipWithError("Failed executing request");
+            return;
+        }
+        index++;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_hrpc_run_async_dmabuf_round_trip)->Arg(4)->Arg(hrpc::DmaBufFdCache::SLOTS_COUNT * 2)->UseRealTime();
+#endif
+
+} /* namespace hailort */
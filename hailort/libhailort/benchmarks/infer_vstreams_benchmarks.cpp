@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file infer_vstreams_benchmarks.cpp
+ * @brief Benchmarks of InferVStreams::infer. Requires a device, and a hef given by HAILO_BENCHMARK_HEF_PATH (the
+ *        benchmarks are skipped otherwise).
+ **/
+
+#include "hailo/vdevice.hpp"
+#include "hailo/hef.hpp"
+#include "hailo/inference_pipeline.hpp"
+#include "common/utils.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+namespace hailort
+{
+
+#define HAILO_BENCHMARK_HEF_PATH_ENV_VAR ("HAILO_BENCHMARK_HEF_PATH")
+
+// The vdevice and the configured network group are created once, and are shared by all the benchmark cases
+static Expected<std::shared_ptr<ConfiguredNetworkGroup>> get_benchmark_network_group()
+{
+    static std::unique_ptr<VDevice> vdevice = nullptr;
+    static std::shared_ptr<ConfiguredNetworkGroup> network_group = nullptr;
+    if (nullptr != network_group) {
+        return Expected<std::shared_ptr<ConfiguredNetworkGroup>>(network_group);
+    }
+
+    TRY(const auto hef_path, get_env_variable(HAILO_BENCHMARK_HEF_PATH_ENV_VAR));
+    TRY(auto hef, Hef::create(hef_path));
+    TRY(vdevice, VDevice::create());
+    TRY(auto configure_params, vdevice->create_configure_params(hef));
+    TRY(auto network_groups, vdevice->configure(hef, configure_params));
+    CHECK_AS_EXPECTED(1 == network_groups.size(), HAILO_INVALID_ARGUMENT, "Only single network group hefs are supported");
+
+    network_group = network_groups[0];
+    return Expected<std::shared_ptr<ConfiguredNetworkGroup>>(network_group);
+}
+
+// Each iteration infers frames_count frames through all the vstreams of the network group
+static void BM_infer_vstreams(benchmark::State &state)
+{
+    const auto frames_count = static_cast<size_t>(state.range(0));
+    auto network_group = get_benchmark_network_group();
+    if (!network_group) {
+        state.SkipWithError("No device or hef (set HAILO_BENCHMARK_HEF_PATH)");
+        return;
+    }
+
+    auto input_params = network_group.value()->make_input_vstream_params(true, HAILO_FORMAT_TYPE_AUTO,
+        HAILO_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE);
+    auto output_params = network_group.value()->make_output_vstream_params(true, HAILO_FORMAT_TYPE_AUTO,
+        HAILO_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE);
+    if (!input_params || !output_params) {
+        state.SkipWithError("Failed creating vstream params");
+        return;
+    }
+    auto infer_vstreams = InferVStreams::create(*network_group.value(), input_params.value(), output_params.value());
+    if (!infer_vstreams) {
+        state.SkipWithError("Failed creating infer vstreams");
+        return;
+    }
+
+    std::vector<Buffer> buffers;
+    std::map<std::string, MemoryView> input_data;
+    std::map<std::string, MemoryView> output_data;
+    for (const auto &input : infer_vstreams->get_input_vstreams()) {
+        auto buffer = Buffer::create(input.get().get_frame_size() * frames_count);
+        if (!buffer) {
+            state.SkipWithError("Failed creating input buffer");
+            return;
+        }
+        buffers.emplace_back(buffer.release());
+        input_data.emplace(input.get().name(), MemoryView(buffers.back()));
+    }
+    for (const auto &output : infer_vstreams->get_output_vstreams()) {
+        auto buffer = Buffer::create(output.get().get_frame_size() * frames_count);
+        if (!buffer) {
+            state.SkipWithError("Failed creating output buffer");
+            return;
+        }
+        buffers.emplace_back(buffer.release());
+        output_data.emplace(output.get().name(), MemoryView(buffers.back()));
+    }
+
+    for (auto _ : state) {
+        auto status = infer_vstreams->infer(input_data, output_data, frames_count);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Failed inferring");
+            return;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * frames_count));
+}
+BENCHMARK(BM_infer_vstreams)->Arg(1)->Arg(8)->Arg(64)->UseRealTime();
+
+} /* namespace hailort */
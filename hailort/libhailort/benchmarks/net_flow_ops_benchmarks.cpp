@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file net_flow_ops_benchmarks.cpp
+ * @brief Benchmarks of the net_flow post-process ops, running on synthetic tensors
+ **/
+
+#include "hailo/hailort_common.hpp"
+#include "net_flow/ops/argmax_post_process.hpp"
+#include "net_flow/ops/softmax_post_process.hpp"
+#include "net_flow/ops/yolov5_post_process.hpp"
+#include "net_flow/ops/yolov8_post_process.hpp"
+#include "net_flow/ops/yolox_post_process.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+
+namespace hailort
+{
+namespace net_flow
+{
+
+static const std::string NETWORK_NAME = "benchmark_net";
+static const std::string OUTPUT_NAME = "output";
+static const uint32_t IMAGE_SIZE = 640;
+static const uint32_t NUMBER_OF_CLASSES = 80;
+// Spreads the uint8 values over ~[-4, 4] after de-quantization, so the sigmoid outputs cover most of (0, 1)
+static const hailo_quant_info_t NMS_INPUT_QUANT_INFO = {128.0f, 1.0f / 32.0f, 0.0f, 255.0f};
+
+struct OpBenchmarkParams
+{
+    std::shared_ptr<Op> op;
+    std::map<std::string, std::vector<uint8_t>> inputs;
+    std::vector<uint8_t> output;
+};
+
+static BufferMetaData create_buffer_metadata(const hailo_3d_image_shape_t &shape, hailo_format_type_t type,
+    hailo_format_order_t order, const hailo_quant_info_t &quant_info = {0.0f, 1.0f, 0.0f, 255.0f})
+{
+    BufferMetaData metadata{};
+    metadata.shape = shape;
+    metadata.padded_shape = shape;
+    metadata.format = {type, order, HAILO_FORMAT_FLAGS_NONE};
+    metadata.quant_info = quant_info;
+    return metadata;
+}
+
+static std::vector<uint8_t> create_random_buffer(size_t size)
+{
+    // Fixed seed, so every run gets the same data (and the same amount of detections)
+    static std::mt19937 generator(0);
+    std::uniform_int_distribution<uint32_t> distribution(0, UINT8_MAX);
+
+    std::vector<uint8_t> buffer(size);
+    for (auto &byte : buffer) {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+    return buffer;
+}
+
+static std::vector<uint8_t> create_input_buffer(const BufferMetaData &metadata)
+{
+    return create_random_buffer(HailoRTCommon::get_frame_size(metadata.padded_shape, metadata.format));
+}
+
+static NmsPostProcessConfig create_nms_config()
+{
+    NmsPostProcessConfig nms_config{};
+    nms_config.nms_score_th = 0.3;
+    nms_config.nms_iou_th = 0.6;
+    nms_config.max_proposals_per_class = 100;
+    nms_config.number_of_classes = NUMBER_OF_CLASSES;
+    return nms_config;
+}
+
+static std::unordered_map<std::string, BufferMetaData> create_nms_outputs_metadata()
+{
+    return {{OUTPUT_NAME, create_buffer_metadata({1, 1, 1}, HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_HAILO_NMS)}};
+}
+
+static Expected<std::vector<uint8_t>> create_nms_output_buffer(NmsOpMetadata &metadata)
+{
+    auto vstream_info = metadata.get_output_vstream_info();
+    CHECK_EXPECTED(vstream_info);
+    return std::vector<uint8_t>(HailoRTCommon::get_nms_host_frame_size(vstream_info->nms_shape, vstream_info->format));
+}
+
+static void run_op_benchmark(benchmark::State &state, Expected<OpBenchmarkParams> &params)
+{
+    if (!params) {
+        state.SkipWithError("Failed creating op");
+        return;
+    }
+
+    std::map<std::string, MemoryView> inputs;
+    size_t input_bytes = 0;
+    for (auto &name_to_buffer : params->inputs) {
+        inputs.emplace(name_to_buffer.first, MemoryView(name_to_buffer.second.data(), name_to_buffer.second.size()));
+        input_bytes += name_to_buffer.second.size();
+    }
+    std::map<std::string, MemoryView> outputs = {
+        {OUTPUT_NAME, MemoryView(params->output.data(), params->output.size())}
+    };
+
+    for (auto _ : state) {
+        auto status = params->op->execute(inputs, outputs);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Op execution failed");
+            return;
+        }
+        benchmark::DoNotOptimize(params->output.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * input_bytes));
+}
+
+static Expected<OpBenchmarkParams> create_argmax_op(const hailo_3d_image_shape_t &shape)
+{
+    const auto input_metadata = create_buffer_metadata(shape, HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW);
+    const auto output_metadata = create_buffer_metadata({shape.height, shape.width, 1}, HAILO_FORMAT_TYPE_UINT8,
+        HAILO_FORMAT_ORDER_NHW);
+
+    TRY(auto metadata, ArgmaxOpMetadata::create({{"input", input_metadata}}, {{OUTPUT_NAME, output_metadata}}, NETWORK_NAME));
+    TRY(auto op, ArgmaxPostProcessOp::create(std::dynamic_pointer_cast<ArgmaxOpMetadata>(metadata)));
+
+    OpBenchmarkParams params;
+    params.op = op;
+    params.inputs.emplace("input", create_input_buffer(input_metadata));
+    params.output.resize(HailoRTCommon::get_frame_size(output_metadata.shape, output_metadata.format));
+    return params;
+}
+
+static Expected<OpBenchmarkParams> create_softmax_op(const hailo_3d_image_shape_t &shape)
+{
+    const auto buffer_metadata = create_buffer_metadata(shape, HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHWC);
+
+    TRY(auto metadata, SoftmaxOpMetadata::create({{"input", buffer_metadata}}, {{OUTPUT_NAME, buffer_metadata}}, NETWORK_NAME));
+    TRY(auto op, SoftmaxPostProcessOp::create(std::dynamic_pointer_cast<SoftmaxOpMetadata>(metadata)));
+
+    OpBenchmarkParams params;
+    params.op = op;
+    // Small logits, so the exponents won't overflow
+    params.inputs.emplace("input", std::vector<uint8_t>(HailoRTCommon::get_frame_size(shape, buffer_metadata.format), 0));
+    params.output.resize(HailoRTCommon::get_frame_size(shape, buffer_metadata.format));
+    return params;
+}
+
+static Expected<OpBenchmarkParams> create_yolov5_op()
+{
+    static const uint32_t ANCHORS_PER_LAYER = 3;
+    static const uint32_t ENTRY_SIZE = NUMBER_OF_CLASSES + 5; // x, y, w, h, objectness and classes
+    const std::map<std::string, std::pair<uint32_t, std::vector<int>>> layers = {
+        {"layer_8", {IMAGE_SIZE / 8, {10, 13, 16, 30, 33, 23}}},
+        {"layer_16", {IMAGE_SIZE / 16, {30, 61, 62, 45, 59, 119}}},
+        {"layer_32", {IMAGE_SIZE / 32, {116, 90, 156, 198, 373, 326}}},
+    };
+
+    std::unordered_map<std::string, BufferMetaData> inputs_metadata;
+    YoloPostProcessConfig yolo_config{};
+    yolo_config.image_height = static_cast<float32_t>(IMAGE_SIZE);
+    yolo_config.image_width = static_cast<float32_t>(IMAGE_SIZE);
+    for (const auto &layer : layers) {
+        const auto size = layer.second.first;
+        inputs_metadata.emplace(layer.first, create_buffer_metadata({size, size, ANCHORS_PER_LAYER * ENTRY_SIZE},
+            HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW, NMS_INPUT_QUANT_INFO));
+        yolo_config.anchors.emplace(layer.first, layer.second.second);
+    }
+
+    TRY(auto metadata, Yolov5OpMetadata::create(inputs_metadata, create_nms_outputs_metadata(), create_nms_config(),
+        yolo_config, NETWORK_NAME));
+    auto yolov5_metadata = std::dynamic_pointer_cast<Yolov5OpMetadata>(metadata);
+    TRY(auto op, YOLOv5PostProcessOp::create(yolov5_metadata));
+
+    OpBenchmarkParams params;
+    params.op = op;
+    for (const auto &input_metadata : inputs_metadata) {
+        params.inputs.emplace(input_metadata.first, create_input_buffer(input_metadata.second));
+    }
+    TRY(params.output, create_nms_output_buffer(*yolov5_metadata));
+    return params;
+}
+
+static Expected<OpBenchmarkParams> create_yolov8_op()
+{
+    static const uint32_t REGRESSION_FEATURES = 64; // 4 distances * 16 bins
+    const std::vector<uint32_t> strides = {8, 16, 32};
+
+    std::unordered_map<std::string, BufferMetaData> inputs_metadata;
+    Yolov8PostProcessConfig yolov8_config{};
+    yolov8_config.image_height = static_cast<float32_t>(IMAGE_SIZE);
+    yolov8_config.image_width = static_cast<float32_t>(IMAGE_SIZE);
+    for (const auto stride : strides) {
+        const auto size = IMAGE_SIZE / stride;
+        const auto reg_name = "reg_" + std::to_string(stride);
+        const auto cls_name = "cls_" + std::to_string(stride);
+        inputs_metadata.emplace(reg_name, create_buffer_metadata({size, size, REGRESSION_FEATURES},
+            HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW, NMS_INPUT_QUANT_INFO));
+        inputs_metadata.emplace(cls_name, create_buffer_metadata({size, size, NUMBER_OF_CLASSES},
+            HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW, NMS_INPUT_QUANT_INFO));
+        yolov8_config.reg_to_cls_inputs.emplace_back(Yolov8MatchingLayersNames{reg_name, cls_name, stride});
+    }
+
+    TRY(auto metadata, Yolov8OpMetadata::create(inputs_metadata, create_nms_outputs_metadata(), create_nms_config(),
+        yolov8_config, NETWORK_NAME));
+    auto yolov8_metadata = std::dynamic_pointer_cast<Yolov8OpMetadata>(metadata);
+    TRY(auto op, YOLOV8PostProcessOp::create(yolov8_metadata));
+
+    OpBenchmarkParams params;
+    params.op = op;
+    for (const auto &input_metadata : inputs_metadata) {
+        params.inputs.emplace(input_metadata.first, create_input_buffer(input_metadata.second));
+    }
+    TRY(params.output, create_nms_output_buffer(*yolov8_metadata));
+    return params;
+}
+
+static Expected<OpBenchmarkParams> create_yolox_op()
+{
+    static const uint32_t REGRESSION_FEATURES = 4;
+    const std::vector<uint32_t> strides = {8, 16, 32};
+
+    std::unordered_map<std::string, BufferMetaData> inputs_metadata;
+    YoloxPostProcessConfig yolox_config{};
+    yolox_config.image_height = static_cast<float32_t>(IMAGE_SIZE);
+    yolox_config.image_width = static_cast<float32_t>(IMAGE_SIZE);
+    for (const auto stride : strides) {
+        const auto size = IMAGE_SIZE / stride;
+        const auto reg_name = "reg_" + std::to_string(stride);
+        const auto obj_name = "obj_" + std::to_string(stride);
+        const auto cls_name = "cls_" + std::to_string(stride);
+        inputs_metadata.emplace(reg_name, create_buffer_metadata({size, size, REGRESSION_FEATURES},
+            HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW, NMS_INPUT_QUANT_INFO));
+        inputs_metadata.emplace(obj_name, create_buffer_metadata({size, size, 1},
+            HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW, NMS_INPUT_QUANT_INFO));
+        inputs_metadata.emplace(cls_name, create_buffer_metadata({size, size, NUMBER_OF_CLASSES},
+            HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW, NMS_INPUT_QUANT_INFO));
+        yolox_config.input_names.emplace_back(YoloxMatchingLayersNames{reg_name, obj_name, cls_name});
+    }
+
+    TRY(auto metadata, YoloxOpMetadata::create(inputs_metadata, create_nms_outputs_metadata(), create_nms_config(),
+        yolox_config, NETWORK_NAME));
+    auto yolox_metadata = std::dynamic_pointer_cast<YoloxOpMetadata>(metadata);
+    TRY(auto op, YOLOXPostProcessOp::create(yolox_metadata));
+
+    OpBenchmarkParams params;
+    params.op = op;
+    for (const auto &input_metadata : inputs_metadata) {
+        params.inputs.emplace(input_metadata.first, create_input_buffer(input_metadata.second));
+    }
+    TRY(params.output, create_nms_output_buffer(*yolox_metadata));
+    return params;
+}
+
+static void BM_argmax_op(benchmark::State &state)
+{
+    // {height, width, classes}
+    auto params = create_argmax_op({static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)),
+        static_cast<uint32_t>(state.range(2))});
+    run_op_benchmark(state, params);
+}
+BENCHMARK(BM_argmax_op)->Args({128, 128, 21})->Args({512, 512, 21});
+
+static void BM_softmax_op(benchmark::State &state)
+{
+    // {height, width, classes}
+    auto params = create_softmax_op({static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)),
+        static_cast<uint32_t>(state.range(2))});
+    run_op_benchmark(state, params);
+}
+BENCHMARK(BM_softmax_op)->Args({1, 1, 1000})->Args({32, 32, 100});
+
+static void BM_yolov5_op(benchmark::State &state)
+{
+    auto params = create_yolov5_op();
+    run_op_benchmark(state, params);
+}
+BENCHMARK(BM_yolov5_op)->Unit(benchmark::kMicrosecond);
+
+static void BM_yolov8_op(benchmark::State &state)
+{
+    auto params = create_yolov8_op();
+    run_op_benchmark(state, params);
+}
+BENCHMARK(BM_yolov8_op)->Unit(benchmark::kMicrosecond);
+
+static void BM_yolox_op(benchmark::State &state)
+{
+    auto params = create_yolox_op();
+    run_op_benchmark(state, params);
+}
+BENCHMARK(BM_yolox_op)->Unit(benchmark::kMicrosecond);
+
+} /* namespace net_flow */
+} /* namespace hailort */
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file post_process_plugin_benchmarks.cpp
+ * @brief Benchmarks of a post-process plugin running on the device buffers, compared to running the same processing
+ *        from the user's callback (on copies of the outputs)
+ **/
+
+#include "hailo/post_process_plugin.hpp"
+#include "common/utils.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <random>
+
+
+namespace hailort
+{
+
+static const std::string OUTPUT_NAME = "output";
+static const uint32_t HEIGHT = 160;
+static const uint32_t WIDTH = 160;
+static const uint32_t FEATURES = 32;
+static const hailo_quant_info_t QUANT_INFO = {128.0f, 1.0f / 32.0f, 0.0f, 255.0f};
+
+// Per pixel argmax + de-quantized score over the features of a single NHWC uint8 input (segmentation/keypoints like)
+class ArgmaxScorePlugin final : public PostProcessPlugin
+{
+public:
+    ArgmaxScorePlugin(const std::string &input_name) : m_input_name(input_name), m_input_info() {}
+
+    virtual std::string name() const override { return "argmax_score"; }
+    virtual std::vector<std::string> input_names() const override { return {m_input_name}; }
+
+    virtual Expected<size_t> configure(const std::map<std::string, PostProcessPluginInputInfo> &inputs_info) override
+    {
+        m_input_info = inputs_info.at(m_input_name);
+        // uint8 class + float32 score per pixel
+        return static_cast<size_t>(m_input_info.shape.height) * m_input_info.shape.width * (sizeof(uint8_t) + sizeof(float32_t));
+    }
+
+    virtual hailo_status execute(const std::map<std::string, MemoryView> &inputs, MemoryView output) override
+    {
+        const auto &input = inputs.at(m_input_name);
+        const auto pixels_count = static_cast<size_t>(m_input_info.shape.height) * m_input_info.shape.width;
+        const auto features = m_input_info.hw_shape.features;
+        auto classes = output.data();
+        auto scores = reinterpret_cast<float32_t*>(output.data() + pixels_count);
+        for (size_t pixel = 0; pixel < pixels_count; pixel++) {
+            const auto pixel_data = input.data() + (pixel * features);
+            uint8_t max_index = 0;
+            for (uint8_t feature = 1; feature < m_input_info.shape.features; feature++) {
+                if (pixel_data[feature] > pixel_data[max_index]) {
+                    max_index = feature;
+                }
+            }
+            classes[pixel] = max_index;
+            scores[pixel] = (static_cast<float32_t>(pixel_data[max_index]) - m_input_info.quant_info.qp_zp) *
+                m_input_info.quant_info.qp_scale;
+        }
+        return HAILO_SUCCESS;
+    }
+
+private:
+    std::string m_input_name;
+    PostProcessPluginInputInfo m_input_info;
+};
+
+struct PluginBenchmarkParams
+{
+    std::shared_ptr<ArgmaxScorePlugin> plugin;
+    // Stands for the device buffer (the pipeline's hw-interacting pool)
+    std::vector<uint8_t> device_buffer;
+    std::vector<uint8_t> output;
+};
+
+static Expected<PluginBenchmarkParams> create_plugin_benchmark_params()
+{
+    PostProcessPluginInputInfo input_info{};
+    input_info.stream_name = OUTPUT_NAME;
+    input_info.shape = {HEIGHT, WIDTH, FEATURES};
+    input_info.hw_shape = input_info.shape;
+    input_info.format = {HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_FLAGS_NONE};
+    input_info.quant_info = QUANT_INFO;
+    input_info.frame_size = static_cast<size_t>(HEIGHT) * WIDTH * FEATURES;
+
+    PluginBenchmarkParams params{};
+    params.plugin = std::make_shared<ArgmaxScorePlugin>(OUTPUT_NAME);
+    TRY(const auto output_frame_size, params.plugin->configure({{OUTPUT_NAME, input_info}}));
+
+    // Fixed seed, so every run processes the same data
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<uint32_t> distribution(0, UINT8_MAX);
+    params.device_buffer.resize(input_info.frame_size);
+    for (auto &byte : params.device_buffer) {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+    params.output.resize(output_frame_size);
+    return params;
+}
+
+// The plugin runs inside the pipeline, on a view of the device buffer, writing directly into the bound output buffer
+static void BM_post_process_plugin_in_pipeline(benchmark::State &state)
+{
+    auto params = create_plugin_benchmark_params();
+    if (!params) {
+        state.SkipWithError("Failed creating plugin");
+        return;
+    }
+
+    for (auto _ : state) {
+        const std::map<std::string, MemoryView> inputs = {
+            {OUTPUT_NAME, MemoryView(params->device_buffer.data(), params->device_buffer.size())}};
+        auto status = params->plugin->execute(inputs, MemoryView(params->output.data(), params->output.size()));
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Plugin execute failed");
+            return;
+        }
+        benchmark::DoNotOptimize(params->output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * params->device_buffer.size()));
+}
+BENCHMARK(BM_post_process_plugin_in_pipeline);
+
+// The same processing done from the user's callback - the raw output is bound as a user buffer, and is copied out
+// before the processing, so the bound buffer can be reused for the next frame.
+static void BM_post_process_plugin_in_callback(benchmark::State &state)
+{
+    auto params = create_plugin_benchmark_params();
+    if (!params) {
+        state.SkipWithError("Failed creating plugin");
+        return;
+    }
+    std::vector<uint8_t> user_copy(params->device_buffer.size());
+
+    for (auto _ : state) {
+        std::memcpy(user_copy.data(), params->device_buffer.data(), params->device_buffer.size());
+        const std::map<std::string, MemoryView> inputs = {{OUTPUT_NAME, MemoryView(user_copy.data(), user_copy.size())}};
+        auto status = params->plugin->execute(inputs, MemoryView(params->output.data(), params->output.size()));
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Plugin execute failed");
+            return;
+        }
+        benchmark::DoNotOptimize(params->output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * params->device_buffer.size()));
+}
+BENCHMARK(BM_post_process_plugin_in_callback);
+
+} /* namespace hailort */
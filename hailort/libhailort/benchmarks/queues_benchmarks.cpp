@@ -0,0 +1,558 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file queues_benchmarks.cpp
+ * @brief Benchmarks of the pipeline buffer pools, queues, statistics accumulators, callback reorder queue, infer
+ *        admission queue, vdma completion executor and Buffer allocations
+ **/
+
+#include "net_flow/pipeline/pipeline.hpp"
+#include "common/thread_safe_queue.hpp"
+#include "common/runtime_statistics_internal.hpp"
+#include "vdevice/scheduler/infer_request_accumulator.hpp"
+#include "vdevice/callback_reorder_queue.hpp"
+#include "net_flow/pipeline/infer_admission_queue.hpp"
+#include "vdma/channel/completion_executor.hpp"
+#include "utils/buffer_storage.hpp"
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+#include <random>
+#include <thread>
+
+
+// The global operator new is replaced for the whole benchmarks executable, so a benchmark can count the heap
+// allocations of its thread while t_count_allocations is set
+static thread_local bool t_count_allocations = false;
+static thread_local size_t t_allocations_count = 0;
+
+void *operator new(std::size_t size)
+{
+    if (t_count_allocations) {
+        t_allocations_count++;
+    }
+    void *ptr = std::malloc((0 == size) ? 1 : size);
+    if (nullptr == ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    if (t_count_allocations) {
+        t_allocations_count++;
+    }
+    return std::malloc((0 == size) ? 1 : size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    std::free(ptr);
+}
+
+namespace hailort
+{
+
+static const std::chrono::milliseconds BENCHMARK_TIMEOUT(1000);
+
+static void BM_buffer_pool_acquire_release(benchmark::State &state)
+{
+    const auto buffer_size = static_cast<size_t>(state.range(0));
+    const size_t BUFFERS_COUNT = 4;
+
+    auto shutdown_event = Event::create_shared(Event::State::not_signalled);
+    if (!shutdown_event) {
+        state.SkipWithError("Failed creating shutdown event");
+        return;
+    }
+    auto pool = BufferPool::create(buffer_size, BUFFERS_COUNT, shutdown_event.release(), HAILO_PIPELINE_ELEM_STATS_NONE,
+        HAILO_VSTREAM_STATS_NONE);
+    if (!pool) {
+        state.SkipWithError("Failed creating buffer pool");
+        return;
+    }
+
+    for (auto _ : state) {
+        // The buffer returns to the pool when it is destroyed
+        auto buffer = pool.value()->acquire_buffer(BENCHMARK_TIMEOUT);
+        if (!buffer) {
+            state.SkipWithError("Failed acquiring buffer");
+            return;
+        }
+        benchmark::DoNotOptimize(buffer->data());
+    }
+}
+BENCHMARK(BM_buffer_pool_acquire_release)->Arg(1024)->Arg(640 * 640 * 3);
+
+static void BM_spsc_queue_enqueue_dequeue(benchmark::State &state)
+{
+    auto shutdown_event = Event::create_shared(Event::State::not_signalled);
+    if (!shutdown_event) {
+        state.SkipWithError("Failed creating shutdown event");
+        return;
+    }
+    auto queue = SpscQueue<uint64_t>::create(static_cast<size_t>(state.range(0)), shutdown_event.release(),
+        BENCHMARK_TIMEOUT);
+    if (!queue) {
+        state.SkipWithError("Failed creating queue");
+        return;
+    }
+
+    uint64_t value = 0;
+    for (auto _ : state) {
+        auto status = queue->enqueue(value++);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Failed enqueueing");
+            return;
+        }
+        auto dequeued = queue->dequeue();
+        if (!dequeued) {
+            state.SkipWithError("Failed dequeueing");
+            return;
+        }
+        benchmark::DoNotOptimize(dequeued.value());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_spsc_queue_enqueue_dequeue)->Arg(4)->Arg(64);
+
+static void BM_safe_queue_enqueue_dequeue(benchmark::State &state)
+{
+    SafeQueue<uint64_t> queue(static_cast<size_t>(state.range(0)));
+
+    uint64_t value = 0;
+    for (auto _ : state) {
+        auto status = queue.enqueue(value++);
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Failed enqueueing");
+            return;
+        }
+        auto dequeued = queue.dequeue();
+        if (!dequeued) {
+            state.SkipWithError("Failed dequeueing");
+            return;
+        }
+        benchmark::DoNotOptimize(dequeued.value());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_safe_queue_enqueue_dequeue)->Arg(4)->Arg(64);
+
+static void BM_full_accumulator_add_data_point(benchmark::State &state)
+{
+    // Shared between the benchmark threads, to measure the lock contention
+    static FullAccumulator<double> accumulator("benchmark");
+
+    double data_point = 0;
+    for (auto _ : state) {
+        accumulator.add_data_point(data_point);
+        data_point += 1.0;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_full_accumulator_add_data_point)->ThreadRange(1, 4);
+
+static void BM_full_accumulator_get(benchmark::State &state)
+{
+    FullAccumulator<double> accumulator("benchmark");
+    for (int64_t i = 0; i < state.range(0); i++) {
+        accumulator.add_data_point(static_cast<double>(i));
+    }
+
+    for (auto _ : state) {
+        auto info = accumulator.get();
+        // AccumulatorResults has const members, so it can't be passed to DoNotOptimize itself
+        auto count = info.count();
+        benchmark::DoNotOptimize(count ? count.value() : 0);
+    }
+}
+BENCHMARK(BM_full_accumulator_get)->Arg(1000);
+
+static void BM_infer_request_accumulator_frame(benchmark::State &state)
+{
+    // Accumulates a full frame (a transfer for each stream) per iteration
+    const auto streams_count = static_cast<stream_index_t>(state.range(0));
+    const size_t MAX_QUEUE_SIZE = 4;
+    // Accumulated frames are dropped - the scheduler side is out of the benchmark scope
+    InferRequestAccumulator accumulator(streams_count, MAX_QUEUE_SIZE, [](InferRequest &&) {});
+
+    std::vector<uint8_t> buffer(1024);
+    // Only the allocations of the accumulator itself are counted (and not the ones of the TransferRequests)
+    size_t accumulator_allocations_count = 0;
+    for (auto _ : state) {
+        for (stream_index_t stream_index = 0; stream_index < streams_count; stream_index++) {
+            TransferRequest request{MemoryView(buffer.data(), buffer.size()), [](hailo_status) {}};
+            t_allocations_count = 0;
+            t_count_allocations = true;
+            auto status = accumulator.add_transfer_request(stream_index, std::move(request));
+            t_count_allocations = false;
+            accumulator_allocations_count += t_allocations_count;
+            if (HAILO_SUCCESS != status) {
+                state.SkipWithError("Failed adding transfer request");
+                return;
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.counters["allocations_per_frame"] =
+        static_cast<double>(accumulator_allocations_count) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_infer_request_accumulator_frame)->Arg(2)->Arg(8)->Arg(16);
+
+// Counts the requests completed by an InferAdmissionQueue, per completion status
+class AdmissionCompletions final
+{
+public:
+    void complete(hailo_status status)
+    {
+        // Notified under the lock, since the waiter destroys this object once it wakes up
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_counts[status]++;
+        m_cv.notify_all();
+    }
+
+    // Returns false on timeout
+    bool wait_for_total(size_t total)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_cv.wait_for(lock, BENCHMARK_TIMEOUT, [this, total]() { return total_locked() >= total; });
+    }
+
+    size_t count(hailo_status status)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_counts[status];
+    }
+
+private:
+    size_t total_locked() const
+    {
+        size_t total = 0;
+        for (const auto &count : m_counts) {
+            total += count.second;
+        }
+        return total;
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::map<hailo_status, size_t> m_counts;
+};
+
+static InferAdmissionQueue::Request make_admission_request(AdmissionCompletions &completions,
+    InferAdmissionQueue::Clock::time_point deadline)
+{
+    InferAdmissionQueue::Request request{};
+    request.deadline = deadline;
+    request.launch = [&completions]() {
+        completions.complete(HAILO_SUCCESS);
+        return HAILO_SUCCESS;
+    };
+    request.drop = [&completions](hailo_status status) { completions.complete(status); };
+    return request;
+}
+
+// Each iteration overloads a queue whose pipeline never has room - the requests above the watermark must be shed,
+// and the waiting ones dropped by stop(). Fails if a request is lost or completed with the wrong status.
+static void BM_infer_admission_queue_shedding(benchmark::State &state)
+{
+    InferAdmissionParams params{};
+    params.watermark = static_cast<size_t>(state.range(0));
+    params.shedding_policy = InferSheddingPolicy::DROP_OLDEST;
+    const size_t REQUESTS_COUNT = params.watermark * 4;
+
+    for (auto _ : state) {
+        AdmissionCompletions completions;
+        auto queue = InferAdmissionQueue::create(params, []() { return false; });
+        if (!queue) {
+            state.SkipWithError("Failed creating admission queue");
+            return;
+        }
+        for (size_t i = 0; i < REQUESTS_COUNT; i++) {
+            queue.value()->enqueue(make_admission_request(completions, InferAdmissionQueue::Clock::time_point::max()));
+        }
+
+        const auto shed_count = REQUESTS_COUNT - params.watermark;
+        if (!completions.wait_for_total(shed_count)) {
+            state.SkipWithError("Shed requests were not completed");
+            return;
+        }
+        const auto stats = queue.value()->get_stats();
+        if ((shed_count != stats.shed) || (params.watermark != stats.pending) || (params.watermark != stats.max_pending)) {
+            state.SkipWithError("Unexpected admission stats");
+            return;
+        }
+
+        queue.value()->stop();
+        if ((REQUESTS_COUNT != completions.count(HAILO_REQUEST_DROPPED)) || (0 != completions.count(HAILO_SUCCESS))) {
+            state.SkipWithError("Not all requests were dropped");
+            return;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * REQUESTS_COUNT));
+}
+BENCHMARK(BM_infer_admission_queue_shedding)->Arg(1)->Arg(4)->UseRealTime();
+
+// Each iteration queues requests with a short deadline to a queue whose pipeline never has room - all of them must
+// expire. Fails if a request is completed with another status.
+static void BM_infer_admission_queue_deadline(benchmark::State &state)
+{
+    InferAdmissionParams params{};
+    params.watermark = static_cast<size_t>(state.range(0));
+    const auto DEADLINE = std::chrono::milliseconds(1);
+
+    for (auto _ : state) {
+        AdmissionCompletions completions;
+        auto queue = InferAdmissionQueue::create(params, []() { return false; });
+        if (!queue) {
+            state.SkipWithError("Failed creating admission queue");
+            return;
+        }
+        const auto deadline = InferAdmissionQueue::Clock::now() + DEADLINE;
+        for (size_t i = 0; i < params.watermark; i++) {
+            queue.value()->enqueue(make_admission_request(completions, deadline));
+        }
+
+        if (!completions.wait_for_total(params.watermark)) {
+            state.SkipWithError("Expired requests were not completed");
+            return;
+        }
+        const auto stats = queue.value()->get_stats();
+        if ((params.watermark != completions.count(HAILO_DEADLINE_EXPIRED)) || (params.watermark != stats.expired) ||
+            (0 != stats.pending)) {
+            state.SkipWithError("Not all requests expired");
+            return;
+        }
+        queue.value()->stop();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_infer_admission_queue_deadline)->Arg(1)->Arg(4)->UseRealTime();
+
+// Each iteration stops the queue and releases its last external reference from a request callback, as
+// ConfiguredInferModel does when admission control is disabled from a callback. Aborts if the dispatcher joins itself.
+static void BM_infer_admission_queue_stop_from_callback(benchmark::State &state)
+{
+    for (auto _ : state) {
+        AdmissionCompletions completions;
+        auto queue = InferAdmissionQueue::create(InferAdmissionParams{}, []() { return true; });
+        if (!queue) {
+            state.SkipWithError("Failed creating admission queue");
+            return;
+        }
+        auto queue_ptr = queue.release();
+
+        auto request = make_admission_request(completions, InferAdmissionQueue::Clock::time_point::max());
+        request.launch = [&completions, &queue_ptr]() {
+            auto last_ref = std::move(queue_ptr);
+            last_ref->stop();
+            completions.complete(HAILO_SUCCESS);
+            return HAILO_SUCCESS;
+        };
+        // queue_ptr is moved from inside the callback, so the queue is referenced through a copy
+        auto enqueuing_ref = queue_ptr;
+        enqueuing_ref->enqueue(std::move(request));
+        enqueuing_ref.reset();
+
+        if (!completions.wait_for_total(1)) {
+            state.SkipWithError("Request was not launched");
+            return;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_infer_admission_queue_stop_from_callback)->UseRealTime();
+
+static void BM_completion_executor_enqueue(benchmark::State &state)
+{
+    // Completions of several channels (ordering keys), as enqueued by the interrupts thread
+    const auto threads_count = static_cast<size_t>(state.range(0));
+    const size_t ORDERING_KEYS_COUNT = 8;
+    auto executor = vdma::CompletionExecutor::create(threads_count, "benchmark");
+    if (!executor) {
+        state.SkipWithError("Failed creating completion executor");
+        return;
+    }
+
+    std::atomic<uint64_t> executed_count(0);
+    size_t ordering_key = 0;
+    for (auto _ : state) {
+        executor.value()->enqueue(ordering_key, [&executed_count]() { executed_count++; });
+        ordering_key = (ordering_key + 1) % ORDERING_KEYS_COUNT;
+    }
+    for (size_t key = 0; key < ORDERING_KEYS_COUNT; key++) {
+        executor.value()->flush(key);
+    }
+    if (executed_count.load() != static_cast<uint64_t>(state.iterations())) {
+        state.SkipWithError("Not all completions were executed");
+        return;
+    }
+
+    state.counters["max_queue_depth"] = static_cast<double>(executor.value()->get_stats().max_queue_depth);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_completion_executor_enqueue)->Arg(0)->Arg(1)->Arg(4)->UseRealTime();
+
+// Flushing a channel while another channel of the same worker keeps enqueueing slow completions (as when a stream is
+// aborted while the other streams are running) - flush must wait only for the flushed channel's completions.
+static void BM_completion_executor_flush_busy_worker(benchmark::State &state)
+{
+    const size_t FLUSHED_KEY = 0;
+    const size_t BUSY_KEY = 1;
+    const auto SLOW_COMPLETION_TIME = std::chrono::microseconds(200);
+    const size_t THREADS_COUNT = 1;
+    auto executor = vdma::CompletionExecutor::create(THREADS_COUNT, "benchmark");
+    if (!executor) {
+        state.SkipWithError("Failed creating completion executor");
+        return;
+    }
+
+    std::atomic<uint64_t> flushed_executed_count(0);
+    uint64_t flushed_enqueued_count = 0;
+    for (auto _ : state) {
+        executor.value()->enqueue(FLUSHED_KEY, [&flushed_executed_count]() { flushed_executed_count++; });
+        flushed_enqueued_count++;
+        executor.value()->enqueue(BUSY_KEY, [SLOW_COMPLETION_TIME]() {
+            std::this_thread::sleep_for(SLOW_COMPLETION_TIME);
+        });
+
+        executor.value()->flush(FLUSHED_KEY);
+        if (flushed_executed_count.load() != flushed_enqueued_count) {
+            state.SkipWithError("flush returned before the channel's completions were executed");
+            return;
+        }
+    }
+    executor.value()->flush(BUSY_KEY);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_completion_executor_flush_busy_worker)->UseRealTime();
+
+static void BM_callback_reorder_queue_in_order(benchmark::State &state)
+{
+    // Single device - the callbacks are done in order, so each one is called right away
+    const size_t MAX_QUEUE_SIZE = 4;
+    CallbackReorderQueue queue(MAX_QUEUE_SIZE);
+
+    uint64_t called_callbacks = 0;
+    TransferDoneCallback original = [&called_callbacks](hailo_status) { called_callbacks++; };
+    for (auto _ : state) {
+        auto callback = queue.wrap_callback(original);
+        if (!callback) {
+            state.SkipWithError("Failed wrapping callback");
+            return;
+        }
+        callback.value()(HAILO_SUCCESS);
+    }
+    if (called_callbacks != static_cast<uint64_t>(state.iterations())) {
+        state.SkipWithError("Not all callbacks were called");
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_callback_reorder_queue_in_order);
+
+// Stress of the reorder queue - each iteration wraps a full queue of callbacks (and cancels one more), then the
+// callbacks are done in a random order by several threads. Fails if some callback isn't called in order.
+static void BM_callback_reorder_queue_random_order(benchmark::State &state)
+{
+    const auto threads_count = static_cast<size_t>(state.range(0));
+    const size_t MAX_QUEUE_SIZE = 64;
+    CallbackReorderQueue queue(MAX_QUEUE_SIZE);
+    std::mt19937 random_engine(std::random_device{}());
+
+    // The callbacks are called one at a time, so the counters don't have to be atomic
+    uint64_t called_callbacks = 0;
+    bool is_out_of_order = false;
+
+    std::vector<TransferDoneCallback> callbacks(MAX_QUEUE_SIZE);
+    std::vector<size_t> done_order(MAX_QUEUE_SIZE);
+    uint64_t registered_callbacks = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < MAX_QUEUE_SIZE; i++) {
+            const auto expected_index = registered_callbacks++;
+            auto callback = queue.wrap_callback([&called_callbacks, &is_out_of_order, expected_index](hailo_status) {
+                is_out_of_order |= (called_callbacks++ != expected_index);
+            });
+            if (!callback) {
+                state.SkipWithError("Failed wrapping callback");
+                return;
+            }
+            callbacks[i] = callback.release();
+            done_order[i] = i;
+        }
+
+        auto cancelled_callback = queue.wrap_callback([&is_out_of_order](hailo_status) { is_out_of_order = true; });
+        if (!cancelled_callback) {
+            state.SkipWithError("Failed wrapping callback");
+            return;
+        }
+        queue.cancel_last_callback();
+
+        std::shuffle(done_order.begin(), done_order.end(), random_engine);
+        std::vector<std::thread> threads;
+        threads.reserve(threads_count);
+        for (size_t thread_index = 0; thread_index < threads_count; thread_index++) {
+            threads.emplace_back([&, thread_index]() {
+                for (size_t i = thread_index; i < done_order.size(); i += threads_count) {
+                    callbacks[done_order[i]](HAILO_SUCCESS);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    if (is_out_of_order || (called_callbacks != registered_callbacks)) {
+        state.SkipWithError("Callbacks were not called in order");
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(called_callbacks));
+}
+BENCHMARK(BM_callback_reorder_queue_random_order)->Arg(1)->Arg(4)->UseRealTime();
+
+template<bool POOLED>
+static void BM_buffer_create(benchmark::State &state)
+{
+    const auto buffer_size = static_cast<size_t>(state.range(0));
+    const auto params = POOLED ? PooledHeapStorage::create_params() : BufferStorageParams();
+
+    const auto stats_before = PooledHeapStorage::get_slab_stats();
+    for (auto _ : state) {
+        auto buffer = Buffer::create(buffer_size, params);
+        if (!buffer) {
+            state.SkipWithError("Failed creating buffer");
+            return;
+        }
+        benchmark::DoNotOptimize(buffer->data());
+    }
+    const auto stats_after = PooledHeapStorage::get_slab_stats();
+
+    const auto hits = static_cast<double>(stats_after.hits - stats_before.hits);
+    const auto misses = static_cast<double>(stats_after.misses - stats_before.misses);
+    state.counters["slab_hit_rate"] = ((hits + misses) > 0) ? (hits / (hits + misses)) : 0;
+    state.counters["slab_cached_bytes"] = static_cast<double>(stats_after.cached_bytes);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK_TEMPLATE(BM_buffer_create, false)->Arg(64 * 1024)->Arg(640 * 640 * 3)->ThreadRange(1, 4);
+BENCHMARK_TEMPLATE(BM_buffer_create, true)->Arg(64 * 1024)->Arg(640 * 640 * 3)->ThreadRange(1, 4);
+
+} /* namespace hailort */
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file scheduler_oracle_benchmarks.cpp
+ * @brief Benchmarks of the scheduler oracle decisions, over a synthetic scheduler state
+ **/
+
+#include "vdevice/scheduler/scheduler_oracle.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+namespace hailort
+{
+
+// Scheduler with a fixed state - only every READY_CORE_OPS_RATIO'th core op is ready, so the oracle has to scan the
+// priority groups before reaching a decision.
+class BenchmarkScheduler final : public SchedulerBase
+{
+public:
+    static const uint32_t READY_CORE_OPS_RATIO = 4;
+    static const core_op_priority_t PRIORITIES_COUNT = 4;
+
+    BenchmarkScheduler(std::vector<std::string> &devices_ids, std::vector<std::string> &devices_arch,
+        uint32_t core_ops_count) :
+        SchedulerBase(HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN, devices_ids, devices_arch)
+    {
+        for (scheduler_core_op_handle_t handle = 0; handle < core_ops_count; handle++) {
+            m_core_op_priority[static_cast<core_op_priority_t>(handle % PRIORITIES_COUNT)].add(handle);
+        }
+    }
+
+    virtual ReadyInfo is_core_op_ready(const scheduler_core_op_handle_t &core_op_handle, bool check_threshold,
+        const device_id_t &/*device_id*/) override
+    {
+        ReadyInfo result;
+        result.is_ready = (0 == (core_op_handle % READY_CORE_OPS_RATIO));
+        result.over_threshold = result.is_ready && check_threshold;
+        return result;
+    }
+
+    // Undo the oracle's decisions, so every iteration starts from the same state
+    void reset_devices()
+    {
+        for (auto &device_info : m_devices) {
+            device_info.second->is_switching_core_op = false;
+            device_info.second->next_core_op_handle = INVALID_CORE_OP_HANDLE;
+        }
+    }
+};
+
+static void BM_oracle_decisions(benchmark::State &state)
+{
+    // {devices count, core ops count}
+    std::vector<std::string> devices_ids;
+    std::vector<std::string> devices_arch;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        devices_ids.emplace_back("0000:0" + std::to_string(i) + ":00.0");
+        devices_arch.emplace_back("HAILO8");
+    }
+    BenchmarkScheduler scheduler(devices_ids, devices_arch, static_cast<uint32_t>(state.range(1)));
+
+    for (auto _ : state) {
+        auto decisions = CoreOpsSchedulerOracle::get_oracle_decisions(scheduler);
+        benchmark::DoNotOptimize(decisions.data());
+        scheduler.reset_devices();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_oracle_decisions)->Args({1, 4})->Args({1, 64})->Args({4, 16})->Args({4, 64});
+
+static void BM_oracle_should_stop_streaming(benchmark::State &state)
+{
+    // {devices count, core ops count}
+    std::vector<std::string> devices_ids;
+    std::vector<std::string> devices_arch;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        devices_ids.emplace_back("0000:0" + std::to_string(i) + ":00.0");
+        devices_arch.emplace_back("HAILO8");
+    }
+    BenchmarkScheduler scheduler(devices_ids, devices_arch, static_cast<uint32_t>(state.range(1)));
+
+    const core_op_priority_t LOWEST_PRIORITY = 0;
+    for (auto _ : state) {
+        auto should_stop = CoreOpsSchedulerOracle::should_stop_streaming(scheduler, LOWEST_PRIORITY, devices_ids[0]);
+        benchmark::DoNotOptimize(should_stop);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_oracle_should_stop_streaming)->Args({1, 4})->Args({4, 64});
+
+} /* namespace hailort */
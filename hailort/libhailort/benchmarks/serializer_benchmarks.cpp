@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file serializer_benchmarks.cpp
+ * @brief Benchmarks of the hrpc serializers round trips (serialize + deserialize)
+ **/
+
+#include "hrpc_protocol/serializer.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+namespace hailort
+{
+
+static void BM_run_async_request_round_trip(benchmark::State &state)
+{
+    RunAsyncSerializer::Request request{};
+    request.configured_infer_model_handle = 1;
+    request.infer_model_handle = 2;
+    request.callback_handle = 3;
+    request.input_buffer_sizes.assign(static_cast<size_t>(state.range(0)), 640 * 640 * 3);
+
+    for (auto _ : state) {
+        auto serialized = RunAsyncSerializer::serialize_request(request);
+        if (!serialized) {
+            state.SkipWithError("Failed serializing request");
+            return;
+        }
+        auto deserialized = RunAsyncSerializer::deserialize_request(MemoryView(*serialized));
+        if (!deserialized) {
+            state.SkipWithError("Failed deserializing request");
+            return;
+        }
+        benchmark::DoNotOptimize(deserialized->callback_handle);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_run_async_request_round_trip)->Arg(1)->Arg(8);
+
+static void BM_callback_called_reply_round_trip(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto serialized = CallbackCalledSerializer::serialize_reply(HAILO_SUCCESS, 1, 2);
+        if (!serialized) {
+            state.SkipWithError("Failed serializing reply");
+            return;
+        }
+        auto deserialized = CallbackCalledSerializer::deserialize_reply(MemoryView(*serialized));
+        if (!deserialized) {
+            state.SkipWithError("Failed deserializing reply");
+            return;
+        }
+        benchmark::DoNotOptimize(std::get<1>(deserialized.value()));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_callback_called_reply_round_trip);
+
+static void BM_create_configured_infer_model_request_round_trip(benchmark::State &state)
+{
+    rpc_create_configured_infer_model_request_params_t params{};
+    params.infer_model_handle = 1;
+    params.vdevice_handle = 2;
+    params.batch_size = 1;
+    params.power_mode = HAILO_POWER_MODE_PERFORMANCE;
+    params.latency_flag = HAILO_LATENCY_NONE;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        rpc_stream_params_t stream_params{};
+        stream_params.format_order = HAILO_FORMAT_ORDER_NHWC;
+        stream_params.format_type = HAILO_FORMAT_TYPE_UINT8;
+        params.input_streams_params.emplace("input_" + std::to_string(i), stream_params);
+        params.output_streams_params.emplace("output_" + std::to_string(i), stream_params);
+    }
+
+    for (auto _ : state) {
+        auto serialized = CreateConfiguredInferModelSerializer::serialize_request(params);
+        if (!serialized) {
+            state.SkipWithError("Failed serializing request");
+            return;
+        }
+        auto deserialized = CreateConfiguredInferModelSerializer::deserialize_request(MemoryView(*serialized));
+        if (!deserialized) {
+            state.SkipWithError("Failed deserializing request");
+            return;
+        }
+        benchmark::DoNotOptimize(deserialized->batch_size);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_create_configured_infer_model_request_round_trip)->Arg(1)->Arg(16);
+
+} /* namespace hailort */
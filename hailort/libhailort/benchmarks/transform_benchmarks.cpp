@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file transform_benchmarks.cpp
+ * @brief Benchmarks of the host-side input/output transformations
+ **/
+
+#include "hailo/transform.hpp"
+#include "hailo/hailort_common.hpp"
+#include "transform/transform_internal.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+
+namespace hailort
+{
+
+static const hailo_quant_info_t QUANT_INFO = {0.0f, 1.0f, 0.0f, 255.0f};
+
+// Shapes are passed as benchmark args - {height, width, features}
+static hailo_3d_image_shape_t get_shape(const benchmark::State &state)
+{
+    return hailo_3d_image_shape_t{static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)),
+        static_cast<uint32_t>(state.range(2))};
+}
+
+static void shapes_args(benchmark::internal::Benchmark *bench)
+{
+    bench->Args({224, 224, 3});
+    bench->Args({640, 640, 3});
+    bench->Args({80, 80, 64});
+    bench->Args({1, 1, 1000});
+}
+
+template<hailo_format_type_t SRC_TYPE, hailo_format_order_t SRC_ORDER, hailo_format_order_t DST_ORDER>
+static void BM_input_transform(benchmark::State &state)
+{
+    const auto shape = get_shape(state);
+    const hailo_format_t src_format = {SRC_TYPE, SRC_ORDER, HAILO_FORMAT_FLAGS_NONE};
+    const hailo_format_t dst_format = {HAILO_FORMAT_TYPE_UINT8, DST_ORDER, HAILO_FORMAT_FLAGS_NONE};
+
+    auto context = InputTransformContext::create(shape, src_format, shape, dst_format, {QUANT_INFO});
+    if (!context) {
+        state.SkipWithError("Failed creating InputTransformContext");
+        return;
+    }
+
+    std::vector<uint8_t> src(context.value()->get_src_frame_size());
+    std::vector<uint8_t> dst(context.value()->get_dst_frame_size());
+    for (auto _ : state) {
+        auto status = context.value()->transform(MemoryView(src.data(), src.size()), MemoryView(dst.data(), dst.size()));
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Input transform failed");
+            return;
+        }
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.size()));
+}
+
+template<hailo_format_type_t DST_TYPE, hailo_format_order_t SRC_ORDER, hailo_format_order_t DST_ORDER>
+static void BM_output_transform(benchmark::State &state)
+{
+    const auto shape = get_shape(state);
+    const hailo_format_t src_format = {HAILO_FORMAT_TYPE_UINT8, SRC_ORDER, HAILO_FORMAT_FLAGS_NONE};
+    const hailo_format_t dst_format = {DST_TYPE, DST_ORDER, HAILO_FORMAT_FLAGS_NONE};
+
+    auto context = OutputTransformContext::create(shape, src_format, shape, dst_format, {QUANT_INFO}, hailo_nms_info_t{});
+    if (!context) {
+        state.SkipWithError("Failed creating OutputTransformContext");
+        return;
+    }
+
+    std::vector<uint8_t> src(context.value()->get_src_frame_size());
+    std::vector<uint8_t> dst(context.value()->get_dst_frame_size());
+    for (auto _ : state) {
+        auto status = context.value()->transform(MemoryView(src.data(), src.size()), MemoryView(dst.data(), dst.size()));
+        if (HAILO_SUCCESS != status) {
+            state.SkipWithError("Output transform failed");
+            return;
+        }
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.size()));
+}
+
+// Reorder only
+BENCHMARK_TEMPLATE(BM_input_transform, HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_ORDER_NHCW)
+    ->Apply(shapes_args);
+BENCHMARK_TEMPLATE(BM_input_transform, HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_ORDER_NHWC)
+    ->Apply(shapes_args);
+// Quantize + reorder
+BENCHMARK_TEMPLATE(BM_input_transform, HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_ORDER_NHCW)
+    ->Apply(shapes_args);
+
+// Reorder only
+BENCHMARK_TEMPLATE(BM_output_transform, HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW, HAILO_FORMAT_ORDER_NHWC)
+    ->Apply(shapes_args);
+// De-quantize + reorder
+BENCHMARK_TEMPLATE(BM_output_transform, HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHCW, HAILO_FORMAT_ORDER_NHWC)
+    ->Apply(shapes_args);
+BENCHMARK_TEMPLATE(BM_output_transform, HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_ORDER_NHWC)
+    ->Apply(shapes_args);
+
+// Specialized reorder kernels - every specialization is generated and compared to the generic reorder before it is
+// measured, the benchmark fails if the outputs differ.
+struct ReorderKernelCase
+{
+    std::string name;
+    hailo_stream_direction_t direction;
+    hailo_3d_image_shape_t src_shape;
+    hailo_format_t src_format;
+    hailo_3d_image_shape_t dst_shape;
+    hailo_format_t dst_format;
+};
+
+static std::vector<ReorderKernelCase> generate_reorder_kernel_cases()
+{
+    static const uint32_t HEIGHT = 80;
+    static const uint32_t WIDTH = 78;
+    static const uint32_t PADDED_WIDTH = 80;
+
+    std::vector<ReorderKernelCase> cases;
+    for (const auto type : {HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_TYPE_UINT16}) {
+        for (const auto features : TransformKernels::specialized_features()) {
+            const uint32_t padded_features = features + (8 - (features % 8));
+            for (const auto has_padding : {false, true}) {
+                const auto name_suffix = std::string("/") + HailoRTCommon::get_format_type_str(type) + "/" +
+                    std::to_string(features) + (has_padding ? "/padded" : "");
+                const hailo_3d_image_shape_t shape = {HEIGHT, WIDTH, features};
+                const hailo_3d_image_shape_t width_padded_shape = {HEIGHT, (has_padding ? PADDED_WIDTH : WIDTH), features};
+                const hailo_3d_image_shape_t features_padded_shape = {HEIGHT, WIDTH, (has_padding ? padded_features : features)};
+                const hailo_format_t nhwc = {type, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_FLAGS_NONE};
+                const hailo_format_t nhcw = {type, HAILO_FORMAT_ORDER_NHCW, HAILO_FORMAT_FLAGS_NONE};
+                const hailo_format_t fcr = {type, HAILO_FORMAT_ORDER_FCR, HAILO_FORMAT_FLAGS_NONE};
+
+                cases.push_back({"BM_reorder_kernel/h2d_NHWC_to_NHCW" + name_suffix, HAILO_H2D_STREAM,
+                    shape, nhwc, width_padded_shape, nhcw});
+                cases.push_back({"BM_reorder_kernel/h2d_NHWC_to_FCR" + name_suffix, HAILO_H2D_STREAM,
+                    shape, nhwc, features_padded_shape, fcr});
+                cases.push_back({"BM_reorder_kernel/d2h_NHCW_to_NHWC" + name_suffix, HAILO_D2H_STREAM,
+                    width_padded_shape, nhcw, shape, nhwc});
+                cases.push_back({"BM_reorder_kernel/d2h_FCR_to_NHWC" + name_suffix, HAILO_D2H_STREAM,
+                    features_padded_shape, fcr, shape, nhwc});
+            }
+        }
+    }
+    return cases;
+}
+
+static void BM_reorder_kernel(benchmark::State &state, const ReorderKernelCase &kernel_case)
+{
+    const bool is_h2d = (HAILO_H2D_STREAM == kernel_case.direction);
+    const auto kernel = is_h2d ?
+        TransformKernels::get_input_reorder_kernel(kernel_case.src_shape, kernel_case.src_format,
+            kernel_case.dst_shape, kernel_case.dst_format) :
+        TransformKernels::get_output_reorder_kernel(kernel_case.src_shape, kernel_case.src_format,
+            kernel_case.dst_shape, kernel_case.dst_format);
+    if (nullptr == kernel) {
+        state.SkipWithError("No specialized kernel was resolved");
+        return;
+    }
+
+    std::vector<uint8_t> src(HailoRTCommon::get_frame_size(kernel_case.src_shape, kernel_case.src_format));
+    std::iota(src.begin(), src.end(), static_cast<uint8_t>(0));
+    // Both dst buffers start with the same pattern, so elements that aren't written by the reorder compare equal
+    std::vector<uint8_t> expected_dst(HailoRTCommon::get_frame_size(kernel_case.dst_shape, kernel_case.dst_format), 0xAB);
+    std::vector<uint8_t> dst(expected_dst);
+
+    const auto status = is_h2d ?
+        reorder_input_stream(src.data(), kernel_case.src_shape, kernel_case.src_format, expected_dst.data(),
+            kernel_case.dst_shape, kernel_case.dst_format) :
+        reorder_output_stream(src.data(), kernel_case.src_shape, kernel_case.src_format, expected_dst.data(),
+            kernel_case.dst_shape, kernel_case.dst_format);
+    if (HAILO_SUCCESS != status) {
+        state.SkipWithError("Generic reorder failed");
+        return;
+    }
+    kernel(src.data(), kernel_case.src_shape, dst.data(), kernel_case.dst_shape);
+    if (dst != expected_dst) {
+        state.SkipWithError("Specialized kernel output differs from the generic reorder");
+        return;
+    }
+
+    for (auto _ : state) {
+        kernel(src.data(), kernel_case.src_shape, dst.data(), kernel_case.dst_shape);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.size()));
+}
+
+static bool register_reorder_kernel_benchmarks()
+{
+    static const auto cases = generate_reorder_kernel_cases();
+    for (const auto &kernel_case : cases) {
+        benchmark::RegisterBenchmark(kernel_case.name.c_str(), BM_reorder_kernel, kernel_case);
+    }
+    return true;
+}
+static const bool REORDER_KERNEL_BENCHMARKS_REGISTERED = register_reorder_kernel_benchmarks();
+
+} /* namespace hailort */
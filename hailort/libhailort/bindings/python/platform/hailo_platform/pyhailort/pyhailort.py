@@ -909,7 +909,8 @@ class InferVStreams(object):
                         self._net_group_name)
                     output_tensor_info = output_buffers_info[output_name].output_tensor_info
                     shape, dtype = output_tensor_info
-                    if (output_buffers_info[output_name].output_order == FormatOrder.HAILO_NMS_WITH_BYTE_MASK):
+                    if (output_buffers_info[output_name].output_order in (FormatOrder.HAILO_NMS_WITH_BYTE_MASK,
+                                                                          FormatOrder.HAILO_NMS_WITH_RLE_MASK)):
                         # Note: In python bindings the output data gets converted to py::array with dtype=dtype.
                         #   In `HAILO_NMS_WITH_BYTE_MASK` we would like to get the data as uint8 and convert it by it's format.
                         #   Therefore we need to get it as uint8 instead of float32 and adjust the shape size.
@@ -971,6 +972,9 @@ class InferVStreams(object):
                     nms_shape.number_of_classes, batch_size, input_height, input_width,
                     nms_shape.max_bboxes_per_class, output_dtype, self._tf_nms_format)
                 continue
+            if output_buffers_info[name].output_order == FormatOrder.HAILO_NMS_WITH_RLE_MASK:
+                output_buffers[name] = HailoRTTransformUtils._output_raw_buffer_to_nms_with_rle_mask_format(result_array)
+                continue
 
             is_nms = output_buffers_info[name].is_nms
             if not is_nms:
@@ -1158,6 +1162,72 @@ class HailoDetection(object):
         """
         return self._mask
 
+class HailoRleDetection(object):
+    """Represents Hailo detection information, with a run-length encoded mask"""
+
+    def __init__(self, detection):
+        self._y_min = detection.box.y_min
+        self._x_min = detection.box.x_min
+        self._y_max = detection.box.y_max
+        self._x_max = detection.box.x_max
+        self._score = detection.score
+        self._class_id = detection.class_id
+        self._mask_size = [detection.mask_height, detection.mask_width]
+        self._counts = detection.counts().copy()
+
+    @property
+    def y_min(self):
+        """Get detection's box y_min coordinate"""
+        return self._y_min
+
+    @property
+    def x_min(self):
+        """Get detection's box x_min coordinate"""
+        return self._x_min
+
+    @property
+    def y_max(self):
+        """Get detection's box y_max coordinate"""
+        return self._y_max
+
+    @property
+    def x_max(self):
+        """Get detection's box x_max coordinate"""
+        return self._x_max
+
+    @property
+    def score(self):
+        """Get detection's score"""
+        return self._score
+
+    @property
+    def class_id(self):
+        """Get detection's class_id"""
+        return self._class_id
+
+    @property
+    def mask_size(self):
+        """Get the mask's [height, width], the size of the box in the original input image's dimensions"""
+        return self._mask_size
+
+    @property
+    def counts(self):
+        """Run-length encoded mask:
+        Lengths of the alternating runs of background (0) and ROI (1) pixels of the mask, scanned in column-major order,
+        starting with a (possibly empty) background run. Same as the counts of an uncompressed COCO RLE.
+        """
+        return self._counts
+
+    def to_coco_rle(self):
+        """Returns the mask as an uncompressed COCO RLE dict (relative to the box), e.g. for pycocotools.mask.frPyObjects"""
+        return {'size': list(self._mask_size), 'counts': self._counts.tolist()}
+
+    def decode_mask(self):
+        """Decodes the run-length encoded mask to a byte mask of shape [mask_height, mask_width]"""
+        values = numpy.arange(len(self._counts), dtype=numpy.uint8) % 2
+        flat_mask = numpy.repeat(values, self._counts)
+        return flat_mask.reshape(self._mask_size[1], self._mask_size[0]).T
+
 class HailoRTTransformUtils(object):
     @staticmethod
     def get_dtype(data_bytes):
@@ -1230,47 +1300,30 @@ class HailoRTTransformUtils(object):
 
     @staticmethod
     def output_raw_buffer_to_nms_tf_format(raw_output_buffer, shape, dtype, quantized_empty_bbox):
-        offset = 0
         # We create the tf_format buffer with reversed width/features for preformance optimization
         converted_output_buffer = numpy.empty([shape[0], shape[1], shape[3], shape[2]], dtype=dtype)
-        for frame in range(converted_output_buffer.shape[0]):
-            offset = frame * converted_output_buffer.shape[1] * (converted_output_buffer.shape[2] * converted_output_buffer.shape[3] + 1)
-            HailoRTTransformUtils.output_raw_buffer_to_nms_tf_format_single_frame(raw_output_buffer, converted_output_buffer[frame],
-                converted_output_buffer.shape[1], converted_output_buffer.shape[2], quantized_empty_bbox, offset)
+        with ExceptionWrapper():
+            _pyhailort.convert_nms_buffer_to_tf_format(raw_output_buffer, converted_output_buffer,
+                converted_output_buffer.shape[1], converted_output_buffer.shape[2], quantized_empty_bbox, 0)
         converted_output_buffer = numpy.swapaxes(converted_output_buffer, 2, 3)
         return converted_output_buffer
 
     @staticmethod
     def output_raw_buffer_to_nms_tf_format_single_frame(raw_output_buffer, converted_output_frame, number_of_classes,
         max_bboxes_per_class, quantized_empty_bbox, offset=0):
-        for class_i in range(number_of_classes):
-            class_bboxes_amount = int(raw_output_buffer[offset])
-            offset += 1
-            if 0 != class_bboxes_amount:
-                converted_output_frame[class_i][ : class_bboxes_amount][:] = raw_output_buffer[offset : offset + (BBOX_PARAMS * class_bboxes_amount)].reshape(class_bboxes_amount, BBOX_PARAMS)
-                offset += BBOX_PARAMS * class_bboxes_amount
-            converted_output_frame[class_i][class_bboxes_amount : max_bboxes_per_class][:] = quantized_empty_bbox
+        with ExceptionWrapper():
+            _pyhailort.convert_nms_buffer_to_tf_format(raw_output_buffer, converted_output_frame, number_of_classes,
+                max_bboxes_per_class, quantized_empty_bbox, offset)
 
     @staticmethod
     def output_raw_buffer_to_nms_format(raw_output_buffer, number_of_classes):
-        converted_output_buffer = []
-        for frame in raw_output_buffer:
-            converted_output_buffer.append(HailoRTTransformUtils.output_raw_buffer_to_nms_format_single_frame(frame, number_of_classes))
-        return converted_output_buffer
+        with ExceptionWrapper():
+            return _pyhailort.convert_nms_buffer_to_hailo_format(raw_output_buffer, number_of_classes)
 
     @staticmethod
     def output_raw_buffer_to_nms_format_single_frame(raw_output_buffer, number_of_classes, offset=0):
-        converted_output_frame = []
-        for class_i in range(number_of_classes):
-            class_bboxes_amount = int(raw_output_buffer[offset])
-            offset += 1
-            if class_bboxes_amount == 0:
-                converted_output_frame.append(numpy.empty([0, BBOX_PARAMS]))
-            else:
-                converted_output_frame.append(raw_output_buffer[offset : offset + (BBOX_PARAMS * class_bboxes_amount)].reshape(
-                    class_bboxes_amount, BBOX_PARAMS))
-                offset += BBOX_PARAMS * class_bboxes_amount
-        return converted_output_frame
+        with ExceptionWrapper():
+            return _pyhailort.convert_nms_frame_to_hailo_format(raw_output_buffer, number_of_classes, offset)
 
     @staticmethod
     def _output_raw_buffer_to_nms_with_byte_mask_format(raw_output_buffer, number_of_classes, batch_size, image_height, image_width,
@@ -1298,6 +1351,16 @@ class HailoRTTransformUtils(object):
 
         return converted_output_frame
 
+    @staticmethod
+    def _output_raw_buffer_to_nms_with_rle_mask_format(raw_output_buffer):
+        return [HailoRTTransformUtils._output_raw_buffer_to_nms_with_rle_mask_format_single_frame(frame)
+            for frame in raw_output_buffer]
+
+    @staticmethod
+    def _output_raw_buffer_to_nms_with_rle_mask_format_single_frame(raw_output_buffer):
+        detections = _pyhailort.convert_nms_with_rle_mask_buffer_to_detections(raw_output_buffer)
+        return [HailoRleDetection(detection) for detection in detections]
+
     @staticmethod
     def _output_raw_buffer_to_nms_with_byte_mask_tf_format(raw_output_buffer, number_of_classes, batch_size, image_height, image_width,
             max_bboxes_per_class, output_dtype):
@@ -1309,10 +1372,15 @@ class HailoRTTransformUtils(object):
         # We create the tf_format buffer with reversed max_bboxes_per_class/features for performance optimization
         converted_output_buffer = numpy.empty([batch_size, max_bboxes_per_class, (image_height * image_width + BBOX_WITH_MASK_PARAMS)], dtype=output_dtype)
 
-        for frame_idx in range(len(raw_output_buffer)):
-            HailoRTTransformUtils._output_raw_buffer_to_nms_with_byte_mask_tf_format_single_frame(
-                raw_output_buffer[frame_idx], converted_output_buffer[frame_idx], number_of_classes, max_bboxes_per_class,
-                image_height, image_width)
+        if isinstance(raw_output_buffer, numpy.ndarray):
+            with ExceptionWrapper():
+                _pyhailort.convert_nms_with_byte_mask_buffer_to_tf_format(raw_output_buffer, converted_output_buffer,
+                    max_bboxes_per_class, image_height, image_width)
+        else:
+            for frame_idx, frame in enumerate(raw_output_buffer):
+                HailoRTTransformUtils._output_raw_buffer_to_nms_with_byte_mask_tf_format_single_frame(
+                    frame, converted_output_buffer[frame_idx], number_of_classes, max_bboxes_per_class,
+                    image_height, image_width)
         converted_output_buffer = numpy.moveaxis(converted_output_buffer, CLASSES_AXIS, BBOX_WITH_MASK_AXIS)
         converted_output_buffer = numpy.expand_dims(converted_output_buffer, 1)
         return converted_output_buffer
@@ -1320,36 +1388,9 @@ class HailoRTTransformUtils(object):
     @staticmethod
     def _output_raw_buffer_to_nms_with_byte_mask_tf_format_single_frame(raw_output_buffer, converted_output_frame, number_of_classes,
         max_boxes, image_height, image_width):
-
-        detections = _pyhailort.convert_nms_with_byte_mask_buffer_to_detections(raw_output_buffer)
-        bbox_idx = 0
-        for detection in detections:
-            if (bbox_idx >= max_boxes):
-                return
-            bbox = numpy.array([detection.box.y_min, detection.box.x_min, detection.box.y_max, detection.box.x_max,
-                    detection.score, detection.class_id])
-            bbox_mask = detection.mask()
-
-            y_min = numpy.ceil(bbox[0] * image_height)
-            x_min = numpy.ceil(bbox[1] * image_width)
-            bbox_width = numpy.ceil((bbox[3] - bbox[1]) * image_width)
-            resized_mask = numpy.zeros(image_height*image_width, dtype="uint8")
-
-            for i in range(bbox_mask.size):
-                if (bbox_mask[i] == 1):
-                    x = int(x_min + (i % bbox_width))
-                    y = int(y_min + (i // bbox_width))
-                    if (x >= image_width):
-                        x = image_width - 1
-                    if ( y >= image_height):
-                        y = image_height - 1
-                    idx = (image_width * y) + x
-                    resized_mask[idx] = 1
-
-            bbox_with_mask = numpy.append(bbox, resized_mask)
-            converted_output_frame[bbox_idx] = bbox_with_mask
-            bbox_idx += 1
-
+        with ExceptionWrapper():
+            _pyhailort.convert_nms_with_byte_mask_buffer_to_tf_format(raw_output_buffer, converted_output_frame, max_boxes,
+                image_height, image_width)
 
     @staticmethod
     def _get_format_type(dtype):
@@ -1357,6 +1398,8 @@ class HailoRTTransformUtils(object):
             return FormatType.UINT8
         elif dtype == numpy.uint16:
             return FormatType.UINT16
+        elif dtype == numpy.float16:
+            return FormatType.FLOAT16
         elif dtype == numpy.float32:
             return FormatType.FLOAT32
         raise HailoRTException("unsupported data type {}".format(dtype))
@@ -2841,7 +2884,8 @@ class InferModel:
             A :obj:`ConfiguredInferModel` should be used inside a context manager, and should not be passed to a different process.
         """
         with ExceptionWrapper():
-            if len(self.output_names) == 1 and self.output().format.order == FormatOrder.HAILO_NMS_WITH_BYTE_MASK:
+            if len(self.output_names) == 1 and self.output().format.order in (FormatOrder.HAILO_NMS_WITH_BYTE_MASK,
+                                                                              FormatOrder.HAILO_NMS_WITH_RLE_MASK):
                 raise HailoRTException("this model is not supported on async infer model API")
 
             configured_infer_model_cpp_obj = self._infer_model.configure()
@@ -3807,13 +3851,8 @@ class InputVStream(object):
             logger.warning("Warning - Converting input numpy array to be C_CONTIGUOUS")
             input_data = numpy.asarray(input_data, order='C')
 
-        batch_number = 0
-        batch_size = 1
-        while batch_number < input_data.shape[0]:
-            data = input_data[batch_number:batch_number + batch_size]
-            with ExceptionWrapper():
-                self._send_object.send(data)
-            batch_number += batch_size
+        with ExceptionWrapper():
+            self._send_object.send_many(input_data)
 
     def flush(self):
         """Blocks until there are no buffers in the input VStream pipeline."""
@@ -4002,6 +4041,9 @@ class OutputVStream(object):
                 self._output_dtype, self._tf_nms_format)
             return res
 
+        if self.output_order == FormatOrder.HAILO_NMS_WITH_RLE_MASK:
+            return HailoRTTransformUtils._output_raw_buffer_to_nms_with_rle_mask_format_single_frame(result_array)
+
         if self._is_nms:
             nms_shape = self._vstream_info.nms_shape
             if self._tf_nms_format:
@@ -4018,6 +4060,29 @@ class OutputVStream(object):
                     nms_shape.number_of_classes)
         return result_array
 
+    def recv_into(self, output_buffer):
+        """Receive a single frame after inference into a preallocated array, without allocating.
+
+        Args:
+            output_buffer (:obj:`numpy.ndarray`): A C-contiguous array of :attr:`dtype` whose size matches a
+                single frame. The raw output (without NMS format conversion) is written into it.
+        """
+        with ExceptionWrapper():
+            self._recv_object.recv_into(output_buffer)
+
+    def recv_many(self, output_buffer):
+        """Receive several frames after inference into a preallocated array, without allocating.
+
+        Args:
+            output_buffer (:obj:`numpy.ndarray`): A C-contiguous array of :attr:`dtype` whose first dimension is
+                the number of frames to receive. The raw outputs (without NMS format conversion) are written into it.
+
+        Returns:
+            int: The number of frames received.
+        """
+        with ExceptionWrapper():
+            return self._recv_object.recv_many(output_buffer)
+
     @property
     def info(self):
         with ExceptionWrapper():
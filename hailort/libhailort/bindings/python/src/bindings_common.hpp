@@ -33,6 +33,11 @@ public:
             return "uint16";
         case HAILO_FORMAT_TYPE_FLOAT32:
             return "float32";
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return "float16";
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            // numpy has no bfloat16 dtype - the raw bits are exposed
+            return "uint16";
         default:
             throw HailoRTStatusException("Invalid format type.");
         }
@@ -48,6 +53,7 @@ public:
         case HAILO_FORMAT_ORDER_HAILO_NMS:
             return { HailoRTCommon::get_nms_host_shape_size(nms_shape) };
         case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK:
+        case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK:
             return {HailoRTCommon::get_nms_host_frame_size(nms_shape, user_format) / HailoRTCommon::get_format_data_bytes(user_format)};
         case HAILO_FORMAT_ORDER_NC:
             return {shape.features};
@@ -0,0 +1,351 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file nms_decode_api.cpp
+ * @brief Decoding of NMS outputs into the numpy formats returned by pyhailort
+ **/
+
+#include "hailo/hailort_common.hpp"
+
+#include "nms_decode_api.hpp"
+
+#include <pybind11/gil.h>           // py::gil_scoped_release
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+namespace hailort
+{
+
+static const size_t BBOX_PARAMS = HailoRTCommon::BBOX_PARAMS;
+
+struct ClassDetections
+{
+    // Offset (in elements) of the first bbox of the class
+    size_t offset;
+    size_t bboxes_count;
+};
+
+template<typename T>
+static hailo_status parse_nms_frame(const T *src, size_t src_size, size_t offset, uint32_t number_of_classes,
+    std::vector<ClassDetections> &classes_detections)
+{
+    for (uint32_t class_index = 0; class_index < number_of_classes; class_index++) {
+        if (offset >= src_size) {
+            std::cerr << "NMS buffer is too small for " << number_of_classes << " classes";
+            return HAILO_INVALID_ARGUMENT;
+        }
+        const auto bboxes_count = static_cast<size_t>(src[offset]);
+        offset++;
+        if ((offset + (bboxes_count * BBOX_PARAMS)) > src_size) {
+            std::cerr << "NMS buffer is too small for " << bboxes_count << " bboxes of class " << class_index;
+            return HAILO_INVALID_ARGUMENT;
+        }
+        classes_detections.push_back({offset, bboxes_count});
+        offset += bboxes_count * BBOX_PARAMS;
+    }
+    return HAILO_SUCCESS;
+}
+
+template<typename T>
+static hailo_status convert_nms_frame_to_tf_format(const T *src, size_t src_size, size_t offset,
+    uint32_t number_of_classes, uint32_t max_bboxes_per_class, const T *empty_bbox, T *dst)
+{
+    for (uint32_t class_index = 0; class_index < number_of_classes; class_index++) {
+        if (offset >= src_size) {
+            std::cerr << "NMS buffer is too small for " << number_of_classes << " classes";
+            return HAILO_INVALID_ARGUMENT;
+        }
+        const auto bboxes_count = static_cast<size_t>(src[offset]);
+        offset++;
+        if (bboxes_count > max_bboxes_per_class) {
+            std::cerr << "Class " << class_index << " has " << bboxes_count << " bboxes, while max_bboxes_per_class is " <<
+                max_bboxes_per_class;
+            return HAILO_INVALID_ARGUMENT;
+        }
+        if ((offset + (bboxes_count * BBOX_PARAMS)) > src_size) {
+            std::cerr << "NMS buffer is too small for " << bboxes_count << " bboxes of class " << class_index;
+            return HAILO_INVALID_ARGUMENT;
+        }
+
+        std::copy_n(src + offset, bboxes_count * BBOX_PARAMS, dst);
+        offset += bboxes_count * BBOX_PARAMS;
+        for (size_t bbox_index = bboxes_count; bbox_index < max_bboxes_per_class; bbox_index++) {
+            std::copy_n(empty_bbox, BBOX_PARAMS, dst + (bbox_index * BBOX_PARAMS));
+        }
+        dst += max_bboxes_per_class * BBOX_PARAMS;
+    }
+    return HAILO_SUCCESS;
+}
+
+// Pastes the mask of the detection to a full image mask. The mask pixel i is placed at
+// (x_min + i % mask_width, y_min + i // mask_width) with the coordinates clamped to the image, same as numpy does
+// it on float64 values (including numpy's wrap-around of negative indices).
+template<typename T>
+static hailo_status paste_detection_mask(const hailo_detection_with_byte_mask_t &detection, const uint8_t *mask,
+    uint32_t image_height, uint32_t image_width, T *dst_mask)
+{
+    const auto image_size = static_cast<int64_t>(image_height) * image_width;
+    std::fill_n(dst_mask, image_size, static_cast<T>(0));
+
+    const double y_min = std::ceil(static_cast<double>(detection.box.y_min) * image_height);
+    const double x_min = std::ceil(static_cast<double>(detection.box.x_min) * image_width);
+    const double mask_width = std::ceil(
+        (static_cast<double>(detection.box.x_max) - static_cast<double>(detection.box.x_min)) * image_width);
+
+    for (size_t i = 0; i < detection.mask_size; i++) {
+        if (1 != mask[i]) {
+            continue;
+        }
+        if (0 == mask_width) {
+            std::cerr << "Detection has a mask, but its box has no width";
+            return HAILO_INVALID_ARGUMENT;
+        }
+
+        // Python's modulo and floor division
+        const auto pixel = static_cast<double>(i);
+        double column = std::fmod(pixel, mask_width);
+        if ((0 != column) && ((column < 0) != (mask_width < 0))) {
+            column += mask_width;
+        }
+        const double row = std::floor((pixel - column) / mask_width);
+
+        auto x = static_cast<int64_t>(x_min + column);
+        auto y = static_cast<int64_t>(y_min + row);
+        x = std::min(x, static_cast<int64_t>(image_width) - 1);
+        y = std::min(y, static_cast<int64_t>(image_height) - 1);
+
+        auto index = (static_cast<int64_t>(image_width) * y) + x;
+        if (index < 0) {
+            index += image_size;
+        }
+        if ((index < 0) || (index >= image_size)) {
+            std::cerr << "Mask pixel (" << x << ", " << y << ") is out of the image";
+            return HAILO_INVALID_ARGUMENT;
+        }
+        dst_mask[index] = static_cast<T>(1);
+    }
+    return HAILO_SUCCESS;
+}
+
+template<typename T>
+static hailo_status convert_nms_with_byte_mask_frame_to_tf_format(const uint8_t *src, size_t src_size,
+    uint32_t max_bboxes, uint32_t image_height, uint32_t image_width, T *dst)
+{
+    uint16_t detections_count = 0;
+    if (src_size < sizeof(detections_count)) {
+        std::cerr << "NMS buffer is too small";
+        return HAILO_INVALID_ARGUMENT;
+    }
+    memcpy(&detections_count, src, sizeof(detections_count));
+
+    const size_t row_size = NmsDecodeBindings::BBOX_WITH_MASK_PARAMS + (static_cast<size_t>(image_height) * image_width);
+    size_t offset = sizeof(detections_count);
+    for (size_t i = 0; (i < detections_count) && (i < max_bboxes); i++) {
+        hailo_detection_with_byte_mask_t detection{};
+        if ((offset + sizeof(detection)) > src_size) {
+            std::cerr << "NMS buffer is too small for " << detections_count << " detections";
+            return HAILO_INVALID_ARGUMENT;
+        }
+        memcpy(&detection, src + offset, sizeof(detection));
+        // The mask follows the detection (detection.mask points to the buffer the detection was written to)
+        const uint8_t *mask = src + offset + sizeof(detection);
+        offset += sizeof(detection) + detection.mask_size;
+        if (offset > src_size) {
+            std::cerr << "NMS buffer is too small for " << detections_count << " detections";
+            return HAILO_INVALID_ARGUMENT;
+        }
+
+        T *row = dst + (i * row_size);
+        row[0] = static_cast<T>(detection.box.y_min);
+        row[1] = static_cast<T>(detection.box.x_min);
+        row[2] = static_cast<T>(detection.box.y_max);
+        row[3] = static_cast<T>(detection.box.x_max);
+        row[4] = static_cast<T>(detection.score);
+        row[5] = static_cast<T>(detection.class_id);
+        auto status = paste_detection_mask(detection, mask, image_height, image_width,
+            row + NmsDecodeBindings::BBOX_WITH_MASK_PARAMS);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+// Calls func with a value of the element type of the array
+template<typename Func>
+static void call_by_dtype(const py::array &array, Func &&func)
+{
+    if (py::isinstance<py::array_t<uint8_t>>(array)) {
+        func(uint8_t{});
+    } else if (py::isinstance<py::array_t<uint16_t>>(array)) {
+        func(uint16_t{});
+    } else if (py::isinstance<py::array_t<float32_t>>(array)) {
+        func(float32_t{});
+    } else if (py::isinstance<py::array_t<float64_t>>(array)) {
+        func(float64_t{});
+    } else {
+        std::cerr << "NMS buffer dtype must be one of uint8, uint16, float32, float64";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+}
+
+static void validate_c_contiguous(const py::array &array)
+{
+    if (!(array.flags() & py::array::c_style)) {
+        std::cerr << "Array must be C-contiguous";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+}
+
+static size_t get_frames_count(const py::array &array)
+{
+    return (array.ndim() > 1) ? static_cast<size_t>(array.shape(0)) : 1;
+}
+
+static py::list convert_nms_frames_to_hailo_format(py::array src_buffer, uint32_t number_of_classes,
+    size_t frames_count, size_t frame_size, size_t offset)
+{
+    validate_c_contiguous(src_buffer);
+
+    const auto src_size = static_cast<size_t>(src_buffer.size());
+    std::vector<ClassDetections> classes_detections;
+    classes_detections.reserve(frames_count * number_of_classes);
+    hailo_status status = HAILO_SUCCESS;
+    call_by_dtype(src_buffer, [&](auto element) {
+        using T = decltype(element);
+        const T *src = static_cast<const T*>(src_buffer.data());
+        py::gil_scoped_release release;
+        for (size_t frame = 0; (frame < frames_count) && (HAILO_SUCCESS == status); frame++) {
+            status = parse_nms_frame(src, src_size, offset + (frame * frame_size), number_of_classes, classes_detections);
+        }
+    });
+    VALIDATE_STATUS(status);
+
+    // The detections of each class are returned as views of the src buffer
+    const auto item_size = static_cast<py::ssize_t>(src_buffer.itemsize());
+    const auto src_data = static_cast<const uint8_t*>(src_buffer.data());
+    const std::vector<py::ssize_t> strides = {item_size * static_cast<py::ssize_t>(BBOX_PARAMS), item_size};
+    py::list frames;
+    for (size_t frame = 0; frame < frames_count; frame++) {
+        py::list frame_detections;
+        for (uint32_t class_index = 0; class_index < number_of_classes; class_index++) {
+            const auto &class_detections = classes_detections[(frame * number_of_classes) + class_index];
+            if (0 == class_detections.bboxes_count) {
+                // Same as numpy.empty([0, BBOX_PARAMS])
+                frame_detections.append(py::array_t<float64_t>(std::vector<py::ssize_t>{0, static_cast<py::ssize_t>(BBOX_PARAMS)}));
+                continue;
+            }
+            const std::vector<py::ssize_t> shape = {static_cast<py::ssize_t>(class_detections.bboxes_count),
+                static_cast<py::ssize_t>(BBOX_PARAMS)};
+            frame_detections.append(py::array(src_buffer.dtype(), shape, strides,
+                src_data + (class_detections.offset * static_cast<size_t>(item_size)), src_buffer));
+        }
+        frames.append(frame_detections);
+    }
+    return frames;
+}
+
+py::list NmsDecodeBindings::convert_nms_buffer_to_hailo_format(py::array src_buffer, uint32_t number_of_classes)
+{
+    const auto frames_count = get_frames_count(src_buffer);
+    const auto frame_size = (0 == frames_count) ? 0 : (static_cast<size_t>(src_buffer.size()) / frames_count);
+    return convert_nms_frames_to_hailo_format(src_buffer, number_of_classes, frames_count, frame_size, 0);
+}
+
+py::list NmsDecodeBindings::convert_nms_frame_to_hailo_format(py::array src_buffer, uint32_t number_of_classes,
+    size_t offset)
+{
+    auto frames = convert_nms_frames_to_hailo_format(src_buffer, number_of_classes, 1, 0, offset);
+    return frames[0].cast<py::list>();
+}
+
+void NmsDecodeBindings::convert_nms_buffer_to_tf_format(py::array src_buffer, py::array dst_buffer,
+    uint32_t number_of_classes, uint32_t max_bboxes_per_class, py::array empty_bbox, size_t offset)
+{
+    validate_c_contiguous(src_buffer);
+    validate_c_contiguous(dst_buffer);
+
+    const size_t dst_frame_size = static_cast<size_t>(number_of_classes) * max_bboxes_per_class * BBOX_PARAMS;
+    // Each class is its bboxes count followed by max_bboxes_per_class bboxes
+    const size_t src_frame_size = static_cast<size_t>(number_of_classes) * (1 + (max_bboxes_per_class * BBOX_PARAMS));
+    if ((0 == dst_frame_size) || (0 != (static_cast<size_t>(dst_buffer.size()) % dst_frame_size))) {
+        std::cerr << "NMS dst buffer size (" << dst_buffer.size() << ") must be a multiple of the frame size (" <<
+            dst_frame_size << ")";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+    const size_t frames_count = static_cast<size_t>(dst_buffer.size()) / dst_frame_size;
+    const auto src_size = static_cast<size_t>(src_buffer.size());
+
+    hailo_status status = HAILO_SUCCESS;
+    call_by_dtype(dst_buffer, [&](auto element) {
+        using T = decltype(element);
+        if (!py::isinstance<py::array_t<T>>(src_buffer)) {
+            std::cerr << "NMS src and dst buffers must have the same dtype";
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+        // Casted the same way numpy casts it on assignment
+        auto empty_bbox_array = py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(empty_bbox);
+        if (!empty_bbox_array || (BBOX_PARAMS != static_cast<size_t>(empty_bbox_array.size()))) {
+            std::cerr << "Empty bbox must have " << BBOX_PARAMS << " elements";
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+        const T *empty_bbox_ptr = empty_bbox_array.data();
+        const T *src = static_cast<const T*>(src_buffer.data());
+        T *dst = static_cast<T*>(dst_buffer.mutable_data());
+
+        py::gil_scoped_release release;
+        for (size_t frame = 0; (frame < frames_count) && (HAILO_SUCCESS == status); frame++) {
+            status = convert_nms_frame_to_tf_format(src, src_size, offset + (frame * src_frame_size), number_of_classes,
+                max_bboxes_per_class, empty_bbox_ptr, dst + (frame * dst_frame_size));
+        }
+    });
+    VALIDATE_STATUS(status);
+}
+
+void NmsDecodeBindings::convert_nms_with_byte_mask_buffer_to_tf_format(py::array src_buffer, py::array dst_buffer,
+    uint32_t max_bboxes, uint32_t image_height, uint32_t image_width)
+{
+    validate_c_contiguous(src_buffer);
+    validate_c_contiguous(dst_buffer);
+
+    const auto frames_count = get_frames_count(src_buffer);
+    const size_t dst_frame_size = static_cast<size_t>(max_bboxes) *
+        (BBOX_WITH_MASK_PARAMS + (static_cast<size_t>(image_height) * image_width));
+    if (static_cast<size_t>(dst_buffer.size()) < (frames_count * dst_frame_size)) {
+        std::cerr << "NMS dst buffer is too small for " << frames_count << " frames";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+    const size_t src_frame_size = (0 == frames_count) ? 0 : (static_cast<size_t>(src_buffer.nbytes()) / frames_count);
+    const auto src = static_cast<const uint8_t*>(src_buffer.data());
+
+    hailo_status status = HAILO_SUCCESS;
+    call_by_dtype(dst_buffer, [&](auto element) {
+        using T = decltype(element);
+        T *dst = static_cast<T*>(dst_buffer.mutable_data());
+
+        py::gil_scoped_release release;
+        for (size_t frame = 0; (frame < frames_count) && (HAILO_SUCCESS == status); frame++) {
+            status = convert_nms_with_byte_mask_frame_to_tf_format(src + (frame * src_frame_size), src_frame_size,
+                max_bboxes, image_height, image_width, dst + (frame * dst_frame_size));
+        }
+    });
+    VALIDATE_STATUS(status);
+}
+
+void NmsDecodeBindings::bind(py::module &m)
+{
+    m.def("convert_nms_buffer_to_hailo_format", &NmsDecodeBindings::convert_nms_buffer_to_hailo_format);
+    m.def("convert_nms_frame_to_hailo_format", &NmsDecodeBindings::convert_nms_frame_to_hailo_format);
+    m.def("convert_nms_buffer_to_tf_format", &NmsDecodeBindings::convert_nms_buffer_to_tf_format);
+    m.def("convert_nms_with_byte_mask_buffer_to_tf_format",
+        &NmsDecodeBindings::convert_nms_with_byte_mask_buffer_to_tf_format);
+}
+
+} /* namespace hailort */
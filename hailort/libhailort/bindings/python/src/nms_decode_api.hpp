@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file nms_decode_api.hpp
+ * @brief Decoding of NMS outputs into the numpy formats returned by pyhailort
+ **/
+
+#ifndef _HAILO_NMS_DECODE_API_HPP_
+#define _HAILO_NMS_DECODE_API_HPP_
+
+#include "hailo/hailort.h"
+
+#include "utils.hpp"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+
+
+namespace hailort
+{
+
+// The decoding is done with the GIL released, directly into the given numpy arrays. The outputs are the same as the
+// ones of the previous (pure python) HailoRTTransformUtils decoding.
+class NmsDecodeBindings final
+{
+public:
+    // HAILO_NMS -> list (per frame) of lists (per class) of [bboxes_count, BBOX_PARAMS] arrays, which are views of
+    // src_buffer. The frames are split on the first axis of src_buffer.
+    static py::list convert_nms_buffer_to_hailo_format(py::array src_buffer, uint32_t number_of_classes);
+    // Same as convert_nms_buffer_to_hailo_format, for a single frame starting at offset (in elements)
+    static py::list convert_nms_frame_to_hailo_format(py::array src_buffer, uint32_t number_of_classes, size_t offset);
+
+    // HAILO_NMS -> dst_buffer of shape [frames, number_of_classes, max_bboxes_per_class, BBOX_PARAMS]. The frames
+    // start at offset (in elements) of src_buffer, the bboxes following the detections of a class are set to empty_bbox.
+    static void convert_nms_buffer_to_tf_format(py::array src_buffer, py::array dst_buffer, uint32_t number_of_classes,
+        uint32_t max_bboxes_per_class, py::array empty_bbox, size_t offset);
+
+    // HAILO_NMS_WITH_BYTE_MASK -> dst_buffer of shape [frames, max_bboxes, BBOX_WITH_MASK_PARAMS + height * width].
+    // Each detection is written as its box, score and class id, followed by its mask pasted into a full image mask.
+    // The frames are split on the first axis of src_buffer.
+    static void convert_nms_with_byte_mask_buffer_to_tf_format(py::array src_buffer, py::array dst_buffer,
+        uint32_t max_bboxes, uint32_t image_height, uint32_t image_width);
+
+    static void bind(py::module &m);
+
+    // 4 coordinates + score + class_id
+    static constexpr size_t BBOX_WITH_MASK_PARAMS = 6;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_NMS_DECODE_API_HPP_ */
@@ -19,6 +19,7 @@ using namespace std;
 #include "network_group_api.hpp"
 #include "device_api.hpp"
 #include "quantization_api.hpp"
+#include "nms_decode_api.hpp"
 
 #include "utils.hpp"
 
@@ -154,6 +155,25 @@ std::vector<hailo_detection_with_byte_mask_t> convert_nms_with_byte_mask_buffer_
     return detections;
 }
 
+std::vector<hailo_detection_with_rle_mask_t> convert_nms_with_rle_mask_buffer_to_detections(py::array src_buffer)
+{
+    std::vector<hailo_detection_with_rle_mask_t> detections;
+    uint8_t *src_ptr = static_cast<uint8_t*>(src_buffer.mutable_data());
+    uint16_t detections_count = *(uint16_t*)src_ptr;
+    detections.reserve(detections_count);
+
+    size_t buffer_offset = sizeof(uint16_t);
+    for (size_t i = 0; i < detections_count; i++) {
+        hailo_detection_with_rle_mask_t detection = *(hailo_detection_with_rle_mask_t*)(src_ptr + buffer_offset);
+        // The counts pointer was set for the original output buffer, locate the counts in the given buffer
+        auto counts_offset = HailoRTCommon::align_to(buffer_offset + sizeof(hailo_detection_with_rle_mask_t), sizeof(uint32_t));
+        detection.counts = reinterpret_cast<uint32_t*>(src_ptr + counts_offset);
+        buffer_offset = counts_offset + (detection.counts_count * sizeof(uint32_t));
+        detections.emplace_back(std::move(detection));
+    }
+    return detections;
+}
+
 static void validate_versions_match()
 {
     hailo_version_t libhailort_version = {};
@@ -180,6 +200,7 @@ PYBIND11_MODULE(_pyhailort, m) {
 
     m.def("get_status_message", &get_status_message);
     m.def("convert_nms_with_byte_mask_buffer_to_detections", &convert_nms_with_byte_mask_buffer_to_detections);
+    m.def("convert_nms_with_rle_mask_buffer_to_detections", &convert_nms_with_rle_mask_buffer_to_detections);
     m.def("dequantize_output_buffer_in_place", &QuantizationBindings::dequantize_output_buffer_in_place);
     m.def("dequantize_output_buffer", &QuantizationBindings::dequantize_output_buffer);
     m.def("quantize_input_buffer", &QuantizationBindings::quantize_input_buffer);
@@ -243,6 +264,18 @@ PYBIND11_MODULE(_pyhailort, m) {
         })
         ;
 
+    py::class_<hailo_detection_with_rle_mask_t>(m, "HailoDetectionWithRleMask")
+        .def_readonly("box", &hailo_detection_with_rle_mask_t::box)
+        .def_readonly("mask_height", &hailo_detection_with_rle_mask_t::mask_height)
+        .def_readonly("mask_width", &hailo_detection_with_rle_mask_t::mask_width)
+        .def_readonly("score", &hailo_detection_with_rle_mask_t::score)
+        .def_readonly("class_id", &hailo_detection_with_rle_mask_t::class_id)
+        .def("counts", [](const hailo_detection_with_rle_mask_t &detection) -> py::array {
+            auto shape = *py::array::ShapeContainer({detection.counts_count});
+            return py::array(py::dtype("uint32"), shape, detection.counts);
+        })
+        ;
+
     py::enum_<hailo_device_architecture_t>(m, "DeviceArchitecture")
         .value("HAILO8_A0", HAILO_ARCH_HAILO8_A0)
         .value("HAILO8", HAILO_ARCH_HAILO8)
@@ -534,6 +567,8 @@ PYBIND11_MODULE(_pyhailort, m) {
         .value("UINT8", HAILO_FORMAT_TYPE_UINT8)
         .value("UINT16", HAILO_FORMAT_TYPE_UINT16)
         .value("FLOAT32", HAILO_FORMAT_TYPE_FLOAT32)
+        .value("FLOAT16", HAILO_FORMAT_TYPE_FLOAT16)
+        .value("BFLOAT16", HAILO_FORMAT_TYPE_BFLOAT16, "numpy has no bfloat16 dtype, so buffers of this type are exposed as uint16 (raw bfloat16 bits).")
         ;
 
     py::enum_<hailo_format_order_t>(m, "FormatOrder")
@@ -558,6 +593,7 @@ PYBIND11_MODULE(_pyhailort, m) {
         .value("I420", HAILO_FORMAT_ORDER_I420)
         .value("YYYYUV", HAILO_FORMAT_ORDER_HAILO_YYYYUV)
         .value("HAILO_NMS_WITH_BYTE_MASK", HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK)
+        .value("HAILO_NMS_WITH_RLE_MASK", HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK)
         ;
 
     py::enum_<hailo_format_flags_t>(m, "FormatFlags", py::arithmetic())
@@ -1190,6 +1226,7 @@ PYBIND11_MODULE(_pyhailort, m) {
     InputVStreamWrapper::bind(m);
     InputVStreamsWrapper::bind(m);
     NetworkRateLimiter::bind(m);
+    NmsDecodeBindings::bind(m);
     OutputVStreamWrapper::bind(m);
     OutputVStreamsWrapper::bind(m);
     VDeviceWrapper::bind(m);
@@ -33,6 +33,10 @@ void QuantizationBindings::dequantize_output_buffer_from_uint8(py::array src_buf
             Quantization::dequantize_output_buffer<float32_t, uint8_t>(static_cast<uint8_t*>(src_buffer.mutable_data()),
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer<Float16, uint8_t>(static_cast<uint8_t*>(src_buffer.mutable_data()),
+                static_cast<Float16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src format type uint8 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -52,6 +56,10 @@ void QuantizationBindings::dequantize_output_buffer_from_uint16(py::array src_bu
             Quantization::dequantize_output_buffer<float32_t, uint16_t>(static_cast<uint16_t*>(src_buffer.mutable_data()),
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer<Float16, uint16_t>(static_cast<uint16_t*>(src_buffer.mutable_data()),
+                static_cast<Float16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src dormat type uint16 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -90,6 +98,10 @@ void QuantizationBindings::dequantize_output_buffer_from_uint8_in_place(py::arra
             Quantization::dequantize_output_buffer_in_place<float32_t, uint8_t>(
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer_in_place<Float16, uint8_t>(
+                static_cast<Float16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src format type uint8 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -109,6 +121,10 @@ void QuantizationBindings::dequantize_output_buffer_from_uint16_in_place(py::arr
             Quantization::dequantize_output_buffer_in_place<float32_t, uint16_t>(
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer_in_place<Float16, uint16_t>(
+                static_cast<Float16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src dormat type uint16 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -225,6 +241,26 @@ void QuantizationBindings::quantize_input_buffer_from_float32(py::array src_buff
     }
 }
 
+void QuantizationBindings::quantize_input_buffer_from_float16(py::array src_buffer, py::array dst_buffer, const hailo_format_type_t &dst_dtype,
+    uint32_t shape_size, const hailo_quant_info_t &quant_info)
+{
+    switch (dst_dtype) {
+        case HAILO_FORMAT_TYPE_UINT8:
+            Quantization::quantize_input_buffer<Float16, uint8_t>(static_cast<Float16*>(src_buffer.mutable_data()),
+                static_cast<uint8_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
+        case HAILO_FORMAT_TYPE_UINT16:
+            Quantization::quantize_input_buffer<Float16, uint16_t>(static_cast<Float16*>(src_buffer.mutable_data()),
+                static_cast<uint16_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
+        default:
+            std::cerr << "Input quantization isn't supported from src format type float16 to dst format type = " <<
+                HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+            break;
+    }
+}
+
 void QuantizationBindings::quantize_input_buffer(py::array src_buffer, py::array dst_buffer, const hailo_format_type_t &src_dtype,
     const hailo_format_type_t &dst_dtype, uint32_t shape_size, const hailo_quant_info_t &quant_info)
 {
@@ -238,6 +274,9 @@ void QuantizationBindings::quantize_input_buffer(py::array src_buffer, py::array
         case HAILO_FORMAT_TYPE_FLOAT32:
             QuantizationBindings::quantize_input_buffer_from_float32(src_buffer, dst_buffer, dst_dtype, shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            QuantizationBindings::quantize_input_buffer_from_float16(src_buffer, dst_buffer, dst_dtype, shape_size, quant_info);
+            break;
         default:
             std::cerr << "Input quantization isn't supported for src format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
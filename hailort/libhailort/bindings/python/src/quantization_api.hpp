@@ -52,6 +52,8 @@ private:
         uint32_t shape_size, const hailo_quant_info_t &quant_info);
     static void quantize_input_buffer_from_float32(py::array src_buffer, py::array dst_buffer, const hailo_format_type_t &dst_dtype,
         uint32_t shape_size, const hailo_quant_info_t &quant_info);
+    static void quantize_input_buffer_from_float16(py::array src_buffer, py::array dst_buffer, const hailo_format_type_t &dst_dtype,
+        uint32_t shape_size, const hailo_quant_info_t &quant_info);
 };
 
 } /* namespace hailort */
@@ -12,24 +12,63 @@
 #include "utils.hpp"
 #include "network_group_api.hpp"
 
+#include <pybind11/gil.h>           // py::gil_scoped_release
+
 #include <iostream>
 
 
 namespace hailort
 {
 
+static size_t get_frames_count(const py::array &data, size_t frame_size)
+{
+    if (!(data.flags() & py::array::c_style)) {
+        std::cerr << "Array must be C-contiguous";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+    const auto nbytes = static_cast<size_t>(data.nbytes());
+    if (0 != (nbytes % frame_size)) {
+        std::cerr << "Array size (" << nbytes << ") must be a multiple of the frame size (" << frame_size << ")";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+    return nbytes / frame_size;
+}
+
 void InputVStreamWrapper::bind(py::module &m)
 {
     py::class_<InputVStream, std::shared_ptr<InputVStream>>(m, "InputVStream")
     .def("send", [](InputVStream &self, py::array data)
     {
-        hailo_status status = self.write(
-            MemoryView(const_cast<void*>(reinterpret_cast<const void*>(data.data())), data.nbytes()));
+        const auto buffer = MemoryView(const_cast<void*>(reinterpret_cast<const void*>(data.data())), data.nbytes());
+        hailo_status status = HAILO_UNINITIALIZED;
+        {
+            py::gil_scoped_release release;
+            status = self.write(buffer);
+        }
+        VALIDATE_STATUS(status);
+    })
+    .def("send_many", [](InputVStream &self, py::array data)
+    {
+        // Sends all frames contained in data (frames are expected to be contiguous, batch dimension first)
+        const auto frame_size = self.get_frame_size();
+        const auto frames_count = get_frames_count(data, frame_size);
+        const auto base = static_cast<const uint8_t*>(data.data());
+        hailo_status status = HAILO_SUCCESS;
+        {
+            py::gil_scoped_release release;
+            for (size_t i = 0; (i < frames_count) && (HAILO_SUCCESS == status); i++) {
+                status = self.write(MemoryView::create_const(base + (i * frame_size), frame_size));
+            }
+        }
         VALIDATE_STATUS(status);
     })
     .def("flush", [](InputVStream &self)
     {
-        hailo_status status = self.flush();
+        hailo_status status = HAILO_UNINITIALIZED;
+        {
+            py::gil_scoped_release release;
+            status = self.flush();
+        }
         VALIDATE_STATUS(status);
     })
     .def_property_readonly("info", [](InputVStream &self)
@@ -152,20 +191,65 @@ void OutputVStreamWrapper::bind(py::module &m)
     py::class_<OutputVStream, std::shared_ptr<OutputVStream>>(m, "OutputVStream")
     .def("recv", [](OutputVStream &self)
     {
-        auto buffer = Buffer::create(self.get_frame_size());
-        VALIDATE_STATUS(buffer.status());
-
-        hailo_status status = self.read(MemoryView(buffer->data(), buffer->size()));
+        auto pool = RecvBuffersPool::get(self.get_frame_size());
+        BufferPtr buffer = nullptr;
+        hailo_status status = HAILO_UNINITIALIZED;
+        {
+            py::gil_scoped_release release;
+            buffer = pool->acquire();
+            status = (nullptr == buffer) ? HAILO_OUT_OF_HOST_MEMORY : self.read(MemoryView(*buffer));
+        }
+        if (HAILO_SUCCESS != status) {
+            if (nullptr != buffer) {
+                pool->release(buffer);
+            }
+            THROW_STATUS_ERROR(status);
+        }
+
+        // Note: The buffer is lent to Python wrapped as a py::array. When the py::array isn't referenced anymore
+        //       in Python and is destructed, the py::capsule's dtor is called and the buffer returns to the pool.
+        struct PooledBuffer {
+            std::shared_ptr<RecvBuffersPool> pool;
+            BufferPtr buffer;
+        };
+        auto pooled_buffer = new PooledBuffer{pool, buffer};
+        return py::array(get_dtype(self), get_shape(self), buffer->data(),
+            py::capsule(pooled_buffer, [](void *p) {
+                auto pooled = reinterpret_cast<PooledBuffer*>(p);
+                pooled->pool->release(pooled->buffer);
+                delete pooled;
+            }));
+    })
+    .def("recv_into", [](OutputVStream &self, py::array out)
+    {
+        const auto frame_size = self.get_frame_size();
+        if (1 != get_frames_count(out, frame_size)) {
+            std::cerr << "Array size (" << out.nbytes() << ") must match the frame size (" << frame_size << ")";
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+        const auto buffer = MemoryView(out.mutable_data(), frame_size);
+        hailo_status status = HAILO_UNINITIALIZED;
+        {
+            py::gil_scoped_release release;
+            status = self.read(buffer);
+        }
         VALIDATE_STATUS(status);
-
-        // Note: The ownership of the buffer is transferred to Python wrapped as a py::array.
-        //       When the py::array isn't referenced anymore in Python and is destructed, the py::capsule's dtor
-        //       is called too (and it deletes the raw buffer)
-        auto unmanaged_addr_exp = buffer->release();
-        VALIDATE_EXPECTED(unmanaged_addr_exp);
-        const auto unmanaged_addr = unmanaged_addr_exp.release();
-        return py::array(get_dtype(self), get_shape(self), unmanaged_addr,
-            py::capsule(unmanaged_addr, [](void *p) { delete reinterpret_cast<uint8_t*>(p); }));
+    })
+    .def("recv_many", [](OutputVStream &self, py::array out)
+    {
+        // Fills out with consecutive frames (batch dimension first), returns the number of frames read
+        const auto frame_size = self.get_frame_size();
+        const auto frames_count = get_frames_count(out, frame_size);
+        const auto base = static_cast<uint8_t*>(out.mutable_data());
+        hailo_status status = HAILO_SUCCESS;
+        {
+            py::gil_scoped_release release;
+            for (size_t i = 0; (i < frames_count) && (HAILO_SUCCESS == status); i++) {
+                status = self.read(MemoryView(base + (i * frame_size), frame_size));
+            }
+        }
+        VALIDATE_STATUS(status);
+        return frames_count;
     })
     .def("set_nms_score_threshold", [](OutputVStream &self, float32_t threshold)
     {
@@ -294,6 +378,48 @@ OutputVStreamsWrapper::OutputVStreamsWrapper(std::unordered_map<std::string, std
 #endif
 {}
 
+std::shared_ptr<RecvBuffersPool> RecvBuffersPool::get(size_t frame_size)
+{
+    static std::mutex pools_mutex;
+    static std::unordered_map<size_t, std::shared_ptr<RecvBuffersPool>> pools;
+
+    std::unique_lock<std::mutex> lock(pools_mutex);
+    auto &pool = pools[frame_size];
+    if (nullptr == pool) {
+        pool = std::make_shared<RecvBuffersPool>(frame_size);
+    }
+    return pool;
+}
+
+RecvBuffersPool::RecvBuffersPool(size_t frame_size) :
+    m_frame_size(frame_size)
+{
+    m_free_buffers.reserve(MAX_CACHED_BUFFERS);
+}
+
+BufferPtr RecvBuffersPool::acquire()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_free_buffers.empty()) {
+            auto buffer = m_free_buffers.back();
+            m_free_buffers.pop_back();
+            return buffer;
+        }
+    }
+
+    auto buffer = Buffer::create_shared(m_frame_size);
+    return buffer ? buffer.release() : nullptr;
+}
+
+void RecvBuffersPool::release(BufferPtr buffer)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_free_buffers.size() < MAX_CACHED_BUFFERS) {
+        m_free_buffers.emplace_back(std::move(buffer));
+    }
+}
+
 InferVStreamsWrapper InferVStreamsWrapper::create(ConfiguredNetworkGroupWrapper &network_group,
     const std::map<std::string, hailo_vstream_params_t> &input_vstreams_params,
     const std::map<std::string, hailo_vstream_params_t> &output_vstreams_params)
@@ -321,7 +447,11 @@ void InferVStreamsWrapper::infer(std::map<std::string, py::array> input_data, st
             static_cast<size_t>(name_pair.second.nbytes())));
     }
 
-    hailo_status status = m_infer_pipeline->infer(input_data_c, output_data_c, batch_size);
+    hailo_status status = HAILO_UNINITIALIZED;
+    {
+        py::gil_scoped_release release;
+        status = m_infer_pipeline->infer(input_data_c, output_data_c, batch_size);
+    }
     VALIDATE_STATUS(status);
 }
 
@@ -23,6 +23,8 @@
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
 
+#include <mutex>
+
 namespace hailort
 {
 
@@ -64,6 +66,27 @@ private:
 #endif
 };
 
+/**
+ * Pool of host buffers handed to Python by OutputVStream.recv(). A buffer returns to the pool when the numpy array
+ * wrapping it is garbage collected, so steady-state recv() doesn't allocate. Pools are shared per frame size.
+ */
+class RecvBuffersPool final
+{
+public:
+    static std::shared_ptr<RecvBuffersPool> get(size_t frame_size);
+
+    explicit RecvBuffersPool(size_t frame_size);
+    BufferPtr acquire();
+    void release(BufferPtr buffer);
+
+private:
+    static constexpr size_t MAX_CACHED_BUFFERS = 16;
+
+    const size_t m_frame_size;
+    std::mutex m_mutex;
+    std::vector<BufferPtr> m_free_buffers;
+};
+
 class OutputVStreamWrapper final
 {
 public:
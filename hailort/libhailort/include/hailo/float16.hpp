@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2020-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file float16.hpp
+ * @brief Half precision host types, matching ::HAILO_FORMAT_TYPE_FLOAT16 and ::HAILO_FORMAT_TYPE_BFLOAT16.
+ **/
+
+#ifndef _HAILO_FLOAT16_HPP_
+#define _HAILO_FLOAT16_HPP_
+
+#include "hailo/hailort.h"
+
+#include <cstring>
+#include <type_traits>
+
+// x86 builds don't target F16C (it isn't part of the baseline ISA), so only aarch64 has native conversions
+#if defined(__ARM_FP16_FORMAT_IEEE) && defined(__aarch64__)
+#define HAILO_FLOAT16_USE_ARM_FP16
+#endif
+
+/** hailort namespace */
+namespace hailort
+{
+
+/*! IEEE 754 half precision (binary16) value, used for ::HAILO_FORMAT_TYPE_FLOAT16 buffers */
+class Float16 final
+{
+public:
+    Float16() = default;
+
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    explicit Float16(T value) :
+        m_bits(from_float32(static_cast<float32_t>(value)))
+    {}
+
+    operator float32_t() const
+    {
+        return to_float32(m_bits);
+    }
+
+    uint16_t bits() const
+    {
+        return m_bits;
+    }
+
+    /**
+     * Converts a float32 value to its half precision representation (round to nearest even).
+     */
+    static inline uint16_t from_float32(float32_t value)
+    {
+#if defined(HAILO_FLOAT16_USE_ARM_FP16)
+        const __fp16 half = static_cast<__fp16>(value);
+        uint16_t bits = 0;
+        std::memcpy(&bits, &half, sizeof(bits));
+        return bits;
+#else
+        static const uint32_t F32_INFINITY = 255u << 23;
+        static const uint32_t F16_MAX = (127u + 16u) << 23;
+        static const uint32_t DENORM_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t bits = float32_bits(value);
+        const uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        uint16_t result = 0;
+        if (bits >= F16_MAX) {
+            // Inf or NaN (NaN is kept quiet)
+            result = (bits > F32_INFINITY) ? 0x7e00 : 0x7c00;
+        } else if (bits < (113u << 23)) {
+            // Result is subnormal or zero - let the FPU do the rounding
+            const float32_t shifted = bits_float32(bits) + bits_float32(DENORM_MAGIC);
+            result = static_cast<uint16_t>(float32_bits(shifted) - DENORM_MAGIC);
+        } else {
+            const uint32_t mantissa_odd = (bits >> 13) & 1u;
+            bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu;
+            bits += mantissa_odd;
+            result = static_cast<uint16_t>(bits >> 13);
+        }
+        return static_cast<uint16_t>(result | (sign >> 16));
+#endif
+    }
+
+    /**
+     * Converts a half precision representation to float32.
+     */
+    static inline float32_t to_float32(uint16_t half_bits)
+    {
+#if defined(HAILO_FLOAT16_USE_ARM_FP16)
+        __fp16 half;
+        std::memcpy(&half, &half_bits, sizeof(half_bits));
+        return static_cast<float32_t>(half);
+#else
+        static const uint32_t SHIFTED_EXPONENT = 0x7c00u << 13;
+        static const uint32_t MAGIC = 113u << 23;
+
+        uint32_t bits = (half_bits & 0x7fffu) << 13;
+        const uint32_t exponent = SHIFTED_EXPONENT & bits;
+        bits += static_cast<uint32_t>(127 - 15) << 23;
+        if (SHIFTED_EXPONENT == exponent) {
+            // Inf or NaN
+            bits += static_cast<uint32_t>(128 - 16) << 23;
+        } else if (0 == exponent) {
+            // Zero or subnormal - renormalize
+            bits += 1u << 23;
+            bits = float32_bits(bits_float32(bits) - bits_float32(MAGIC));
+        }
+        bits |= static_cast<uint32_t>(half_bits & 0x8000u) << 16;
+        return bits_float32(bits);
+#endif
+    }
+
+    static inline uint32_t float32_bits(float32_t value)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static inline float32_t bits_float32(uint32_t bits)
+    {
+        float32_t value = 0;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+private:
+    uint16_t m_bits;
+};
+
+/*! bfloat16 value (upper half of an IEEE 754 float32), used for ::HAILO_FORMAT_TYPE_BFLOAT16 buffers */
+class BFloat16 final
+{
+public:
+    BFloat16() = default;
+
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    explicit BFloat16(T value) :
+        m_bits(from_float32(static_cast<float32_t>(value)))
+    {}
+
+    operator float32_t() const
+    {
+        return to_float32(m_bits);
+    }
+
+    uint16_t bits() const
+    {
+        return m_bits;
+    }
+
+    /**
+     * Converts a float32 value to its bfloat16 representation (round to nearest even).
+     */
+    static inline uint16_t from_float32(float32_t value)
+    {
+        const uint32_t bits = Float16::float32_bits(value);
+        if ((bits & 0x7fffffffu) > 0x7f800000u) {
+            // Keep NaN quiet, so truncating the mantissa can't turn it into Inf
+            return static_cast<uint16_t>((bits >> 16) | 0x40u);
+        }
+        const uint32_t rounding_bias = 0x7fffu + ((bits >> 16) & 1u);
+        return static_cast<uint16_t>((bits + rounding_bias) >> 16);
+    }
+
+    /**
+     * Converts a bfloat16 representation to float32.
+     */
+    static inline float32_t to_float32(uint16_t bfloat_bits)
+    {
+        return Float16::bits_float32(static_cast<uint32_t>(bfloat_bits) << 16);
+    }
+
+private:
+    uint16_t m_bits;
+};
+
+static_assert(sizeof(Float16) == 2, "Float16 must be 2 bytes");
+static_assert(sizeof(BFloat16) == 2, "BFloat16 must be 2 bytes");
+
+} /* namespace hailort */
+
+#endif /* _HAILO_FLOAT16_HPP_ */
@@ -170,6 +170,8 @@ typedef uint16_t nms_bbox_counter_t;
     HAILO_STATUS__X(82, HAILO_QUEUE_IS_FULL                           /*!< Cannot push more items into the queue */)\
     HAILO_STATUS__X(83, HAILO_DMA_MAPPING_ALREADY_EXISTS              /*!< DMA mapping already exists */)\
     HAILO_STATUS__X(84, HAILO_CANT_MEET_BUFFER_REQUIREMENTS           /*!< can't meet buffer requirements */)\
+    HAILO_STATUS__X(85, HAILO_DEADLINE_EXPIRED                        /*!< Request deadline passed before it was sent to the device */)\
+    HAILO_STATUS__X(86, HAILO_REQUEST_DROPPED                         /*!< Request was dropped by the load shedding policy */)\
 
 typedef enum {
 #define HAILO_STATUS__X(value, name) name = value,
@@ -551,6 +553,12 @@ typedef enum {
     /** Data format type float32_t - used only on host side (Translated in the quantization process) */
     HAILO_FORMAT_TYPE_FLOAT32               = 3,
 
+    /** Data format type float16 (IEEE half precision) - used only on host side (Translated in the quantization process) */
+    HAILO_FORMAT_TYPE_FLOAT16               = 4,
+
+    /** Data format type bfloat16 - used only on host side (Translated in the quantization process) */
+    HAILO_FORMAT_TYPE_BFLOAT16              = 5,
+
     /** Max enum value to maintain ABI Integrity */
     HAILO_FORMAT_TYPE_MAX_ENUM              = HAILO_MAX_ENUM
 } hailo_format_type_t;
@@ -738,6 +746,24 @@ typedef enum {
      */
     HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK         = 20,
 
+    /**
+     * NMS_WITH_RLE_MASK format
+     *
+     * - Host side
+     *      \code
+     *      struct (packed) {
+     *          uint16_t detections_count;
+     *          hailo_detection_with_rle_mask_t[detections_count];
+     *      };
+     *      \endcode
+     *
+     *      Each ::hailo_detection_with_rle_mask_t is followed by its run-length counts (see ::hailo_detection_with_rle_mask_t).
+     *      The host format type supported ::HAILO_FORMAT_TYPE_FLOAT32.
+     *
+     * - Not used for device side
+     */
+    HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK          = 21,
+
     /** Max enum value to maintain ABI Integrity */
     HAILO_FORMAT_ORDER_MAX_ENUM             = HAILO_MAX_ENUM
 } hailo_format_order_t;
@@ -1290,7 +1316,9 @@ typedef struct {
     /** Maximum amount of bboxes per nms class */
     uint32_t max_bboxes_per_class;
     /** Maximum accumulated mask size for all of the detections in a frame.
-     *  Used only with 'HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK' format order.
+     *  Used only with 'HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK' and 'HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK' format orders.
+     *  With 'HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK' this is the budget (in bytes) for the run-length counts of all
+     *  of the detections, and each detection consumes only the size of its encoded mask.
      *  The default value is (`input_image_size` * 2)
      */
     uint32_t max_accumulated_mask_size;
@@ -1346,8 +1374,86 @@ typedef struct {
     */
     uint8_t *mask;
 } hailo_detection_with_byte_mask_t;
+
+typedef struct {
+    /** Detection's box coordinates */
+    hailo_rectangle_t box;
+
+    /** Detection's score */
+    float32_t score;
+
+    /** Detection's class id */
+    uint16_t class_id;
+
+    /** Mask height in pixels - ceil((box.y_max - box.y_min) * image_height) */
+    uint32_t mask_height;
+
+    /** Mask width in pixels - ceil((box.x_max - box.x_min) * image_width) */
+    uint32_t mask_width;
+
+    /** Number of elements in @a counts */
+    uint32_t counts_count;
+
+    /**
+     * Run-length encoded mask, compatible with the uncompressed COCO RLE format:
+     * The mask (of size mask_height x mask_width, located like the mask of ::hailo_detection_with_byte_mask_t) is
+     * scanned in column-major order, and @a counts holds the lengths of the alternating runs of background (0) and
+     * ROI (1) pixels, starting with a (possibly empty) background run.
+     *
+     * The counts array is placed after the detection struct, at the next offset (from the start of the frame) that is
+     * aligned to 4 bytes. The next detection starts right after the last element of the counts array.
+    */
+    uint32_t *counts;
+} hailo_detection_with_rle_mask_t;
 #pragma pack(pop)
 
+/** Host pre-processing parameters of an input */
+typedef struct {
+    /** Width of the source frames */
+    uint32_t src_width;
+
+    /** Height of the source frames */
+    uint32_t src_height;
+
+    /**
+     * Order of the source frames, of type ::HAILO_FORMAT_TYPE_UINT8. Supported orders are ::HAILO_FORMAT_ORDER_NHWC
+     * (RGB), ::HAILO_FORMAT_ORDER_NV12 (both planes in a single contiguous buffer) and ::HAILO_FORMAT_ORDER_YUY2.
+     */
+    hailo_format_order_t src_order;
+
+    /**
+     * If true, the aspect ratio of the source frame is kept, and the frame is padded (letterbox) to the input shape.
+     * Otherwise, the frame is stretched to the input shape.
+     */
+    bool keep_aspect_ratio;
+
+    /** Value of the padding pixels, used for all of the channels */
+    uint8_t padding_value;
+} hailo_pre_process_params_t;
+
+/**
+ * Describes how a source frame was placed in the model input by host pre-processing.
+ * A point (x, y) in the model input is mapped to ((x - pad_left) / scale_x, (y - pad_top) / scale_y) in the source frame.
+ */
+typedef struct {
+    /** Source frame width */
+    uint32_t src_width;
+    /** Source frame height */
+    uint32_t src_height;
+    /** Model input width */
+    uint32_t dst_width;
+    /** Model input height */
+    uint32_t dst_height;
+    /** Model input pixels per source pixel, in the x axis */
+    float32_t scale_x;
+    /** Model input pixels per source pixel, in the y axis */
+    float32_t scale_y;
+    /** Padding columns added to the left of the resized frame */
+    uint32_t pad_left;
+    /** Padding rows added above the resized frame */
+    uint32_t pad_top;
+} hailo_letterbox_info_t;
+
 /**
  * Completion info struct passed to the ::hailo_stream_write_async_callback_t after the async operation is
  * done or has failed.
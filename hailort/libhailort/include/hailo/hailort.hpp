@@ -22,6 +22,7 @@
 #include "hailo/vstream.hpp"
 #include "hailo/inference_pipeline.hpp"
 #include "hailo/infer_model.hpp"
+#include "hailo/post_process_plugin.hpp"
 #include "hailo/transform.hpp"
 #include "hailo/expected.hpp"
 #include "hailo/buffer.hpp"
@@ -14,6 +14,7 @@
 #include "hailo/expected.hpp"
 #include "hailo/buffer.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <chrono>
 #include <string>
@@ -36,6 +37,9 @@ public:
         "Mismatch bbox params size");
     static const uint32_t BBOX_PARAMS = sizeof(hailo_bbox_t) / sizeof(uint16_t);
     static const uint32_t DETECTION_WITH_BYTE_MASK_SIZE = sizeof(hailo_detection_with_byte_mask_t);
+    static const uint32_t DETECTION_WITH_RLE_MASK_SIZE = sizeof(hailo_detection_with_rle_mask_t);
+    // Worst case padding inserted before each detection's counts array, to keep it aligned to 4 bytes
+    static const uint32_t RLE_MASK_COUNTS_MAX_PADDING = sizeof(uint32_t) - 1;
     static const uint32_t MAX_DEFUSED_LAYER_COUNT = 9;
     static const size_t HW_DATA_ALIGNMENT = 8;
     static const uint32_t MUX_INFO_COUNT = 32;
@@ -96,6 +100,28 @@ public:
         return reinterpret_cast<void *>(align_to(reinterpret_cast<uintptr_t>(addr), alignment));
     }
 
+    /**
+     * Maps a box in normalized model input coordinates (such as NMS outputs) to normalized source frame coordinates.
+     *
+     * @param[in] box             The box to map.
+     * @param[in] letterbox_info  The letterbox info of the input the box was detected on.
+     * @return The mapped box, clipped to the source frame.
+     */
+    static hailo_rectangle_t map_box_to_source_frame(const hailo_rectangle_t &box, const hailo_letterbox_info_t &letterbox_info)
+    {
+        auto map_coordinate = [](float32_t coordinate, uint32_t dst_size, uint32_t pad, float32_t scale, uint32_t src_size) {
+            auto mapped = ((coordinate * static_cast<float32_t>(dst_size)) - static_cast<float32_t>(pad)) / (scale * static_cast<float32_t>(src_size));
+            return std::min(std::max(mapped, 0.0f), 1.0f);
+        };
+
+        hailo_rectangle_t result{};
+        result.y_min = map_coordinate(box.y_min, letterbox_info.dst_height, letterbox_info.pad_top, letterbox_info.scale_y, letterbox_info.src_height);
+        result.x_min = map_coordinate(box.x_min, letterbox_info.dst_width, letterbox_info.pad_left, letterbox_info.scale_x, letterbox_info.src_width);
+        result.y_max = map_coordinate(box.y_max, letterbox_info.dst_height, letterbox_info.pad_top, letterbox_info.scale_y, letterbox_info.src_height);
+        result.x_max = map_coordinate(box.x_max, letterbox_info.dst_width, letterbox_info.pad_left, letterbox_info.scale_x, letterbox_info.src_width);
+        return result;
+    }
+
     /**
      * Gets the shape size.
      *
@@ -120,7 +146,8 @@ public:
     {
         if (type == HAILO_FORMAT_TYPE_FLOAT32) {
             return 4;
-        } else if (type == HAILO_FORMAT_TYPE_UINT16) {
+        } else if ((type == HAILO_FORMAT_TYPE_UINT16) || (type == HAILO_FORMAT_TYPE_FLOAT16) ||
+            (type == HAILO_FORMAT_TYPE_BFLOAT16)) {
             return 2;
         } else if (type == HAILO_FORMAT_TYPE_UINT8) {
             return 1;
@@ -129,6 +156,19 @@ public:
         return 1;
     }
 
+    /**
+     * Indicates whether the format type is a floating point type. Floating point types are supported only on the
+     * host side, and are translated in the quantization process.
+     *
+     * @param[in] type             A ::hailo_format_type_t object.
+     * @return true if @a type is a floating point type, false otherwise.
+     */
+    static constexpr bool is_float_format_type(hailo_format_type_t type)
+    {
+        return (HAILO_FORMAT_TYPE_FLOAT32 == type) || (HAILO_FORMAT_TYPE_FLOAT16 == type) ||
+            (HAILO_FORMAT_TYPE_BFLOAT16 == type);
+    }
+
     /**
      * Gets the format type of a stream by the hw data bytes parameter.
      *
@@ -164,6 +204,10 @@ public:
             return "UINT16";
         case HAILO_FORMAT_TYPE_FLOAT32:
             return "FLOAT32";
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return "FLOAT16";
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            return "BFLOAT16";
         case HAILO_FORMAT_TYPE_AUTO:
             return "AUTO";
         default:
@@ -250,6 +294,8 @@ public:
             return "YYYYUV";
         case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK:
             return "HAILO NMS WITH BYTE MASK";
+        case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK:
+            return "HAILO NMS WITH RLE MASK";
         default:
             return "Nan";
         }
@@ -302,6 +348,22 @@ public:
         return frame_size;
     }
 
+    /**
+     * Gets `HAILO_NMS_WITH_RLE_MASK` host frame size in bytes by nms_shape.
+     *
+     * @param[in] nms_shape             The NMS shape to get size from.
+     * @return The HAILO_NMS_WITH_RLE_MASK host frame size.
+     */
+    static constexpr uint32_t get_nms_with_rle_mask_host_frame_size(const hailo_nms_shape_t &nms_shape)
+    {
+        // TODO: HRT-12035 - Change `max_bboxes_per_class` to `max_boxes`
+        auto max_detections = nms_shape.number_of_classes * nms_shape.max_bboxes_per_class;
+        auto max_detections_size = max_detections * (DETECTION_WITH_RLE_MASK_SIZE + RLE_MASK_COUNTS_MAX_PADDING);
+        auto frame_size = sizeof(uint16_t) + max_detections_size + nms_shape.max_accumulated_mask_size;
+        // Keep the frame size a multiple of the (FLOAT32) format type size
+        return static_cast<uint32_t>(align_to(frame_size, sizeof(float32_t)));
+    }
+
     /**
      * Gets NMS hw frame size in bytes by nms info.
      *
@@ -411,7 +473,12 @@ public:
 
     static constexpr bool is_nms(const hailo_format_order_t &order)
     {
-        return ((HAILO_FORMAT_ORDER_HAILO_NMS == order) || (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == order));
+        return ((HAILO_FORMAT_ORDER_HAILO_NMS == order) || is_nms_with_mask(order));
+    }
+
+    static constexpr bool is_nms_with_mask(const hailo_format_order_t &order)
+    {
+        return ((HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == order) || (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK == order));
     }
 
     // TODO HRT-10073: change to supported features list
@@ -13,6 +13,7 @@
 #include "hailo/network_group.hpp"
 #include "hailo/hef.hpp"
 #include "hailo/vdevice.hpp"
+#include "hailo/post_process_plugin.hpp"
 
 /** hailort namespace */
 namespace hailort
@@ -61,6 +62,104 @@ struct AsyncInferCompletionInfo;
 
 static const auto ASYNC_INFER_EMPTY_CALLBACK = [](const AsyncInferCompletionInfo&) {};
 
+/** Parameters of the inference result cache of a ConfiguredInferModel */
+struct HAILORTAPI InferResultCacheParams
+{
+    /** Maximum number of cached results. The least recently used result is evicted when the cache is full. */
+    size_t capacity = 16;
+
+    /** Time after which a cached result is no longer used. Zero means results never expire. */
+    std::chrono::milliseconds ttl = std::chrono::milliseconds(0);
+
+    /**
+     * If true, a result is reused only if the inputs are identical to the inputs of the previous request
+     * (i.e. repeated frames are skipped), and @a capacity is ignored.
+     */
+    bool previous_frame_only = false;
+};
+
+/** Statistics of the inference result cache of a ConfiguredInferModel */
+struct HAILORTAPI InferResultCacheStats
+{
+    /** Number of requests that were completed using a cached result */
+    uint64_t hits = 0;
+
+    /** Number of cacheable requests that were sent to the device */
+    uint64_t misses = 0;
+
+    /** Number of requests that were sent to the device since their buffers can't be cached (e.g. DMA buffers) */
+    uint64_t bypassed = 0;
+
+    /** Number of results that were evicted, or dropped after @a ttl has passed */
+    uint64_t evictions = 0;
+
+    /** Number of currently cached results */
+    size_t entries = 0;
+
+    /**
+     * @return The ratio of hits out of the cacheable requests.
+     */
+    float64_t hit_rate() const
+    {
+        const auto lookups = hits + misses;
+        return (0 == lookups) ? 0.0 : (static_cast<float64_t>(hits) / static_cast<float64_t>(lookups));
+    }
+};
+
+/** Policy for dropping requests when the admission queue of a ConfiguredInferModel reaches its watermark */
+enum class InferSheddingPolicy
+{
+    /** The oldest waiting request is dropped, in favor of the new one (prefers fresh frames, e.g. for live video) */
+    DROP_OLDEST = 0,
+
+    /** The new request is dropped (prefers complete sequences) */
+    DROP_NEWEST,
+
+    /**
+     * While the queue is at the watermark, only every @a keep_every_nth request is kept (dropping the oldest waiting
+     * request instead), the others are dropped. Keeps a reduced, evenly spaced frame rate under overload.
+     */
+    KEEP_EVERY_NTH
+};
+
+/** Parameters of the admission control of a ConfiguredInferModel */
+struct HAILORTAPI InferAdmissionParams
+{
+    /** Maximum number of requests waiting for room in the inference pipeline. Must be at least 1. */
+    size_t watermark = 4;
+
+    /** Policy applied to new requests when @a watermark requests are already waiting. */
+    InferSheddingPolicy shedding_policy = InferSheddingPolicy::DROP_OLDEST;
+
+    /** Used by InferSheddingPolicy::KEEP_EVERY_NTH. Must be at least 1. */
+    uint32_t keep_every_nth = 2;
+
+    /**
+     * Deadline of requests launched without an explicit deadline, relative to their launch time. Zero means such
+     * requests have no deadline.
+     */
+    std::chrono::milliseconds default_deadline = std::chrono::milliseconds(0);
+};
+
+/** Statistics of the admission control of a ConfiguredInferModel */
+struct HAILORTAPI InferAdmissionStats
+{
+    /** Number of requests that were sent to the inference pipeline */
+    uint64_t launched = 0;
+
+    /** Number of requests that were completed with ::HAILO_DEADLINE_EXPIRED */
+    uint64_t expired = 0;
+
+    /** Number of requests that were completed with ::HAILO_REQUEST_DROPPED */
+    uint64_t shed = 0;
+
+    /** Number of requests currently waiting for room in the inference pipeline */
+    size_t pending = 0;
+
+    /** Maximal number of requests that were waiting at the same time */
+    size_t max_pending = 0;
+};
+
 /*! Configured infer_model that can be used to perform an asynchronous inference */
 class HAILORTAPI ConfiguredInferModel
 {
@@ -312,6 +411,23 @@ public:
     Expected<AsyncInferJob> run_async(const std::vector<Bindings> &bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
 
+    /**
+     * Launches an asynchronous inference operation with the provided bindings, that must be sent to the device before
+     * @a deadline. Requests whose deadline passes while waiting for room in the inference pipeline are not sent to the
+     * device, and are completed with ::HAILO_DEADLINE_EXPIRED.
+     *
+     * @param[in] bindings           The bindings for the inputs and outputs of the model.
+     * @param[in] deadline           The time by which the request must be sent to the device.
+     * @param[in] callback           The function to be called upon completion of the asynchronous inference operation.
+     *
+     * @return Upon success, returns an instance of Expected<AsyncInferJob> representing the launched job.
+     *  Otherwise, returns Unexpected of ::hailo_status error, and the interface shuts down completly.
+     * @note Requires admission control (see enable_admission_control()).
+     * @note The bindings' buffers should be kept intact until the async job is completed.
+     */
+    Expected<AsyncInferJob> run_async(const Bindings &bindings, std::chrono::steady_clock::time_point deadline,
+        std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
+
     /**
     * @return Upon success, returns Expected of LatencyMeasurementResult object containing the output latency result.
     *  Otherwise, returns Unexpected of ::hailo_status error.
@@ -370,6 +486,85 @@ public:
      */
     hailo_status shutdown();
 
+    /**
+     * Enables the inference result cache. Requests whose inputs are identical to the inputs of a cached request are not
+     * sent to the device - the cached outputs are copied to the bound output buffers, and the completion callback is
+     * called with ::HAILO_SUCCESS.
+     * Requests are matched by a 64 bit hash of their input buffers.
+     * Calling this function again replaces the cache (and its statistics) with a new one.
+     *
+     * @param[in] params           The cache parameters.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Only bindings whose buffers are all set using set_buffer() are cached. Other requests are always sent to the device.
+     * @note Callbacks of requests completed from the cache are called from an internal thread, and may be called before
+     *  callbacks of requests that were launched earlier and are still running on the device.
+     * @note Not supported when the device is accessed over hrpc.
+     */
+    hailo_status enable_result_cache(const InferResultCacheParams &params = InferResultCacheParams());
+
+    /**
+     * Disables the inference result cache, and drops all cached results.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    hailo_status disable_result_cache();
+
+    /**
+     * @return Upon success, returns Expected of InferResultCacheStats.
+     *  Otherwise, returns Unexpected of ::hailo_status error.
+     * @note If the cache is not enabled, returns ::HAILO_INVALID_OPERATION.
+     */
+    Expected<InferResultCacheStats> get_result_cache_stats();
+
+    /**
+     * Enables admission control. Instead of failing with ::HAILO_QUEUE_IS_FULL when the inference pipeline is full,
+     * requests wait in a bounded admission queue, and are sent to the pipeline as room is freed (the pipeline's queues
+     * are sized by the device streams and the scheduler queues, see get_async_queue_size()).
+     * When @a params.watermark requests are waiting, new requests are shed by @a params.shedding_policy - the dropped
+     * requests are completed with ::HAILO_REQUEST_DROPPED. Waiting requests whose deadline has passed are completed
+     * with ::HAILO_DEADLINE_EXPIRED.
+     * Dropped requests are never sent to the device.
+     *
+     * @param[in] params           The admission control parameters.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note While enabled, wait_for_async_ready() returns immediately.
+     * @note Callbacks of dropped requests are called from an internal thread, and may be called before callbacks of
+     *  requests that were launched earlier.
+     * @note Calling this function again replaces the parameters, and resets the statistics. Requests that are waiting
+     *  at that time are completed with ::HAILO_REQUEST_DROPPED.
+     * @note Not supported when the device is accessed over hrpc.
+     */
+    hailo_status enable_admission_control(const InferAdmissionParams &params = InferAdmissionParams());
+
+    /**
+     * Disables admission control. Requests that are still waiting are completed with ::HAILO_REQUEST_DROPPED.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    hailo_status disable_admission_control();
+
+    /**
+     * @return Upon success, returns Expected of InferAdmissionStats.
+     *  Otherwise, returns Unexpected of ::hailo_status error.
+     * @note If admission control is not enabled, returns ::HAILO_INVALID_OPERATION.
+     */
+    Expected<InferAdmissionStats> get_admission_stats();
+
+    /**
+     * Updates the NMS thresholds of several outputs in a single call, while inference is running.
+     * Each NMS post-process applies the update from its next frame, without stalling the inference - a frame is
+     * processed either with the previous thresholds or with the updated ones.
+     * All the updates are validated before any of them is applied.
+     *
+     * @param[in] updates    Map of output name to the update of its NMS thresholds.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note If the result cache is enabled (see enable_result_cache()), it is cleared.
+     * @note The maximum number of boxes per class changes the output frame size, so it can only be set on the
+     *  InferModel::InferStream before configuring.
+     * @note Not supported when the device is accessed over hrpc.
+     */
+    hailo_status update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates);
+
 private:
     friend class InferModelBase;
     friend class ConfiguredInferModelBase;
@@ -394,6 +589,8 @@ struct HAILORTAPI AsyncInferCompletionInfo
     /**
      * Status of the asynchronous inference operation.
      * - ::HAILO_SUCCESS - When the inference operation is complete successfully.
+     * - ::HAILO_DEADLINE_EXPIRED or ::HAILO_REQUEST_DROPPED - When the request was dropped by the admission control
+     *   (see ConfiguredInferModel::enable_admission_control).
      * - Any other ::hailo_status on unexpected errors.
      */
     hailo_status status;
@@ -505,6 +702,26 @@ public:
          */
         void set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size);
 
+        /**
+         * Enables host pre-processing of the input.
+         * Source frames of any size, in one of the orders listed in ::hailo_pre_process_params_t, are resized
+         * (optionally keeping the aspect ratio, with letterbox padding), color converted and written straight to the
+         * buffer that is sent to the device. After calling this function, get_frame_size() returns the size of a source frame.
+         *
+         * @param[in] params          The pre-processing parameters.
+         * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+         * @note Supported only for single-plane, 3-channel inputs, and not when the device is accessed over hrpc.
+         */
+        hailo_status set_pre_process(const hailo_pre_process_params_t &params);
+
+        /**
+         * @return Upon success, returns Expected of ::hailo_letterbox_info_t, used to map outputs (for example NMS boxes,
+         * using HailoRTCommon::map_box_to_source_frame()) back to the source frame coordinates.
+         * Otherwise, returns Unexpected of ::hailo_status error.
+         * @note If pre-processing was not enabled using set_pre_process(), returns ::HAILO_INVALID_OPERATION.
+         */
+        Expected<hailo_letterbox_info_t> get_letterbox_info() const;
+
     private:
         friend class InferModelBase;
         friend class InferModelHrpcClient;
@@ -616,6 +833,30 @@ public:
      */
     virtual const std::vector<std::string> &get_output_names() const = 0;
 
+    /**
+     * Adds a user defined post-processing op to the InferModel (see PostProcessPlugin).
+     * The outputs consumed by the plugin are replaced by the plugin's output (named PostProcessPlugin::name()), so
+     * outputs(), get_output_names() and the bindings of the ConfiguredInferModel change accordingly.
+     *
+     * @param[in] plugin          The plugin to add.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Must be called before configure(). The plugin's output format can't be changed.
+     * @note Not supported when working with a remote device.
+     */
+    virtual hailo_status add_post_process_plugin(PostProcessPluginPtr plugin) = 0;
+
+    /**
+     * Loads a post-processing plugin from a shared library, and adds it to the InferModel
+     * (see add_post_process_plugin(PostProcessPluginPtr)).
+     * The library must export the ::HAILO_POST_PROCESS_PLUGIN_CREATE_FUNC_NAME function (see
+     * ::HAILO_EXPORT_POST_PROCESS_PLUGIN). The library stays loaded as long as the plugin is in use.
+     *
+     * @param[in] library_path    Path to the plugin's shared library.
+     * @param[in] config          Plugin specific configuration string, passed to the plugin's create function.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    virtual hailo_status add_post_process_plugin(const std::string &library_path, const std::string &config = "") = 0;
+
     virtual Expected<ConfiguredInferModel> configure_for_ut(std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
         const std::unordered_map<std::string, size_t> inputs_frame_sizes = {},
@@ -17,6 +17,8 @@
 namespace hailort
 {
 
+class HailoThreadPool;
+
 /*! Pipeline used to run inference */
 // TODO: HRT-3157 - Fix doc after multi-network support.
 class HAILORTAPI InferVStreams final
@@ -52,6 +54,8 @@ public:
      * @note The size of each element in @a input_data and @a output_data must match the frame size
      *       of the matching vstream name multiplied by @a frames_count.
      * @note If at least one input/output of some network is present, all inputs and outputs of that network must also be present.
+     * @note The reads and writes are performed on worker threads owned by this object, so no threads are created per call.
+     *       Calling this function concurrently on the same InferVStreams object is not supported.
      */
     hailo_status infer(const std::map<std::string, MemoryView>& input_data,
                        std::map<std::string, MemoryView>& output_data, size_t frames_count);
@@ -123,6 +127,16 @@ public:
      */
     hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size);
 
+    /**
+     * Updates the NMS thresholds of several outputs in a single call. Can be called during inference.
+     * All the updates are validated before any of them is applied.
+     *
+     * @param[in] updates    Map of output vstream name to the update of its NMS thresholds.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note This function will fail if any of the given outputs has no NMS operations on the CPU.
+     */
+    hailo_status update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates);
+
     InferVStreams(const InferVStreams &other) = delete;
     InferVStreams &operator=(const InferVStreams &other) = delete;
     InferVStreams &operator=(InferVStreams &&other) = delete;
@@ -133,7 +147,8 @@ public:
         m_is_scheduled(std::move(other.m_is_scheduled)),
         m_network_name_to_input_count(std::move(other.m_network_name_to_input_count)),
         m_network_name_to_output_count(std::move(other.m_network_name_to_output_count)),
-        m_batch_size(std::move(other.m_batch_size))
+        m_batch_size(std::move(other.m_batch_size)),
+        m_workers(std::move(other.m_workers))
         {};
 private:
     InferVStreams(std::vector<InputVStream> &&inputs, std::vector<OutputVStream> &&outputs, bool is_multi_context,
@@ -152,6 +167,8 @@ private:
     std::map<std::string, size_t> m_network_name_to_input_count;
     std::map<std::string, size_t> m_network_name_to_output_count;
     uint16_t m_batch_size;
+    // Persistent workers (one per vstream) used by infer(), so no threads are created per call. Created on the first call.
+    std::shared_ptr<HailoThreadPool> m_workers;
 };
 
 } /* namespace hailort */
@@ -72,6 +72,19 @@ struct LatencyMeasurementResult {
     std::chrono::nanoseconds avg_hw_latency;
 };
 
+/**
+ * NMS thresholds of a single NMS output, applied together by the update_nms_config() functions.
+ * The update takes effect from the next frame processed by the NMS post-process - a frame is never processed with
+ * a partially applied update.
+ */
+struct NmsConfigUpdate {
+    /** NMS score threshold. Any box with score<TH is suppressed. A negative value keeps the current threshold. */
+    float32_t score_threshold = -1.0f;
+
+    /** NMS IoU threshold. A negative value keeps the current threshold. */
+    float32_t iou_threshold = -1.0f;
+};
+
 struct HwInferResults {
     uint16_t batch_count;
     size_t total_transfer_size;
@@ -453,6 +466,14 @@ public:
     virtual hailo_status set_nms_iou_threshold(const std::string &edge_name, float32_t iou_threshold) = 0;
     virtual hailo_status set_nms_max_bboxes_per_class(const std::string &edge_name, uint32_t max_bboxes_per_class) = 0;
     virtual hailo_status set_nms_max_accumulated_mask_size(const std::string &edge_name, uint32_t max_accumulated_mask_size) = 0;
+    /**
+     * Updates the NMS thresholds of several NMS outputs in a single call.
+     * All the updates are validated before any of them is applied.
+     *
+     * @param[in] updates    Map of output (edge) name to the update of its NMS thresholds.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    virtual hailo_status update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates) = 0;
 
     virtual hailo_status init_cache(uint32_t read_offset, int32_t write_offset_delta) = 0;
     virtual Expected<hailo_cache_info_t> get_cache_info() const = 0;
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file post_process_plugin.hpp
+ * @brief User defined post-processing ops, running inside the InferModel's pipeline
+ **/
+
+#ifndef _HAILO_POST_PROCESS_PLUGIN_HPP_
+#define _HAILO_POST_PROCESS_PLUGIN_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+/** hailort namespace */
+namespace hailort
+{
+
+/*! Version of the PostProcessPlugin interface, passed to the plugin's create function when loaded from a library. */
+#define HAILO_POST_PROCESS_PLUGIN_API_VERSION (1)
+
+/*! Name of the create function a plugin library must export (see ::hailo_create_post_process_plugin_func_t). */
+#define HAILO_POST_PROCESS_PLUGIN_CREATE_FUNC_NAME "hailo_create_post_process_plugin"
+
+/*! Description of a plugin's input, as given by the device. */
+struct PostProcessPluginInputInfo {
+    /** Name of the device output stream feeding the input */
+    std::string stream_name;
+    /** Logical shape of the data */
+    hailo_3d_image_shape_t shape;
+    /** Shape of the buffers given to PostProcessPlugin::execute (may be padded) */
+    hailo_3d_image_shape_t hw_shape;
+    /** Format of the buffers given to PostProcessPlugin::execute (quantized, as written by the device) */
+    hailo_format_t format;
+    /** Quantization info of the data */
+    hailo_quant_info_t quant_info;
+    /** Size of the buffers given to PostProcessPlugin::execute */
+    size_t frame_size;
+};
+
+/**
+ * A user defined post-processing op, running inside the InferModel's pipeline (see InferModel::add_post_process_plugin).
+ *
+ * The plugin consumes raw outputs of the model, and produces a single new output named PostProcessPlugin::name().
+ * The consumed outputs are removed from the InferModel outputs (together with any other output sharing their device
+ * streams), and the plugin's output is added instead.
+ *
+ * The plugin runs on the pipeline's threads, on zero-copy views of the device buffers, writing directly into the
+ * buffer bound to its output - so it is not serialized with the user's callback, and no extra copy is needed.
+ */
+class HAILORTAPI PostProcessPlugin
+{
+public:
+    virtual ~PostProcessPlugin() = default;
+
+    /**
+     * @return The name of the output produced by the plugin. Must not collide with the model's inputs and outputs.
+     */
+    virtual std::string name() const = 0;
+
+    /**
+     * @return The names of the inputs consumed by the plugin - each is either a model output name (see
+     *  InferModel::get_output_names) backed by a single device stream, or a device output stream name.
+     */
+    virtual std::vector<std::string> input_names() const = 0;
+
+    /**
+     * Called once, when the plugin is added to an InferModel.
+     *
+     * @param[in] inputs_info     The info of each input, by the names returned from input_names().
+     * @return Upon success, returns Expected of the frame size of the plugin's output. Otherwise, returns Unexpected of
+     *  ::hailo_status error, and the plugin is not added.
+     */
+    virtual Expected<size_t> configure(const std::map<std::string, PostProcessPluginInputInfo> &inputs_info) = 0;
+
+    /**
+     * Processes a single frame.
+     *
+     * @param[in] inputs          Read-only views of the inputs' device buffers, by the names returned from input_names().
+     * @param[in] output          The output buffer, of the size returned from configure().
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error, which fails the frame.
+     * @note Called from the pipeline's threads, one frame at a time. The input views are valid only during the call.
+     */
+    virtual hailo_status execute(const std::map<std::string, MemoryView> &inputs, MemoryView output) = 0;
+};
+
+using PostProcessPluginPtr = std::shared_ptr<PostProcessPlugin>;
+
+} /* namespace hailort */
+
+/**
+ * The create function exported by a plugin library (named ::HAILO_POST_PROCESS_PLUGIN_CREATE_FUNC_NAME).
+ *
+ * @param[in] api_version     The ::HAILO_POST_PROCESS_PLUGIN_API_VERSION of the loading library.
+ * @param[in] config          Plugin specific configuration string (may be empty).
+ * @return A new plugin object (owned by the caller, and deleted before the library is unloaded), or NULL on failure.
+ * @note The library must be built against the same HailoRT version as the loading application.
+ */
+extern "C" typedef hailort::PostProcessPlugin *(*hailo_create_post_process_plugin_func_t)(uint32_t api_version,
+    const char *config);
+
+#if defined(_MSC_VER)
+#define _HAILO_POST_PROCESS_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define _HAILO_POST_PROCESS_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+/**
+ * Defines the create function of a plugin library, constructing PluginClass from the config string.
+ * Use once, in a source file of the plugin library.
+ */
+#define HAILO_EXPORT_POST_PROCESS_PLUGIN(PluginClass)                                                               \
+    extern "C" _HAILO_POST_PROCESS_PLUGIN_EXPORT hailort::PostProcessPlugin *hailo_create_post_process_plugin(      \
+        uint32_t api_version, const char *config)                                                                   \
+    {                                                                                                               \
+        if (HAILO_POST_PROCESS_PLUGIN_API_VERSION != api_version) {                                                 \
+            return nullptr;                                                                                         \
+        }                                                                                                           \
+        return new (std::nothrow) PluginClass(std::string((nullptr != config) ? config : ""));                      \
+    }
+
+#endif /* _HAILO_POST_PROCESS_PLUGIN_HPP_ */
@@ -12,6 +12,7 @@
 
 #include "hailo/hailort.h"
 #include "hailo/hailort_common.hpp"
+#include "hailo/float16.hpp"
 
 #include <math.h>
 #include <fenv.h>
@@ -171,6 +171,8 @@ private:
         MemoryView transpose_buffer);
 
     hailo_status quantize_stream(const void *src_ptr, void *quant_buffer);
+    template<typename T>
+    hailo_status quantize_float_stream(const T *src_ptr, void *quant_buffer, uint32_t shape_size);
 
     const size_t m_src_frame_size;
     const hailo_3d_image_shape_t m_src_image_shape;
@@ -186,6 +188,10 @@ private:
 
     Buffer m_quant_buffer;
     Buffer m_transpose_buffer;
+    // Reorder kernel specialized for the context formats and shapes, resolved on creation. nullptr if the generic
+    // reorder is used.
+    void (*m_reorder_kernel)(const void *src_ptr, const hailo_3d_image_shape_t &src_image_shape, void *dst_ptr,
+        const hailo_3d_image_shape_t &dst_image_shape);
 };
 
 /*! Object used for output stream transformation*/
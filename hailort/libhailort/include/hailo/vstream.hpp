@@ -370,6 +370,15 @@ public:
      */
     hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size);
 
+    /**
+     * Updates the NMS score and IoU thresholds together. Can be called during inference - the frames are processed
+     * either with the previous thresholds or with the updated ones, and the inference isn't stalled by the update.
+     *
+     * @param[in] update    The thresholds to update.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note This function will fail in cases where the output vstream has no NMS operations on the CPU.
+     */
+    hailo_status update_nms_config(const NmsConfigUpdate &update);
 
     bool is_aborted();
 
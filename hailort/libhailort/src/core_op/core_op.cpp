@@ -27,10 +27,21 @@
 namespace hailort
 {
 
+static std::unordered_map<std::string, stream_index_t> intern_stream_names(const ConfigureNetworkParams &config_params)
+{
+    std::unordered_map<std::string, stream_index_t> stream_name_to_index;
+    for (const auto &name_params_pair : config_params.stream_params_by_name) {
+        const auto stream_index = static_cast<stream_index_t>(stream_name_to_index.size());
+        stream_name_to_index.emplace(name_params_pair.first, stream_index);
+    }
+    return stream_name_to_index;
+}
+
 CoreOp::CoreOp(
     const ConfigureNetworkParams &config_params, std::shared_ptr<CoreOpMetadata> metadata,
     ActiveCoreOpHolder &active_core_op_holder, hailo_status &status, bool is_scheduled) :
         m_config_params(config_params),
+        m_stream_name_to_index(intern_stream_names(config_params)),
         m_active_core_op_holder(active_core_op_holder),
         m_min_configured_batch_size(get_smallest_configured_batch_size(config_params)),
         m_activation_time_accumulator(),
@@ -219,6 +230,19 @@ bool CoreOp::is_nms()
     return false;
 }
 
+// Returns the stream index of each stream in the given map, in the map order
+template<typename StreamsMap>
+static std::vector<stream_index_t> get_streams_indices(const StreamsMap &streams,
+    const std::unordered_map<std::string, stream_index_t> &stream_name_to_index)
+{
+    std::vector<stream_index_t> streams_indices;
+    streams_indices.reserve(streams.size());
+    for (const auto &name_stream_pair : streams) {
+        streams_indices.push_back(stream_name_to_index.at(name_stream_pair.first));
+    }
+    return streams_indices;
+}
+
 hailo_status CoreOp::add_input_stream(std::shared_ptr<InputStreamBase> &&stream,
     const hailo_stream_parameters_t &stream_params)
 {
@@ -232,7 +256,10 @@ hailo_status CoreOp::add_input_stream(std::shared_ptr<InputStreamBase> &&stream,
         CHECK_SUCCESS(status);
     }
 
+    CHECK(contains(m_stream_name_to_index, stream->name()), HAILO_INTERNAL_FAILURE,
+        "Stream {} is missing from the configure params", stream->name());
     m_input_streams.emplace(stream->name(), std::move(stream));
+    m_input_streams_indices = get_streams_indices(m_input_streams, m_stream_name_to_index);
     return HAILO_SUCCESS;
 }
 
@@ -249,7 +276,10 @@ hailo_status CoreOp::add_output_stream(std::shared_ptr<OutputStreamBase> &&strea
         CHECK_SUCCESS(status);
     }
 
+    CHECK(contains(m_stream_name_to_index, stream->name()), HAILO_INTERNAL_FAILURE,
+        "Stream {} is missing from the configure params", stream->name());
     m_output_streams.emplace(stream->name(), std::move(stream));
+    m_output_streams_indices = get_streams_indices(m_output_streams, m_stream_name_to_index);
     return HAILO_SUCCESS;
 }
 
@@ -420,9 +450,17 @@ Expected<size_t> CoreOp::get_async_max_queue_size() const
     return queue_size;
 }
 
+Expected<stream_index_t> CoreOp::get_stream_index(const std::string &stream_name) const
+{
+    auto it = m_stream_name_to_index.find(stream_name);
+    CHECK_AS_EXPECTED(it != m_stream_name_to_index.end(), HAILO_NOT_FOUND, "Stream {} not found", stream_name);
+    return Expected<stream_index_t>(it->second);
+}
+
 hailo_status CoreOp::infer_async(InferRequest &&request)
 {
     assert(request.transfers.size() == (m_input_streams.size() + m_output_streams.size()));
+    assert(request.transfers.streams_count() == streams_count());
 
     // To optimize allocation on runtime, we can use some fixed slab-allocator
     auto state = make_shared_nothrow<OngoingInferState>();
@@ -434,9 +472,9 @@ hailo_status CoreOp::infer_async(InferRequest &&request)
     auto status = infer_async_impl(transfers_copy, state, request.callback);
     if (HAILO_SUCCESS != status) {
         // infer_async_impl remove all launched transfers from transfer_copy. Here, we finish all callbacks left
-        for (auto &transfer : transfers_copy) {
-            transfer.second.callback(status);
-        }
+        transfers_copy.for_each([status](stream_index_t, TransferRequest &transfer) {
+            transfer.callback(status);
+        });
         // Note: See `CoreOp::infer_async` docs
         return HAILO_SUCCESS;
     }
@@ -495,43 +533,47 @@ Expected<std::shared_ptr<InputStreamBase>> CoreOp::create_input_stream_from_conf
     return input_stream;
 }
 
-hailo_status CoreOp::infer_async_impl(std::unordered_map<std::string, TransferRequest> &transfers,
+hailo_status CoreOp::infer_async_impl(StreamsTransfers &transfers,
     std::shared_ptr<OngoingInferState> state, TransferDoneCallback done_callback)
 {
-    for ( auto &name_to_transfer : transfers) {
-        name_to_transfer.second.callback = wrap_user_callback(std::move(name_to_transfer.second.callback), state, done_callback);
-    }
+    transfers.for_each([&](stream_index_t, TransferRequest &transfer) {
+        transfer.callback = wrap_user_callback(std::move(transfer.callback), state, done_callback);
+    });
 
+    auto input_stream_index = m_input_streams_indices.begin();
     for (auto &input : m_input_streams) {
-        auto transfer = transfers.find(input.second->name());
-        CHECK(transfer != transfers.end(), HAILO_INTERNAL_FAILURE, "Invalid stream {}", input.second->name());
+        const auto stream_index = *(input_stream_index++);
+        CHECK(transfers.contains(stream_index), HAILO_INTERNAL_FAILURE, "Invalid stream {}", input.second->name());
+        auto &transfer = transfers.at(stream_index);
 
-        CHECK(input.second->get_frame_size() == transfer->second.get_total_transfer_size(), HAILO_INVALID_ARGUMENT,
-            "for input '{}', passed buffer size is {} (expected {})", input.first, transfer->second.get_total_transfer_size(),
+        CHECK(input.second->get_frame_size() == transfer.get_total_transfer_size(), HAILO_INVALID_ARGUMENT,
+            "for input '{}', passed buffer size is {} (expected {})", input.first, transfer.get_total_transfer_size(),
             input.second->get_frame_size());
 
-        auto status = input.second->write_async(TransferRequest{transfer->second});
+        auto status = input.second->write_async(TransferRequest{transfer});
         if (HAILO_STREAM_ABORT == status) {
             return status;
         }
         CHECK_SUCCESS(status);
-        transfers.erase(transfer);
+        transfers.erase(stream_index);
     }
 
+    auto output_stream_index = m_output_streams_indices.begin();
     for (auto &output : m_output_streams) {
-        auto transfer = transfers.find(output.second->name());
-        CHECK(transfer != transfers.end(), HAILO_INTERNAL_FAILURE, "Invalid stream {}", output.second->name());
+        const auto stream_index = *(output_stream_index++);
+        CHECK(transfers.contains(stream_index), HAILO_INTERNAL_FAILURE, "Invalid stream {}", output.second->name());
+        auto &transfer = transfers.at(stream_index);
 
-        CHECK(output.second->get_frame_size() == transfer->second.get_total_transfer_size(), HAILO_INVALID_ARGUMENT,
-            "for output '{}', passed buffer size is {} (expected {})", output.first, transfer->second.get_total_transfer_size(),
+        CHECK(output.second->get_frame_size() == transfer.get_total_transfer_size(), HAILO_INVALID_ARGUMENT,
+            "for output '{}', passed buffer size is {} (expected {})", output.first, transfer.get_total_transfer_size(),
             output.second->get_frame_size());
 
-        auto status = output.second->read_async(TransferRequest{transfer->second});
+        auto status = output.second->read_async(TransferRequest{transfer});
         if (HAILO_STREAM_ABORT == status) {
             return status;
         }
         CHECK_SUCCESS(status);
-        transfers.erase(transfer);
+        transfers.erase(stream_index);
     }
 
     return HAILO_SUCCESS;
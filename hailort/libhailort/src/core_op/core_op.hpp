@@ -119,6 +119,12 @@ public:
      */
     hailo_status infer_async(InferRequest &&request);
 
+    // Stream names are interned into dense indices on configure - the stream index is the position of the stream in
+    // the configure params (that are sorted by name), hence it is the same for all core ops configured with the same
+    // params. InferRequest transfers are indexed by it.
+    Expected<stream_index_t> get_stream_index(const std::string &stream_name) const;
+    size_t streams_count() const { return m_stream_name_to_index.size(); }
+
     virtual bool has_caches() const = 0;
     virtual Expected<uint32_t> get_cache_read_size() const = 0;
     virtual Expected<uint32_t> get_cache_write_size() const = 0;
@@ -153,6 +159,11 @@ protected:
     hailo_status add_output_stream(std::shared_ptr<OutputStreamBase> &&stream,
         const hailo_stream_parameters_t &stream_params);
 
+    // Stream index of each stream in m_input_streams/m_output_streams, in the maps order. Used to walk the streams
+    // together with StreamsTransfers without looking up the stream names.
+    std::vector<stream_index_t> m_input_streams_indices;
+    std::vector<stream_index_t> m_output_streams_indices;
+
     virtual Expected<std::shared_ptr<LatencyMetersMap>> get_latency_meters() = 0;
     virtual Expected<vdma::BoundaryChannelPtr> get_boundary_vdma_channel_by_stream_name(const std::string &stream_name) = 0;
     static uint16_t get_smallest_configured_batch_size(const ConfigureNetworkParams &config_params);
@@ -166,7 +177,7 @@ private:
     // Launch write_async/read_async on all streams with wrapped callback.
     // We remove all transfer that was launched successfully from transfers in order to call those callback
     // with HAILO_STREAM_ABORT status on the case of a failure.
-    hailo_status infer_async_impl(std::unordered_map<std::string, TransferRequest> &transfers,
+    hailo_status infer_async_impl(StreamsTransfers &transfers,
         std::shared_ptr<OngoingInferState> state,
          TransferDoneCallback done_callback);
     TransferDoneCallback wrap_user_callback(TransferDoneCallback &&original_callback,
@@ -174,6 +185,7 @@ private:
         TransferDoneCallback infer_callback);
 
     const ConfigureNetworkParams m_config_params;
+    const std::unordered_map<std::string, stream_index_t> m_stream_name_to_index;
     ActiveCoreOpHolder &m_active_core_op_holder;
     const uint16_t m_min_configured_batch_size; // TODO: remove after HRT-6535
     EventPtr m_core_op_activated_event;
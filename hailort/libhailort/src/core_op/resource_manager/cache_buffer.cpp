@@ -11,6 +11,7 @@
 #include "cache_buffer.hpp"
 #include "hailo/hailort.h"
 #include "vdma/memory/sg_buffer.hpp"
+#include "utils/buffer_storage.hpp"
 
 namespace hailort
 {
@@ -93,7 +94,7 @@ Expected<Buffer> CacheBuffer::read_cache()
 {
     CHECK(m_backing_buffer, HAILO_INTERNAL_FAILURE, "Backing buffer not set");
 
-    TRY(auto buffer, Buffer::create(m_backing_buffer->size()));
+    TRY(auto buffer, Buffer::create(m_backing_buffer->size(), PooledHeapStorage::create_params()));
     CHECK_SUCCESS(m_backing_buffer->read(buffer.data(), buffer.size(), 0));
     return buffer;
 }
@@ -449,8 +449,10 @@ hailo_status ResourcesManager::create_boundary_vdma_channel(const LayerInfo &lay
         max_active_trans, (latency_meter != nullptr));
 
     TRY(auto vdma_transfer_launcher, m_vdma_device.get_vdma_transfer_launcher());
+    TRY(auto vdma_completion_executor, m_vdma_device.get_vdma_completion_executor());
     TRY(auto channel, vdma::BoundaryChannel::create(m_driver, channel_id, channel_direction, std::move(desc_list),
-        vdma_transfer_launcher.get(), ongoing_transfers, pending_transfers, layer_info.name, latency_meter));
+        vdma_transfer_launcher.get(), vdma_completion_executor.get(), ongoing_transfers, pending_transfers,
+        layer_info.name, latency_meter));
 
     m_boundary_channels.add_channel(std::move(channel));
     return HAILO_SUCCESS;
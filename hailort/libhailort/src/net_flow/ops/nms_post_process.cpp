@@ -24,7 +24,10 @@ Expected<std::shared_ptr<OpMetadata>> NmsOpMetadata::create(const std::unordered
         name, network_name, type));
     CHECK_AS_EXPECTED(op_metadata != nullptr, HAILO_OUT_OF_HOST_MEMORY);
 
-    auto status = op_metadata->validate_params();
+    auto status = op_metadata->publish_initial_nms_config();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    status = op_metadata->validate_params();
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     return std::shared_ptr<OpMetadata>(std::move(op_metadata));
@@ -75,13 +78,103 @@ hailo_status NmsOpMetadata::validate_params()
     return HAILO_SUCCESS;
 }
 
+template<typename SrcType>
+static uint32_t get_min_quantized_score(double score_threshold, const hailo_quant_info_t &quant_info, bool should_sigmoid)
+{
+    // The score is non-decreasing in the quantized value (for a positive scale), so the first passing value is found
+    // with a binary search. The score is computed exactly as the ops compute it, so the result matches their comparisons.
+    uint32_t low = 0;
+    uint32_t high = static_cast<uint32_t>(std::numeric_limits<SrcType>::max()) + 1;
+    while (low < high) {
+        const auto mid = low + ((high - low) / 2);
+        auto score = Quantization::dequantize_output<float32_t, SrcType>(static_cast<SrcType>(mid), quant_info);
+        if (should_sigmoid) {
+            score = NmsPostProcessOp::sigmoid(score);
+        }
+        if (score < score_threshold) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+hailo_status NmsOpMetadata::publish_initial_nms_config()
+{
+    return publish_nms_config(m_initial_nms_config);
+}
+
+hailo_status NmsOpMetadata::publish_nms_config(const NmsPostProcessConfig &nms_config)
+{
+    auto snapshot = make_shared_nothrow<NmsConfigSnapshot>();
+    CHECK_NOT_NULL(snapshot, HAILO_OUT_OF_HOST_MEMORY);
+    snapshot->nms_config = nms_config;
+    for (const auto &input_metadata : m_inputs_metadata) {
+        const auto &quant_info = input_metadata.second.quant_info;
+        if (quant_info.qp_scale <= 0) {
+            continue;
+        }
+        if (HAILO_FORMAT_TYPE_UINT8 == input_metadata.second.format.type) {
+            snapshot->min_quantized_scores[input_metadata.first] =
+                get_min_quantized_score<uint8_t>(nms_config.nms_score_th, quant_info, should_sigmoid_scores());
+        } else if (HAILO_FORMAT_TYPE_UINT16 == input_metadata.second.format.type) {
+            snapshot->min_quantized_scores[input_metadata.first] =
+                get_min_quantized_score<uint16_t>(nms_config.nms_score_th, quant_info, should_sigmoid_scores());
+        }
+    }
+    std::atomic_store(&m_nms_config_snapshot, std::shared_ptr<const NmsConfigSnapshot>(std::move(snapshot)));
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status NmsOpMetadata::update_nms_config(const NmsConfigUpdate &update)
+{
+    CHECK(update.score_threshold <= 1.0f, HAILO_INVALID_ARGUMENT, "NMS score threshold must be at most 1 (got {})",
+        update.score_threshold);
+    CHECK(update.iou_threshold <= 1.0f, HAILO_INVALID_ARGUMENT, "NMS IoU threshold must be at most 1 (got {})",
+        update.iou_threshold);
+
+    std::unique_lock<std::mutex> lock(m_update_mutex);
+    auto nms_config = nms_config_snapshot()->nms_config;
+    if (0 <= update.score_threshold) {
+        nms_config.nms_score_th = update.score_threshold;
+    }
+    if (0 <= update.iou_threshold) {
+        nms_config.nms_iou_th = update.iou_threshold;
+    }
+
+    return publish_nms_config(nms_config);
+}
+
+hailo_status NmsOpMetadata::set_max_proposals_per_class(uint32_t max_proposals_per_class)
+{
+    std::unique_lock<std::mutex> lock(m_update_mutex);
+    auto nms_config = nms_config_snapshot()->nms_config;
+    nms_config.max_proposals_per_class = max_proposals_per_class;
+
+    return publish_nms_config(nms_config);
+}
+
+void NmsOpMetadata::set_inputs_metadata(std::unordered_map<std::string, BufferMetaData> &inputs_metadata)
+{
+    std::unique_lock<std::mutex> lock(m_update_mutex);
+    OpMetadata::set_inputs_metadata(inputs_metadata);
+    // The pre-quantized thresholds depend on the inputs quantization and format
+    auto status = publish_nms_config(nms_config_snapshot()->nms_config);
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed to update the NMS config of {} with the new inputs metadata, status = {}", m_name, status);
+    }
+}
+
 std::string NmsOpMetadata::get_nms_config_description()
 {
+    const auto nms_config = this->nms_config();
     auto config_info = fmt::format("Score threshold: {:.3f}, IoU threshold: {:.2f}, Classes: {}, Cross classes: {}, Max bboxes per class: {}",
-                        m_nms_config.nms_score_th, m_nms_config.nms_iou_th, m_nms_config.number_of_classes, m_nms_config.cross_classes,
-                        m_nms_config.max_proposals_per_class);
-    if (m_nms_config.background_removal) {
-        config_info += fmt::format(", Background removal index: {}", m_nms_config.background_removal_index);
+                        nms_config.nms_score_th, nms_config.nms_iou_th, nms_config.number_of_classes, nms_config.cross_classes,
+                        nms_config.max_proposals_per_class);
+    if (nms_config.background_removal) {
+        config_info += fmt::format(", Background removal index: {}", nms_config.background_removal_index);
     }
     return config_info;
 }
@@ -185,8 +278,8 @@ void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vec
 
 hailo_status NmsPostProcessOp::hailo_nms_format(MemoryView dst_view)
 {
-    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_nms_metadata->nms_config().nms_iou_th);
-    fill_nms_format_buffer(dst_view, m_detections, m_classes_detections_count, m_nms_metadata->nms_config());
+    remove_overlapping_boxes(m_detections, m_classes_detections_count, frame_nms_config().nms_iou_th);
+    fill_nms_format_buffer(dst_view, m_detections, m_classes_detections_count, frame_nms_config());
     return HAILO_SUCCESS;
 }
 
@@ -223,9 +316,10 @@ Expected<hailo_vstream_info_t> NmsOpMetadata::get_output_vstream_info()
     vstream_info.format.type = m_outputs_metadata.begin()->second.format.type;
     vstream_info.format.flags = HAILO_FORMAT_FLAGS_NONE;
 
-    vstream_info.nms_shape.max_bboxes_per_class = nms_config().max_proposals_per_class;
-    vstream_info.nms_shape.number_of_classes = nms_config().number_of_classes;
-    if (nms_config().background_removal) {
+    const auto nms_config = this->nms_config();
+    vstream_info.nms_shape.max_bboxes_per_class = nms_config.max_proposals_per_class;
+    vstream_info.nms_shape.number_of_classes = nms_config.number_of_classes;
+    if (nms_config.background_removal) {
         vstream_info.nms_shape.number_of_classes--;
     }
 
@@ -237,9 +331,10 @@ Expected<hailo_vstream_info_t> NmsOpMetadata::get_output_vstream_info()
 
 hailo_nms_info_t NmsOpMetadata::nms_info()
 {
+    const auto nms_config = this->nms_config();
     hailo_nms_info_t nms_info = {
-        nms_config().number_of_classes,
-        nms_config().max_proposals_per_class,
+        nms_config.number_of_classes,
+        nms_config.max_proposals_per_class,
         sizeof(hailo_bbox_float32_t),
         1, // input_division_factor
         false,
@@ -247,7 +342,7 @@ hailo_nms_info_t NmsOpMetadata::nms_info()
         DEFAULT_NMS_NO_BURST_SIZE,
         HAILO_BURST_TYPE_H8_BBOX
     };
-    if (nms_config().background_removal) {
+    if (nms_config.background_removal) {
         nms_info.number_of_classes--;
     }
 
@@ -199,25 +199,44 @@ public:
 protected:
     NmsPostProcessOp(std::shared_ptr<NmsOpMetadata> metadata)
         : Op(static_cast<PostProcessOpMetadataPtr>(metadata))
-        , m_classes_detections_count(metadata->nms_config().number_of_classes, 0)
+        , m_frame_nms_config(metadata->nms_config_snapshot())
+        , m_classes_detections_count(m_frame_nms_config->nms_config.number_of_classes, 0)
         , m_nms_metadata(metadata)
     {
-        m_detections.reserve(metadata->nms_config().max_proposals_per_class * metadata->nms_config().number_of_classes);
+        m_detections.reserve(frame_nms_config().max_proposals_per_class * frame_nms_config().number_of_classes);
     }
 
+    // Must be called at the start of each frame. Takes the config snapshot the whole frame is processed with,
+    // so config updates never stall the processing and are applied from the next frame.
     void clear_before_frame()  
     {
+        m_frame_nms_config = m_nms_metadata->nms_config_snapshot();
+
         m_detections.clear();
-        m_detections.reserve(m_nms_metadata->nms_config().max_proposals_per_class * m_nms_metadata->nms_config().number_of_classes);
+        m_detections.reserve(frame_nms_config().max_proposals_per_class * frame_nms_config().number_of_classes);
+
+        m_classes_detections_count.assign(frame_nms_config().number_of_classes, 0);
+    }
 
-        m_classes_detections_count.assign(m_nms_metadata->nms_config().number_of_classes, 0);
+    const NmsPostProcessConfig &frame_nms_config() const
+    {
+        return m_frame_nms_config->nms_config;
+    }
+
+    // Quantized values of the given input below the returned value can't pass the score threshold of the current frame.
+    // Returns 0 (filters nothing) if the input has no pre-quantized threshold.
+    uint32_t frame_min_quantized_score(const std::string &input_name) const
+    {
+        const auto &min_quantized_scores = m_frame_nms_config->min_quantized_scores;
+        const auto min_quantized_score = min_quantized_scores.find(input_name);
+        return (min_quantized_scores.end() == min_quantized_score) ? 0 : min_quantized_score->second;
     }
 
     template<typename DstType = float32_t, typename SrcType>
     std::pair<uint32_t, float32_t> get_max_class(const SrcType *data, uint32_t entry_idx, uint32_t classes_start_index,
         float32_t objectness, hailo_quant_info_t quant_info, uint32_t width)
     {
-        auto const &nms_config = m_nms_metadata->nms_config();
+        auto const &nms_config = frame_nms_config();
         std::pair<uint32_t, float32_t> max_id_score_pair;
         for (uint32_t class_index = 0; class_index < nms_config.number_of_classes; class_index++) {
             auto class_id = class_index;
@@ -247,6 +266,7 @@ protected:
 
     hailo_status hailo_nms_format(MemoryView dst_view);
 
+    std::shared_ptr<const NmsConfigSnapshot> m_frame_nms_config;
     std::vector<DetectionBbox> m_detections;
     std::vector<uint32_t> m_classes_detections_count;
 private:
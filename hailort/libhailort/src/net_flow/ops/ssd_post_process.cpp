@@ -26,7 +26,10 @@ Expected<std::shared_ptr<OpMetadata>> SSDOpMetadata::create(const std::unordered
         ssd_post_process_config, network_name));
     CHECK_AS_EXPECTED(op_metadata != nullptr, HAILO_OUT_OF_HOST_MEMORY);
 
-    auto status = op_metadata->validate_params();
+    auto status = op_metadata->publish_initial_nms_config();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    status = op_metadata->validate_params();
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     return std::shared_ptr<OpMetadata>(std::move(op_metadata));
@@ -134,7 +137,7 @@ hailo_status SSDPostProcessOp::extract_detections(const std::string &reg_input_n
 {
     const auto &inputs_metadata = m_metadata->inputs_metadata();
     const auto &ssd_config = m_metadata->ssd_config();
-    const auto &nms_config = m_metadata->nms_config();
+    const auto &nms_config = frame_nms_config();
 
     assert(contains(inputs_metadata, reg_input_name));
     assert(contains(inputs_metadata, cls_input_name));
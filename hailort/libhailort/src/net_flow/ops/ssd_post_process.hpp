@@ -43,7 +43,7 @@ private:
     template<typename DstType = float32_t, typename SrcType>
     void extract_bbox_classes(const hailo_bbox_float32_t &dims_bbox, SrcType *cls_data, const BufferMetaData &cls_metadata, uint32_t cls_index)
     {
-        const auto &nms_config = m_metadata->nms_config();
+        const auto &nms_config = frame_nms_config();
         if (nms_config.cross_classes) {
             // Pre-NMS optimization. If NMS checks IoU over different classes, only the maximum class is relevant
             auto max_id_score_pair = get_max_class<DstType, SrcType>(cls_data, cls_index, 0, 1,
@@ -43,7 +43,7 @@ private:
     void add_classes_scores(hailo_quant_info_t &quant_info, DstType* dst_data, size_t &next_bbox_output_offset,
         SrcType* src_data, uint32_t entry_idx, uint32_t class_start_idx, uint32_t padded_width)
     {
-        const auto &nms_config = m_metadata->nms_config();
+        const auto &nms_config = frame_nms_config();
 
         for (uint32_t class_index = 0; class_index < nms_config.number_of_classes; class_index++) {
             auto class_entry_idx = entry_idx + ((class_start_idx + class_index) * padded_width);
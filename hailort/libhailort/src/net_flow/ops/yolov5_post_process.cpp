@@ -27,7 +27,10 @@ Expected<std::shared_ptr<OpMetadata>> Yolov5OpMetadata::create(const std::unorde
         nms_post_process_config, "YOLOv5-Post-Process", network_name, yolov5_post_process_config, OperationType::YOLOV5));
     CHECK_AS_EXPECTED(op_metadata != nullptr, HAILO_OUT_OF_HOST_MEMORY);
 
-    auto status = op_metadata->validate_params();
+    auto status = op_metadata->publish_initial_nms_config();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    status = op_metadata->validate_params();
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     return std::shared_ptr<OpMetadata>(std::move(op_metadata));
@@ -84,10 +87,10 @@ hailo_status YOLOv5PostProcessOp::execute(const std::map<std::string, MemoryView
         assert(contains(yolo_config.anchors, name));
         if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
             status = extract_detections<float32_t, uint8_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
-                input_metadata.padded_shape, yolo_config.anchors.at(name));
+                input_metadata.padded_shape, yolo_config.anchors.at(name), frame_min_quantized_score(name));
         } else if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
             status = extract_detections<float32_t, uint16_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
-                input_metadata.padded_shape, yolo_config.anchors.at(name));
+                input_metadata.padded_shape, yolo_config.anchors.at(name), frame_min_quantized_score(name));
         } else {
             CHECK_SUCCESS(HAILO_INVALID_ARGUMENT, "YOLO post-process received invalid input type {}", static_cast<int>(input_metadata.format.type));
         }
@@ -114,7 +117,7 @@ hailo_bbox_float32_t YOLOv5PostProcessOp::decode(float32_t tx, float32_t ty, flo
 
 uint32_t YOLOv5PostProcessOp::get_entry_size()
 {
-    return (CLASSES_START_INDEX + m_metadata->nms_config().number_of_classes);
+    return (CLASSES_START_INDEX + frame_nms_config().number_of_classes);
 }
 
 size_t YOLOv5PostProcessOp::get_num_of_anchors(const std::vector<int> &layer_anchors)
@@ -66,7 +66,7 @@ protected:
     void check_threshold_and_add_detection(hailo_bbox_float32_t bbox, hailo_quant_info_t &quant_info,
         uint32_t class_index, SrcType* data, uint32_t entry_idx, uint32_t padded_width, DstType objectness)
     {
-        const auto &nms_config = m_metadata->nms_config();
+        const auto &nms_config = frame_nms_config();
         const auto &yolov5_config = m_metadata->yolov5_config();
         if (bbox.score >= nms_config.nms_score_th) {
             if (should_add_mask()) {
@@ -93,7 +93,7 @@ protected:
         hailo_quant_info_t &quant_info, SrcType* data, uint32_t entry_idx, uint32_t class_start_idx,
         DstType objectness, uint32_t padded_width)
     {
-        const auto &nms_config = m_metadata->nms_config();
+        const auto &nms_config = frame_nms_config();
 
         if (nms_config.cross_classes) {
             // Pre-NMS optimization. If NMS checks IoU over different classes, only the maximum class is relevant
@@ -122,13 +122,15 @@ protected:
      * @param[in] shape                         Shape corresponding to the @a buffer layer.
      * @param[in] layer_anchors                 The layer anchors corresponding to layer receiving the @a buffer.
      *                                          Each anchor is structured as {width, height} pairs.
+     * @param[in] min_quantized_objectness      Entries with a lower quantized objectness are skipped without being
+     *                                          de-quantized, see ::frame_min_quantized_score().
      *
      * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
     */
     template<typename DstType = float32_t, typename SrcType>
     hailo_status extract_detections(const MemoryView &buffer, hailo_quant_info_t quant_info,
         hailo_3d_image_shape_t shape, hailo_3d_image_shape_t padded_shape,
-        const std::vector<int> &layer_anchors)
+        const std::vector<int> &layer_anchors, uint32_t min_quantized_objectness)
     {
         const uint32_t X_OFFSET = X_INDEX * padded_shape.width;
         const uint32_t Y_OFFSET = Y_INDEX * padded_shape.width;
@@ -136,7 +138,7 @@ protected:
         const uint32_t H_OFFSET = H_INDEX * padded_shape.width;
         const uint32_t OBJECTNESS_OFFSET = OBJECTNESS_INDEX * padded_shape.width;
 
-        const auto &nms_config = m_metadata->nms_config();
+        const auto &nms_config = frame_nms_config();
 
         auto num_of_anchors = get_num_of_anchors(layer_anchors);
 
@@ -153,6 +155,9 @@ protected:
             for (uint32_t col = 0; col < shape.width; col++) {
                 for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
                     auto entry_idx = (row_size * row) + col + ((anchor * entry_size) * padded_shape.width);
+                    if (static_cast<uint32_t>(data[entry_idx + OBJECTNESS_OFFSET]) < min_quantized_objectness) {
+                        continue;
+                    }
                     auto objectness = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + OBJECTNESS_OFFSET], quant_info);
                     if (objectness < nms_config.nms_score_th) {
                         continue;
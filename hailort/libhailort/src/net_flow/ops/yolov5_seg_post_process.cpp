@@ -39,7 +39,10 @@ Expected<std::shared_ptr<OpMetadata>> Yolov5SegOpMetadata::create(const std::uno
         nms_post_process_config, yolo_config, yolo_seg_config, network_name));
     CHECK_AS_EXPECTED(op_metadata != nullptr, HAILO_OUT_OF_HOST_MEMORY);
 
-    auto status = op_metadata->validate_params();
+    auto status = op_metadata->publish_initial_nms_config();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    status = op_metadata->validate_params();
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     return std::shared_ptr<OpMetadata>(std::move(op_metadata));
@@ -55,8 +58,8 @@ hailo_status Yolov5SegOpMetadata::validate_params()
 hailo_status Yolov5SegOpMetadata::validate_format_info()
 {
     for (const auto& output_metadata : m_outputs_metadata) {
-        CHECK(HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == output_metadata.second.format.order, HAILO_INVALID_ARGUMENT,
-            "The given output format order {} is not supported, should be `HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK`",
+        CHECK(HailoRTCommon::is_nms_with_mask(output_metadata.second.format.order), HAILO_INVALID_ARGUMENT,
+            "The given output format order {} is not supported, should be `HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK` or `HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK`",
             HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
 
         CHECK(HAILO_FORMAT_TYPE_FLOAT32 == output_metadata.second.format.type, HAILO_INVALID_ARGUMENT,
@@ -159,16 +162,16 @@ hailo_status Yolov5SegPostProcess::execute(const std::map<std::string, MemoryVie
         assert(contains(yolo_config.anchors, name));
         if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
             status = extract_detections<float32_t, uint8_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
-                input_metadata.padded_shape, yolo_config.anchors.at(name));
+                input_metadata.padded_shape, yolo_config.anchors.at(name), frame_min_quantized_score(name));
         } else if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
             status = extract_detections<float32_t, uint16_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
-                input_metadata.padded_shape, yolo_config.anchors.at(name));
+                input_metadata.padded_shape, yolo_config.anchors.at(name), frame_min_quantized_score(name));
         }
         CHECK_SUCCESS(status);
     }
 
-    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_metadata->nms_config().nms_iou_th);
-    auto status = fill_nms_with_byte_mask_format(outputs.begin()->second);
+    remove_overlapping_boxes(m_detections, m_classes_detections_count, frame_nms_config().nms_iou_th);
+    auto status = fill_nms_with_mask_format(outputs.begin()->second);
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
@@ -176,7 +179,7 @@ hailo_status Yolov5SegPostProcess::execute(const std::map<std::string, MemoryVie
 
 uint32_t Yolov5SegPostProcess::get_entry_size()
 {
-    return (CLASSES_START_INDEX + m_metadata->nms_config().number_of_classes + MASK_COEFFICIENT_SIZE);
+    return (CLASSES_START_INDEX + frame_nms_config().number_of_classes + MASK_COEFFICIENT_SIZE);
 }
 
 void Yolov5SegPostProcess::mult_mask_vector_and_proto_matrix(const DetectionBbox &detection)
@@ -195,19 +198,26 @@ void Yolov5SegPostProcess::mult_mask_vector_and_proto_matrix(const DetectionBbox
     result = 1.0f / (1.0f + (-1*mult_result).array().exp());
 }
 
-hailo_status Yolov5SegPostProcess::crop_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset)
+void Yolov5SegPostProcess::resize_mask_to_image_dim()
 {
     auto &yolov5_config = m_metadata->yolov5_config();
-    auto mask_threshold = m_metadata->yolov5seg_config().mask_threshold;
 
     // Based on Bilinear interpolation algorithm
     // TODO: HRT-11734 - Improve performance by resizing only the mask part if possible
     auto proto_layer_shape = get_proto_layer_shape();
-    float32_t* resized_mask_to_image_dim_ptr = (float32_t*)m_resized_mask_to_image_dim.data();
     stbir_resize_float_generic((float32_t*)m_mask_mult_result_buffer.data(), proto_layer_shape.width,
-        proto_layer_shape.height, 0, resized_mask_to_image_dim_ptr, static_cast<uint32_t>(yolov5_config.image_width),
+        proto_layer_shape.height, 0, (float32_t*)m_resized_mask_to_image_dim.data(), static_cast<uint32_t>(yolov5_config.image_width),
         static_cast<uint32_t>(yolov5_config.image_height), 0, 1, STBIR_ALPHA_CHANNEL_NONE, 0,
         STBIR_EDGE_CLAMP, STBIR_FILTER_TRIANGLE, STBIR_COLORSPACE_LINEAR, NULL);
+}
+
+hailo_status Yolov5SegPostProcess::crop_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset)
+{
+    auto &yolov5_config = m_metadata->yolov5_config();
+    auto mask_threshold = m_metadata->yolov5seg_config().mask_threshold;
+
+    resize_mask_to_image_dim();
+    float32_t* resized_mask_to_image_dim_ptr = (float32_t*)m_resized_mask_to_image_dim.data();
 
     auto x_min = static_cast<uint32_t>(MAX(std::ceil(detection.m_bbox.x_min * yolov5_config.image_width), 0.0f));
     auto x_max = static_cast<uint32_t>(MIN(std::ceil(detection.m_bbox.x_max * yolov5_config.image_width), yolov5_config.image_width));
@@ -232,6 +242,52 @@ hailo_status Yolov5SegPostProcess::crop_and_copy_mask(const DetectionBbox &detec
     return HAILO_SUCCESS;
 }
 
+Expected<uint32_t> Yolov5SegPostProcess::crop_and_encode_rle_mask(const DetectionBbox &detection, uint32_t mask_height,
+    uint32_t mask_width, MemoryView &buffer, uint32_t buffer_offset)
+{
+    auto &yolov5_config = m_metadata->yolov5_config();
+    auto mask_threshold = m_metadata->yolov5seg_config().mask_threshold;
+    const auto image_width = static_cast<uint32_t>(yolov5_config.image_width);
+    const auto image_height = static_cast<uint32_t>(yolov5_config.image_height);
+
+    resize_mask_to_image_dim();
+    const float32_t *resized_mask_to_image_dim_ptr = (float32_t*)m_resized_mask_to_image_dim.data();
+
+    auto x_min = static_cast<uint32_t>(MAX(std::ceil(detection.m_bbox.x_min * yolov5_config.image_width), 0.0f));
+    auto y_min = static_cast<uint32_t>(MAX(std::ceil(detection.m_bbox.y_min * yolov5_config.image_height), 0.0f));
+
+    // The runs are written straight to the output buffer while thresholding, so the byte mask is never materialized.
+    // Pixels outside of the image are background.
+    uint32_t *counts = reinterpret_cast<uint32_t*>(buffer.data() + buffer_offset);
+    const size_t max_counts = (buffer_offset < buffer.size()) ? ((buffer.size() - buffer_offset) / sizeof(uint32_t)) : 0;
+    uint32_t counts_count = 0;
+    uint32_t current_run = 0;
+    bool current_value = false;
+    for (uint32_t j = 0; j < mask_width; j++) {
+        const auto image_x = x_min + j;
+        for (uint32_t i = 0; i < mask_height; i++) {
+            const auto image_y = y_min + i;
+            const bool value = (image_x < image_width) && (image_y < image_height) &&
+                (resized_mask_to_image_dim_ptr[(image_y * image_width) + image_x] > mask_threshold);
+            if (value != current_value) {
+                if (counts_count == max_counts) {
+                    return make_unexpected(HAILO_INSUFFICIENT_BUFFER);
+                }
+                counts[counts_count++] = current_run;
+                current_run = 0;
+                current_value = value;
+            }
+            current_run++;
+        }
+    }
+    if (counts_count == max_counts) {
+        return make_unexpected(HAILO_INSUFFICIENT_BUFFER);
+    }
+    counts[counts_count++] = current_run;
+
+    return counts_count;
+}
+
 hailo_status Yolov5SegPostProcess::calc_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset)
 {
     mult_mask_vector_and_proto_matrix(detection);
@@ -269,14 +325,47 @@ Expected<uint32_t> Yolov5SegPostProcess::copy_detection_to_result_buffer(MemoryV
     return copied_bytes_amount;
 }
 
-hailo_status Yolov5SegPostProcess::fill_nms_with_byte_mask_format(MemoryView &buffer)
+Expected<uint32_t> Yolov5SegPostProcess::copy_detection_with_rle_mask_to_result_buffer(MemoryView &buffer,
+    DetectionBbox &detection, uint32_t buffer_offset)
+{
+    auto &yolov5_config = m_metadata->yolov5_config();
+    const uint32_t detection_size = sizeof(hailo_detection_with_rle_mask_t);
+    const auto counts_offset = HailoRTCommon::align_to(buffer_offset + detection_size, static_cast<uint32_t>(sizeof(uint32_t)));
+
+    hailo_detection_with_rle_mask_t detection_with_rle_mask{};
+    detection_with_rle_mask.box = detection.m_bbox_with_mask.box;
+    detection_with_rle_mask.score = detection.m_bbox_with_mask.score;
+    detection_with_rle_mask.class_id = detection.m_bbox_with_mask.class_id;
+    detection_with_rle_mask.mask_height = detection.get_bbox_height(yolov5_config.image_height);
+    detection_with_rle_mask.mask_width = detection.get_bbox_width(yolov5_config.image_width);
+
+    // Calc and encode mask, it takes only the space its runs need
+    mult_mask_vector_and_proto_matrix(detection);
+    auto counts_count = crop_and_encode_rle_mask(detection, detection_with_rle_mask.mask_height,
+        detection_with_rle_mask.mask_width, buffer, counts_offset);
+    CHECK_AS_EXPECTED(HAILO_INSUFFICIENT_BUFFER != counts_count.status(), HAILO_INSUFFICIENT_BUFFER,
+        "The given buffer is too small to contain all detections." \
+        " The output buffer will contain the highest scored detections that could be filled." \
+        " One can use `set_nms_max_accumulated_mask_size` to change the output buffer size.");
+    CHECK_EXPECTED(counts_count);
+
+    detection_with_rle_mask.counts_count = counts_count.release();
+    detection_with_rle_mask.counts = reinterpret_cast<uint32_t*>(buffer.data() + counts_offset);
+    *(hailo_detection_with_rle_mask_t*)(buffer.data() + buffer_offset) = detection_with_rle_mask;
+
+    m_classes_detections_count[detection.m_class_id]--;
+    return (counts_offset - buffer_offset) + static_cast<uint32_t>(detection_with_rle_mask.counts_count * sizeof(uint32_t));
+}
+
+hailo_status Yolov5SegPostProcess::fill_nms_with_mask_format(MemoryView &buffer)
 {
     auto status = HAILO_SUCCESS;
-    const auto &nms_config = m_metadata->nms_config();
+    const auto &nms_config = frame_nms_config();
     uint32_t ignored_detections_count = 0;
     uint16_t detections_count = 0;
     // The beginning of the output buffer will contain the detections_count first, here we save space for it.
     uint32_t buffer_offset = sizeof(detections_count);
+    const bool is_rle_mask = (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK == m_metadata->outputs_metadata().begin()->second.format.order);
     for (auto &detection : m_detections) {
         if (REMOVED_CLASS_SCORE == detection.m_bbox.score) {
             // Detection was removed in remove_overlapping_boxes()
@@ -295,7 +384,9 @@ hailo_status Yolov5SegPostProcess::fill_nms_with_byte_mask_format(MemoryView &bu
             m_classes_detections_count[detection.m_class_id] = nms_config.max_proposals_per_class;
         }
 
-        auto copied_bytes_amount = copy_detection_to_result_buffer(buffer, detection, buffer_offset);
+        auto copied_bytes_amount = is_rle_mask ?
+            copy_detection_with_rle_mask_to_result_buffer(buffer, detection, buffer_offset) :
+            copy_detection_to_result_buffer(buffer, detection, buffer_offset);
         if (HAILO_INSUFFICIENT_BUFFER == copied_bytes_amount.status()) {
             status = copied_bytes_amount.status();
             break;
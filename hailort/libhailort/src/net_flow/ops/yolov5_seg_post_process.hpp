@@ -76,14 +76,20 @@ private:
     Yolov5SegPostProcess(std::shared_ptr<Yolov5SegOpMetadata> metadata, Buffer &&mask_mult_result_buffer,
         Buffer &&resized_mask, Buffer &&transformed_proto_buffer);
 
-    hailo_status fill_nms_with_byte_mask_format(MemoryView &buffer);
+    hailo_status fill_nms_with_mask_format(MemoryView &buffer);
     void mult_mask_vector_and_proto_matrix(const DetectionBbox &detection);
+    void resize_mask_to_image_dim();
 
     hailo_status calc_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset);
     hailo_status crop_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset);
+    // Thresholds the mask and writes it as COCO RLE counts at buffer_offset. Returns the number of counts written
+    Expected<uint32_t> crop_and_encode_rle_mask(const DetectionBbox &detection, uint32_t mask_height, uint32_t mask_width,
+        MemoryView &buffer, uint32_t buffer_offset);
 
     // Returns the number of copied bytes
     Expected<uint32_t> copy_detection_to_result_buffer(MemoryView &buffer, DetectionBbox &detection, uint32_t buffer_offset);
+    Expected<uint32_t> copy_detection_with_rle_mask_to_result_buffer(MemoryView &buffer, DetectionBbox &detection,
+        uint32_t buffer_offset);
 
     std::shared_ptr<Yolov5SegOpMetadata> m_metadata;
     Buffer m_mask_mult_result_buffer;
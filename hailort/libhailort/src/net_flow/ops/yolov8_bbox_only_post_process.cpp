@@ -85,7 +85,10 @@ Expected<std::shared_ptr<OpMetadata>> Yolov8BboxOnlyOpMetadata::create(const std
         nms_post_process_config, yolov8_post_process_config, network_name));
     CHECK_AS_EXPECTED(op_metadata != nullptr, HAILO_OUT_OF_HOST_MEMORY);
 
-    auto status = op_metadata->validate_params();
+    auto status = op_metadata->publish_initial_nms_config();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    status = op_metadata->validate_params();
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     return std::shared_ptr<OpMetadata>(std::move(op_metadata));
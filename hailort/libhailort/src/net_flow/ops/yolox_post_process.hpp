@@ -39,7 +39,7 @@ private:
         const MemoryView &obj_buffer)
     {
         const auto &inputs_metadata = m_metadata->inputs_metadata();
-        const auto &nms_config = m_metadata->nms_config();
+        const auto &nms_config = frame_nms_config();
 
         assert(contains(inputs_metadata, layers_names.reg));
         assert(contains(inputs_metadata, layers_names.cls));
@@ -11,8 +11,11 @@
 #ifndef _HAILO_NET_FLOW_NMS_OP_METADATA_HPP_
 #define _HAILO_NET_FLOW_NMS_OP_METADATA_HPP_
 
+#include "hailo/network_group.hpp"
 #include "net_flow/ops_metadata/op_metadata.hpp"
 
+#include <mutex>
+
 namespace hailort
 {
 namespace net_flow
@@ -48,6 +51,17 @@ struct NmsPostProcessConfig
     bool bbox_only = false;
 };
 
+// Immutable NMS config, with the values derived from it. Updates publish a new snapshot instead of changing the
+// current one, so an op holding a snapshot for the duration of a frame never sees a partially applied update.
+struct NmsConfigSnapshot
+{
+    NmsPostProcessConfig nms_config;
+
+    // Per input with an integer format - the minimal quantized value whose score passes nms_config.nms_score_th.
+    // Lower values can be skipped without de-quantizing them.
+    std::unordered_map<std::string, uint32_t> min_quantized_scores;
+};
+
 static const float32_t REMOVED_CLASS_SCORE = 0.0f;
 
 class NmsOpMetadata : public OpMetadata
@@ -62,7 +76,13 @@ public:
     virtual ~NmsOpMetadata() = default;
     std::string get_nms_config_description();
     hailo_status validate_format_info() override;
-    NmsPostProcessConfig &nms_config() { return m_nms_config;};
+    // Copy of the current config. Frames should be processed with a single nms_config_snapshot().
+    NmsPostProcessConfig nms_config() const { return nms_config_snapshot()->nms_config; }
+    std::shared_ptr<const NmsConfigSnapshot> nms_config_snapshot() const { return std::atomic_load(&m_nms_config_snapshot); }
+    // Publishes a new snapshot with the updated thresholds. Negative thresholds keep the current values.
+    hailo_status update_nms_config(const NmsConfigUpdate &update);
+    hailo_status set_max_proposals_per_class(uint32_t max_proposals_per_class);
+    virtual void set_inputs_metadata(std::unordered_map<std::string, BufferMetaData> &inputs_metadata) override;
     hailo_nms_info_t nms_info();
     std::string get_op_description() override;
     static hailo_format_t expand_output_format_autos_by_op_type(const hailo_format_t &output_format, OperationType type, bool bbox_only);
@@ -77,13 +97,31 @@ protected:
                     const std::string &network_name,
                     const OperationType type)
         : OpMetadata(inputs_metadata, outputs_metadata, name, network_name, type),
-            m_nms_config(nms_post_process_config)
+        m_initial_nms_config(nms_post_process_config)
     {}
 
     hailo_status validate_params() override;
 
+    // Whether the op applies sigmoid on the de-quantized scores
+    virtual bool should_sigmoid_scores() const
+    {
+        return false;
+    }
+
+    // Publishes the first snapshot. Called by the create() factories - the derived values depend on the virtual
+    // should_sigmoid_scores(), so they can't be built in the constructor.
+    hailo_status publish_initial_nms_config();
+
+    // Builds the derived values of nms_config and publishes them as the current snapshot.
+    // Must be called again if anything the derived values depend on (the inputs metadata) changes.
+    hailo_status publish_nms_config(const NmsPostProcessConfig &nms_config);
+
 private:
-    NmsPostProcessConfig m_nms_config;
+    const NmsPostProcessConfig m_initial_nms_config;
+    // Serializes the updates. Readers only load the current snapshot.
+    std::mutex m_update_mutex;
+    // Accessed with std::atomic_load/std::atomic_store
+    std::shared_ptr<const NmsConfigSnapshot> m_nms_config_snapshot;
 };
 
 } /* namespace net_flow */
@@ -54,7 +54,7 @@ public:
         m_outputs_metadata = outputs_metadata;
     }
 
-    void set_inputs_metadata(std::unordered_map<std::string, BufferMetaData> &inputs_metadata)
+    virtual void set_inputs_metadata(std::unordered_map<std::string, BufferMetaData> &inputs_metadata)
     {
         m_inputs_metadata = inputs_metadata;
     }
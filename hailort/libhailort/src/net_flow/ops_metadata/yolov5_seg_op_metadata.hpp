@@ -53,6 +53,11 @@ private:
         m_yolo_seg_config(yolo_seg_config)
     {}
 
+    virtual bool should_sigmoid_scores() const override
+    {
+        return true;
+    }
+
     YoloV5SegPostProcessConfig m_yolo_seg_config;
 };
 
@@ -59,7 +59,9 @@ class AsyncInferRunnerImpl
 public:
     static Expected<std::shared_ptr<AsyncInferRunnerImpl>> create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-        const uint32_t timeout = HAILO_DEFAULT_ASYNC_INFER_TIMEOUT_MS);
+        const uint32_t timeout = HAILO_DEFAULT_ASYNC_INFER_TIMEOUT_MS,
+        const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process = {},
+        const std::vector<PostProcessPluginParams> &post_process_plugins = {});
     AsyncInferRunnerImpl(AsyncInferRunnerImpl &&) = delete;
     AsyncInferRunnerImpl(const AsyncInferRunnerImpl &) = delete;
     AsyncInferRunnerImpl &operator=(AsyncInferRunnerImpl &&) = delete;
@@ -71,11 +71,13 @@ Expected<std::unordered_map<std::string, hailo_format_t>> AsyncPipelineBuilder::
 
 hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::vector<std::string> &stream_names, const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
-    const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline)
+    const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline,
+    const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process)
 {
     TRY(const auto vstream_names, net_group->get_vstream_names_from_stream_name(*stream_names.begin()));
     CHECK(vstream_names.size() == 1, HAILO_NOT_SUPPORTED, "low level stream must have exactly 1 user input");
     const auto &vstream_name = vstream_names[0];
+    const bool has_pre_process = contains(inputs_pre_process, vstream_name);
     std::shared_ptr<PixBufferElement> multi_plane_splitter = nullptr;
     std::shared_ptr<PipelineElement> last_element_connected_to_pipeline = nullptr;
 
@@ -89,6 +91,8 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
     last_element_connected_to_pipeline = entry_queue_elem;
 
     bool is_multi_planar = (stream_names.size() > 1);
+    CHECK(!(is_multi_planar && has_pre_process), HAILO_NOT_SUPPORTED,
+        "Pre-process is not supported for multi-planar input {}", vstream_name);
     if (is_multi_planar) {
         async_pipeline->set_as_multi_planar();
         const auto &vstream_order = inputs_formats.at(vstream_name).order;
@@ -127,7 +131,21 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
             last_element_connected_to_pipeline = post_split_push_queue;
         }
 
-        if (should_transform) {
+        if (has_pre_process) {
+            TRY(auto pre_process_elem, PreProcessElement::create(inputs_pre_process.at(vstream_name), input_stream_info.shape,
+                input_stream_info.hw_shape, input_stream_info.format, { input_stream_info.quant_info },
+                PipelineObject::create_element_name("PreProcessEl", stream_name, input_stream_info.index),
+                async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
+            async_pipeline->add_element_to_pipeline(pre_process_elem);
+            CHECK_SUCCESS(PipelinePad::link_pads(last_element_connected_to_pipeline, pre_process_elem));
+
+            is_empty = false;
+            interacts_with_hw = true;
+            TRY(auto queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl", stream_name, input_stream_info.index),
+                async_pipeline, input_stream_info.hw_frame_size, is_empty, interacts_with_hw, pre_process_elem));
+            CHECK_SUCCESS(PipelinePad::link_pads(pre_process_elem, queue_elem));
+            CHECK_SUCCESS(PipelinePad::link_pads(queue_elem, async_pipeline->get_async_hw_element(), 0, sink_index));
+        } else if (should_transform) {
             TRY(auto pre_infer_elem, PreInferElement::create(input_stream_info.shape, src_format,
                 input_stream_info.hw_shape, input_stream_info.format, { input_stream_info.quant_info },
                 PipelineObject::create_element_name("PreInferEl", stream_name, input_stream_info.index),
@@ -151,14 +169,14 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
 
 hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos,
-    std::shared_ptr<AsyncPipeline> async_pipeline)
+    std::shared_ptr<AsyncPipeline> async_pipeline, const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process)
 {
     for(const auto &input : inputs_formats) {
         TRY(const auto stream_names_under_vstream,
             net_group->get_stream_names_from_vstream_name(input.first));
 
         auto status = create_pre_async_hw_elements_per_input(net_group, stream_names_under_vstream, inputs_formats,
-            named_stream_infos, async_pipeline);
+            named_stream_infos, async_pipeline, inputs_pre_process);
         CHECK_SUCCESS(status);
     }
     return HAILO_SUCCESS;
@@ -228,7 +246,7 @@ Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> AsyncPipelineBuilder::
     auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
     assert(nullptr != metadata);
 
-    TRY(auto remove_overlapping_bboxes_element, RemoveOverlappingBboxesElement::create(metadata->nms_config(),
+    TRY(auto remove_overlapping_bboxes_element, RemoveOverlappingBboxesElement::create(metadata,
         PipelineObject::create_element_name(element_name, output_stream_name, stream_index),
         async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
 
@@ -245,7 +263,7 @@ Expected<std::shared_ptr<FillNmsFormatElement>> AsyncPipelineBuilder::add_fill_n
     auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
     assert(nullptr != metadata);
 
-    TRY(auto fill_nms_format_element, FillNmsFormatElement::create(metadata->nms_config(),
+    TRY(auto fill_nms_format_element, FillNmsFormatElement::create(metadata,
         PipelineObject::create_element_name(element_name, output_stream_name, stream_index),
         async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
 
@@ -520,7 +538,7 @@ hailo_status AsyncPipelineBuilder::add_nms_flow(std::shared_ptr<AsyncPipeline> a
         "NMS output format type must be HAILO_FORMAT_TYPE_FLOAT32");
     if(!nms_op_metadata->nms_config().bbox_only){
         CHECK(HailoRTCommon::is_nms(output_format.second.order), HAILO_INVALID_ARGUMENT,
-            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK");
+            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS, HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK");
     }
 
     std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
@@ -758,6 +776,42 @@ hailo_status AsyncPipelineBuilder::add_ops_flows(std::shared_ptr<AsyncPipeline>
     }
 }
 
+hailo_status AsyncPipelineBuilder::add_post_process_plugin_flow(std::shared_ptr<AsyncPipeline> async_pipeline,
+    const PostProcessPluginParams &plugin_params, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos)
+{
+    const auto plugin_name = plugin_params.plugin->name();
+    TRY(auto plugin_elem,
+        PostProcessPluginElement::create(plugin_params, PipelineObject::create_element_name("PPPluginEl", plugin_name, 0),
+            async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
+
+    async_pipeline->add_element_to_pipeline(plugin_elem);
+
+    uint32_t sink_index = 0;
+    for (const auto &input_stream_name : plugin_params.inputs_streams_names) {
+        const auto &stream_name = input_stream_name.second;
+        CHECK(contains(named_stream_infos, stream_name), HAILO_INTERNAL_FAILURE);
+        const auto &stream_info = named_stream_infos.at(stream_name);
+
+        TRY(const auto source_id,
+            async_pipeline->get_async_hw_element()->get_source_index_from_output_stream_name(stream_name));
+
+        // The plugin gets the device buffers as is (no transformation)
+        auto is_empty = false;
+        auto interacts_with_hw = true;
+        TRY(auto plugin_source_queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl_plugin",
+            stream_info.name, stream_info.index), async_pipeline, stream_info.hw_frame_size, is_empty, interacts_with_hw,
+            async_pipeline->get_async_hw_element(), source_id));
+
+        CHECK_SUCCESS(PipelinePad::link_pads(plugin_source_queue_elem, plugin_elem, 0, sink_index));
+        sink_index++;
+    }
+
+    TRY(auto last_async_element,
+        add_last_async_element(async_pipeline, plugin_name, plugin_params.output_frame_size, plugin_elem));
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status AsyncPipelineBuilder::create_post_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &expanded_outputs_formats, std::unordered_map<std::string, hailo_format_t> &original_outputs_formats,
         const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline)
@@ -846,7 +900,9 @@ hailo_status AsyncPipelineBuilder::create_post_async_hw_elements(std::shared_ptr
 Expected<std::shared_ptr<AsyncPipeline>> AsyncPipelineBuilder::create_pipeline(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
     const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-    const uint32_t timeout, std::shared_ptr<std::atomic<hailo_status>> pipeline_status)
+    const uint32_t timeout, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
+    const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process,
+    const std::vector<PostProcessPluginParams> &post_process_plugins)
 {
     std::unordered_map<std::string, std::shared_ptr<PipelineElement>> entry_elements;
     std::unordered_map<std::string, std::shared_ptr<PipelineElement>> last_elements;
@@ -887,13 +943,19 @@ Expected<std::shared_ptr<AsyncPipeline>> AsyncPipelineBuilder::create_pipeline(s
     async_pipeline->set_async_hw_element(async_hw_elem);
 
     hailo_status status = create_pre_async_hw_elements(net_group, input_expanded_format, named_stream_infos,
-        async_pipeline);
+        async_pipeline, inputs_pre_process);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     status = create_post_async_hw_elements(net_group, output_expanded_format, outputs_original_formats, named_stream_infos,
         async_pipeline);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
+    // The outputs consumed by the plugins are not part of outputs_formats, so their streams are connected only here
+    for (const auto &plugin_params : post_process_plugins) {
+        status = add_post_process_plugin_flow(async_pipeline, plugin_params, named_stream_infos);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
     print_pipeline_elements_info(async_pipeline);
 
     return async_pipeline;
@@ -28,7 +28,9 @@ public:
     static Expected<std::shared_ptr<AsyncPipeline>> create_pipeline(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
         const std::unordered_map<std::string, hailo_format_t> &outputs_formats, const uint32_t timeout,
-        std::shared_ptr<std::atomic<hailo_status>> pipeline_status);
+        std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
+        const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process = {},
+        const std::vector<PostProcessPluginParams> &post_process_plugins = {});
 
     static Expected<std::unordered_map<std::string, hailo_format_t>> expand_auto_input_formats(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos);
@@ -39,10 +41,12 @@ public:
 
     static hailo_status create_pre_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos,
-        std::shared_ptr<AsyncPipeline> async_pipeline);
+        std::shared_ptr<AsyncPipeline> async_pipeline,
+        const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process = {});
     static hailo_status create_pre_async_hw_elements_per_input(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::vector<std::string> &stream_names, const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
-        const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline);
+        const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline,
+        const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process = {});
     static hailo_status create_post_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &expanded_outputs_formats, std::unordered_map<std::string, hailo_format_t> &original_outputs_formats,
         const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline);
@@ -70,6 +74,8 @@ public:
     static hailo_status add_nms_flows(std::shared_ptr<AsyncPipeline> async_pipeline, const std::vector<std::string> &output_streams_names,
         const std::pair<std::string, hailo_format_t> &output_format, const net_flow::PostProcessOpMetadataPtr &op_metadata,
         const std::vector<hailo_vstream_info_t> &vstreams_infos, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos);
+    static hailo_status add_post_process_plugin_flow(std::shared_ptr<AsyncPipeline> async_pipeline, const PostProcessPluginParams &plugin_params,
+        const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos);
 
 
     static Expected<std::shared_ptr<PostInferElement>> add_post_infer_element(const hailo_format_t &output_format, const hailo_nms_info_t &nms_info,
@@ -8,6 +8,7 @@
  **/
 
 #include "configured_infer_model_hrpc_client.hpp"
+#include "utils/dma_buffer_utils.hpp"
 #include "hailo/hailort.h"
 
 namespace hailort
@@ -101,8 +102,22 @@ Expected<AsyncInferJob> ConfiguredInferModelHrpcClient::run_async_impl(const Con
     std::function<void(const AsyncInferCompletionInfo &)> callback)
 {
     CHECK_SUCCESS_AS_EXPECTED(validate_bindings(bindings));
+
+    auto client = m_client.lock();
+    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
+        "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
+
+    RunAsyncSerializer::Request request_struct{};
+    request_struct.configured_infer_model_handle = m_handle_id;
+    request_struct.infer_model_handle = m_infer_model_handle_id;
+    CHECK_SUCCESS_AS_EXPECTED(get_input_buffers_info(bindings, client->supports_fd_passing(),
+        request_struct.input_buffer_sizes, request_struct.dmabuf_input_buffer_indices));
+
+    // The lock only covers sending the request (so the inputs are written in the same order as the callbacks ids).
+    // The reply isn't waited for, so the inputs of the next request are sent while the previous ones are in flight.
     std::unique_lock<std::mutex> lock(m_infer_mutex);
     m_callbacks_counter++;
+    const callback_id_t callback_id = m_callbacks_counter;
     auto callback_wrapper = [this, callback] (const AsyncInferCompletionInfo &info) {
         {
             std::unique_lock<std::mutex> transfers_lock(m_ongoing_transfers_mutex);
@@ -114,33 +129,58 @@ Expected<AsyncInferJob> ConfiguredInferModelHrpcClient::run_async_impl(const Con
         }
     };
 
-    TRY(auto job_ptr, m_callbacks_queue->register_callback(m_callbacks_counter, bindings, callback_wrapper));
-
-    TRY(auto input_buffer_sizes, get_input_buffer_sizes(bindings));
-    TRY(auto request, RunAsyncSerializer::serialize_request({m_handle_id, m_infer_model_handle_id,
-        m_callbacks_counter, input_buffer_sizes}));
-
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
-        "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto serialized_result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
-        MemoryView(request), [this, &bindings] (hrpc::RpcConnection connection) -> hailo_status {
-        return write_async_inputs(bindings, connection);
-    }));
-    auto status = RunAsyncSerializer::deserialize_reply(MemoryView(serialized_result));
-    CHECK_SUCCESS_AS_EXPECTED(status);
+    TRY(auto job_ptr, m_callbacks_queue->register_callback(callback_id, bindings, callback_wrapper));
+    request_struct.callback_handle = callback_id;
+    TRY(auto request, RunAsyncSerializer::serialize_request(request_struct));
 
+    // Counted before sending, since the callback may be called before execute_request_async returns
     {
         std::unique_lock<std::mutex> transfers_lock(m_ongoing_transfers_mutex);
         m_ongoing_transfers++;
     }
 
+    // Called from the client's message loop, so it must not execute requests (e.g. shutdown)
+    auto reply_callback = [callbacks_queue = m_callbacks_queue, job_ptr, callback_id] (Expected<Buffer> serialized_result) {
+        auto status = serialized_result ? RunAsyncSerializer::deserialize_reply(MemoryView(serialized_result.value())) :
+            serialized_result.status();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed to submit async infer request (callback id {}), status = {}", callback_id, status);
+            fail_async_infer_request(*callbacks_queue, *job_ptr, callback_id, status);
+        }
+    };
+
+    auto status = client->execute_request_async(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
+        MemoryView(request), [this, &bindings] (hrpc::RpcConnection connection) -> hailo_status {
+        return write_async_inputs(bindings, connection);
+    }, reply_callback);
+    if (HAILO_SUCCESS != status) {
+        // The callback is already registered, so the failure is reported through it (and through the job)
+        fail_async_infer_request(*m_callbacks_queue, *job_ptr, callback_id, status);
+    }
+
     return AsyncInferJobBase::create(job_ptr);
 }
 
-Expected<std::vector<uint32_t>> ConfiguredInferModelHrpcClient::get_input_buffer_sizes(const ConfiguredInferModel::Bindings &bindings)
+void ConfiguredInferModelHrpcClient::fail_async_infer_request(CallbacksQueue &callbacks_queue,
+    AsyncInferJobHrpcClient &job, callback_id_t callback_id, hailo_status status)
 {
-    std::vector<uint32_t> buffer_sizes;
+    job.set_submission_status(status);
+    auto push_status = callbacks_queue.push_failed_callback(status, callback_id);
+    if (HAILO_SUCCESS != push_status) {
+        LOGGER__CRITICAL("Failed to report async infer failure (callback id {}), status = {}", callback_id, push_status);
+    }
+}
+
+hailo_status ConfiguredInferModelHrpcClient::get_input_buffers_info(const ConfiguredInferModel::Bindings &bindings,
+    bool pass_dmabuf_fds, std::vector<uint32_t> &buffer_sizes, std::vector<uint32_t> &dmabuf_buffer_indices)
+{
+    auto add_buffer = [&] (size_t size, bool is_dmabuf) {
+        if (is_dmabuf && pass_dmabuf_fds) {
+            dmabuf_buffer_indices.push_back(static_cast<uint32_t>(buffer_sizes.size()));
+        }
+        buffer_sizes.push_back(static_cast<uint32_t>(size));
+    };
+
     for (const auto &input_vstream : m_input_vstream_infos) {
         TRY(auto input, bindings.input(input_vstream.name));
         auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(input);
@@ -148,28 +188,46 @@ Expected<std::vector<uint32_t>> ConfiguredInferModelHrpcClient::get_input_buffer
         case BufferType::VIEW:
         {
             TRY(auto buffer, input.get_buffer());
-            buffer_sizes.push_back(static_cast<uint32_t>(buffer.size()));
+            add_buffer(buffer.size(), false);
             break;
         }
         case BufferType::PIX_BUFFER:
         {
             TRY(auto pix_buffer, input.get_pix_buffer());
-            CHECK_AS_EXPECTED(HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR == pix_buffer.memory_type, HAILO_NOT_SUPPORTED,
-                "Currently, only userptr pix buffers are supported in HRPC!"); // TODO: HRT-14391
+            const bool is_dmabuf = (HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF == pix_buffer.memory_type);
             for (uint32_t i = 0; i < pix_buffer.number_of_planes; i++) {
-                buffer_sizes.push_back(pix_buffer.planes[i].bytes_used);
+                add_buffer(pix_buffer.planes[i].bytes_used, is_dmabuf);
             }
             break;
         }
         case BufferType::DMA_BUFFER:
-            LOGGER__CRITICAL("DMA_BUFFER is not supported in HRPC");
-            return make_unexpected(HAILO_NOT_IMPLEMENTED);
+        {
+            TRY(auto dma_buffer, input.get_dma_buffer());
+            add_buffer(dma_buffer.size, true);
+            break;
+        }
         default:
             LOGGER__CRITICAL("Unknown buffer type");
-            return make_unexpected(HAILO_INTERNAL_FAILURE);
+            return HAILO_INTERNAL_FAILURE;
         }
     }
-    return buffer_sizes;
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::write_dmabuf(hrpc::RpcConnection &connection, hailo_dma_buffer_t dma_buffer)
+{
+    if (connection.supports_fd_passing()) {
+        return connection.write_dmabuf_fd(dma_buffer.fd);
+    }
+
+    // The connection can't carry fds (e.g. PCIe), so the content is copied to the connection
+    TRY(auto dma_buffer_view, DmaBufferUtils::mmap_dma_buffer_cached(dma_buffer, BufferProtection::READ));
+    auto status = connection.write_buffer(dma_buffer_view);
+    auto unmap_status = DmaBufferUtils::munmap_dma_buffer_cached(dma_buffer, dma_buffer_view, BufferProtection::READ);
+    CHECK_SUCCESS(status);
+    CHECK_SUCCESS(unmap_status);
+
+    return HAILO_SUCCESS;
 }
 
 hailo_status ConfiguredInferModelHrpcClient::write_async_inputs(const ConfiguredInferModel::Bindings &bindings,
@@ -189,17 +247,22 @@ hailo_status ConfiguredInferModelHrpcClient::write_async_inputs(const Configured
         case BufferType::PIX_BUFFER:
         {
             TRY(auto pix_buffer, input.get_pix_buffer());
-            CHECK(HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR == pix_buffer.memory_type, HAILO_NOT_SUPPORTED,
-                "Currently, only userptr pix buffers are supported in HRPC!"); // TODO: HRT-14391
             for (uint32_t i = 0; i < pix_buffer.number_of_planes; i++) {
-                auto status = connection.write_buffer(MemoryView(pix_buffer.planes[i].user_ptr, pix_buffer.planes[i].bytes_used));
+                const auto &plane = pix_buffer.planes[i];
+                auto status = (HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF == pix_buffer.memory_type) ?
+                    write_dmabuf(connection, hailo_dma_buffer_t{plane.fd, plane.bytes_used}) :
+                    connection.write_buffer(MemoryView(plane.user_ptr, plane.bytes_used));
                 CHECK_SUCCESS(status);
             }
             break;
         }
         case BufferType::DMA_BUFFER:
-            LOGGER__CRITICAL("DMA_BUFFER is not supported in HRPC");
-            return HAILO_NOT_IMPLEMENTED;
+        {
+            TRY(auto dma_buffer, input.get_dma_buffer());
+            auto status = write_dmabuf(connection, dma_buffer);
+            CHECK_SUCCESS(status);
+            break;
+        }
         default:
             LOGGER__CRITICAL("Unknown buffer type");
             return HAILO_INTERNAL_FAILURE;
@@ -67,9 +67,14 @@ private:
     virtual hailo_status validate_bindings(const ConfiguredInferModel::Bindings &bindings) override;
     Expected<AsyncInferJob> run_async_impl(const ConfiguredInferModel::Bindings &bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback);
-    Expected<std::vector<uint32_t>> get_input_buffer_sizes(const ConfiguredInferModel::Bindings &bindings);
+    // dma-bufs are passed as fds if the connection supports it, otherwise their content is written (same as views)
+    hailo_status get_input_buffers_info(const ConfiguredInferModel::Bindings &bindings, bool pass_dmabuf_fds,
+        std::vector<uint32_t> &buffer_sizes, std::vector<uint32_t> &dmabuf_buffer_indices);
     hailo_status write_async_inputs(const ConfiguredInferModel::Bindings &bindings,
         hrpc::RpcConnection connection);
+    static hailo_status write_dmabuf(hrpc::RpcConnection &connection, hailo_dma_buffer_t dma_buffer);
+    static void fail_async_infer_request(CallbacksQueue &callbacks_queue, AsyncInferJobHrpcClient &job,
+        callback_id_t callback_id, hailo_status status);
 
     std::weak_ptr<hrpc::Client> m_client;
     rpc_object_handle_t m_handle_id;
@@ -70,7 +70,7 @@ hailo_status HwWriteElement::run_push(PipelineBuffer &&buffer, const PipelinePad
     if (PipelineBuffer::Type::FLUSH == buffer.get_type()) {
         hailo_status flush_status = m_stream->flush();
         if (HAILO_STREAM_ABORT == flush_status) {
-            LOGGER__INFO("Failed flushing input stream {} because stream was aborted", m_stream->to_string());
+            LOGGER__INFO_RATE_LIMITED("Failed flushing input stream {} because stream was aborted", m_stream->to_string());
         } else if (HAILO_SUCCESS != flush_status) {
             LOGGER__ERROR("flush has failed in {} with status {}", name(), flush_status);
         }
@@ -84,7 +84,7 @@ hailo_status HwWriteElement::run_push(PipelineBuffer &&buffer, const PipelinePad
     m_duration_collector.complete_measurement();
 
     if (HAILO_STREAM_ABORT == status) {
-        LOGGER__INFO("Failed to send on input stream {} because stream was aborted", m_stream->to_string());
+        LOGGER__INFO_RATE_LIMITED("Failed to send on input stream {} because stream was aborted", m_stream->to_string());
         return HAILO_STREAM_ABORT;
     }
     CHECK_SUCCESS(status, "{} (H2D) failed with status={}", name(), status);
@@ -109,7 +109,7 @@ hailo_status HwWriteElement::execute_deactivate()
     // We assume that no buffers are sent after the call for deactivate.
     hailo_status flush_status = m_stream->flush();
     if (HAILO_STREAM_ABORT == flush_status) {
-        LOGGER__INFO("Failed flushing input stream {} because stream was aborted", m_stream->to_string());
+        LOGGER__INFO_RATE_LIMITED("Failed flushing input stream {} because stream was aborted", m_stream->to_string());
         return HAILO_SUCCESS;
     } else if (HAILO_STREAM_NOT_ACTIVATED == flush_status) {
         LOGGER__INFO("Failed flushing input stream {} because stream is not activated", m_stream->to_string());
@@ -393,7 +393,7 @@ Expected<PipelineBuffer> HwReadElement::run_pull(PipelineBuffer &&optional, cons
             continue;
         }
         if (HAILO_STREAM_ABORT == status) {
-            LOGGER__INFO("Reading from stream was aborted!");
+            LOGGER__INFO_RATE_LIMITED("Reading from stream was aborted!");
             return make_unexpected(HAILO_STREAM_ABORT);
         }
         CHECK_SUCCESS_AS_EXPECTED(status, "{} (D2H) failed with status={}", name(), status);
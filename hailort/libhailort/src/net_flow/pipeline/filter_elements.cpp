@@ -28,11 +28,11 @@ hailo_status FilterElement::run_push(PipelineBuffer &&buffer, const PipelinePad
 
     hailo_status status = next_pad().run_push(std::move(output));
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("run_push of {} was shutdown!", name());
+        LOGGER__INFO_RATE_LIMITED("run_push of {} was shutdown!", name());
         return status;
     }
     if (HAILO_STREAM_ABORT == status) {
-        LOGGER__INFO("run_push of {} was aborted!", name());
+        LOGGER__INFO_RATE_LIMITED("run_push of {} was aborted!", name());
         return status;
     }
     CHECK_SUCCESS(status);
@@ -189,6 +189,94 @@ Expected<PipelineBuffer> PreInferElement::action(PipelineBuffer &&input, Pipelin
     return transformed_buffer.release();
 }
 
+Expected<std::shared_ptr<PreProcessElement>> PreProcessElement::create(const hailo_pre_process_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &hw_image_shape,
+    const hailo_format_t &hw_format, const std::vector<hailo_quant_info_t> &hw_quant_infos, const std::string &name,
+    const ElementBuildParams &build_params, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
+{
+    TRY(auto pre_process_context,
+        PreProcessContext::create(params, dst_image_shape, hw_image_shape, hw_format, hw_quant_infos),
+        "Failed Creating PreProcessContext");
+    TRY(auto duration_collector, DurationCollector::create(build_params.elem_stats_flags));
+    auto pipeline_status = build_params.pipeline_status;
+
+    auto pre_process_elem_ptr = make_shared_nothrow<PreProcessElement>(std::move(pre_process_context),
+        name, build_params.timeout, std::move(duration_collector), std::move(pipeline_status), pipeline_direction,
+        async_pipeline);
+    CHECK_AS_EXPECTED(nullptr != pre_process_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    LOGGER__INFO("Created {}", pre_process_elem_ptr->description());
+
+    return pre_process_elem_ptr;
+}
+
+PreProcessElement::PreProcessElement(std::unique_ptr<PreProcessContext> &&pre_process_context, const std::string &name,
+    std::chrono::milliseconds timeout, DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
+    FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
+    m_pre_process_context(std::move(pre_process_context))
+{}
+
+Expected<PipelineBuffer> PreProcessElement::run_pull(PipelineBuffer &&/*optional*/, const PipelinePad &/*source*/)
+{
+    LOGGER__ERROR("PreProcessElement does not support run_pull operation");
+    return make_unexpected(HAILO_INVALID_OPERATION);
+}
+
+PipelinePad &PreProcessElement::next_pad()
+{
+    // Note: The next elem to be run is downstream from this elem (i.e. buffers are pushed)
+    return *m_sources[0].next();
+}
+
+std::string PreProcessElement::description() const
+{
+    std::stringstream element_description;
+    element_description << "(" << this->name() << " | " << m_pre_process_context->description() << ")";
+    return element_description.str();
+}
+
+Expected<PipelineBuffer> PreProcessElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
+{
+    if (PipelineBuffer::Type::FLUSH == input.get_type()) {
+        return std::move(input);
+    }
+
+    // Buffers are always taken from the next-pad-downstream
+    auto pool = next_pad_downstream().element().get_buffer_pool();
+    assert(pool);
+
+    auto processed_buffer = pool->get_available_buffer(std::move(optional), m_timeout);
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == processed_buffer.status()) {
+        return make_unexpected(processed_buffer.status());
+    }
+
+    if (!processed_buffer) {
+        input.set_action_status(processed_buffer.status());
+    }
+    CHECK_AS_EXPECTED(HAILO_TIMEOUT != processed_buffer.status(), HAILO_TIMEOUT,
+        "{} (H2D) failed with status={} (timeout={}ms)", name(), HAILO_TIMEOUT, m_timeout.count());
+    CHECK_EXPECTED(processed_buffer);
+
+    TRY(auto dst, processed_buffer->as_view(BufferProtection::WRITE));
+    TRY(auto src, input.as_view(BufferProtection::READ));
+
+    m_duration_collector.start_measurement();
+    const auto status = m_pre_process_context->process(src, dst);
+    m_duration_collector.complete_measurement();
+
+    input.set_action_status(status);
+    processed_buffer->set_action_status(status);
+
+    auto metadata = input.get_metadata();
+
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    processed_buffer->set_metadata_start_time(metadata.get_start_time());
+
+    return processed_buffer.release();
+}
+
 Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> ConvertNmsToDetectionsElement::create(
     const hailo_nms_info_t &nms_info, const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags,
     std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::chrono::milliseconds timeout,
@@ -266,13 +354,13 @@ Expected<PipelineBuffer> ConvertNmsToDetectionsElement::action(PipelineBuffer &&
     return buffer.release();
 }
 
-Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(const net_flow::NmsPostProcessConfig nms_config,
+Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata,
     const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
 {
     TRY(auto duration_collector, DurationCollector::create(elem_flags));
 
-    auto fill_nms_format_element = make_shared_nothrow<FillNmsFormatElement>(std::move(nms_config),
+    auto fill_nms_format_element = make_shared_nothrow<FillNmsFormatElement>(std::move(nms_metadata),
         name, std::move(duration_collector), std::move(pipeline_status), timeout, pipeline_direction, async_pipeline);
     CHECK_AS_EXPECTED(nullptr != fill_nms_format_element, HAILO_OUT_OF_HOST_MEMORY);
 
@@ -281,21 +369,26 @@ Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(con
     return fill_nms_format_element;
 }
 
-Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(const net_flow::NmsPostProcessConfig nms_config,
+Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata,
     const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction,
     std::shared_ptr<AsyncPipeline> async_pipeline)
 {
-    return FillNmsFormatElement::create(nms_config, name, build_params.elem_stats_flags,
+    return FillNmsFormatElement::create(nms_metadata, name, build_params.elem_stats_flags,
         build_params.pipeline_status, build_params.timeout, pipeline_direction, async_pipeline);
 }
 
-FillNmsFormatElement::FillNmsFormatElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name,
+FillNmsFormatElement::FillNmsFormatElement(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata, const std::string &name,
     DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
-    m_nms_config(std::move(nms_config))
+    m_nms_metadata(std::move(nms_metadata))
 {}
 
+hailo_status FillNmsFormatElement::set_nms_max_proposals_per_class(uint32_t max_proposals_per_class)
+{
+    return m_nms_metadata->set_max_proposals_per_class(max_proposals_per_class);
+}
+
 hailo_status FillNmsFormatElement::run_push(PipelineBuffer &&buffer, const PipelinePad &sink)
 {
     CHECK(PipelineDirection::PUSH == m_pipeline_direction, HAILO_INVALID_OPERATION,
@@ -335,8 +428,9 @@ Expected<PipelineBuffer> FillNmsFormatElement::action(PipelineBuffer &&input, Pi
 
     auto detections = input.get_metadata().get_additional_data<IouPipelineData>();
     TRY(auto dst, buffer.as_view(BufferProtection::WRITE));
+    const auto nms_config_snapshot = m_nms_metadata->nms_config_snapshot();
     net_flow::NmsPostProcessOp::fill_nms_format_buffer(dst, detections->m_detections, detections->m_detections_classes_count,
-        m_nms_config);
+        nms_config_snapshot->nms_config);
 
     m_duration_collector.complete_measurement();
 
@@ -455,13 +549,13 @@ Expected<PipelineBuffer> PostInferElement::action(PipelineBuffer &&input, Pipeli
 }
 
 Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> RemoveOverlappingBboxesElement::create(
-    const net_flow::NmsPostProcessConfig nms_config, const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags,
+    std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata, const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags,
     std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::chrono::milliseconds timeout,
     PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
 {
     TRY(auto duration_collector, DurationCollector::create(elem_flags));
 
-    auto convert_nms_removed_overlapping_elem_ptr = make_shared_nothrow<RemoveOverlappingBboxesElement>(std::move(nms_config),
+    auto convert_nms_removed_overlapping_elem_ptr = make_shared_nothrow<RemoveOverlappingBboxesElement>(std::move(nms_metadata),
         name, std::move(duration_collector), std::move(pipeline_status), timeout, pipeline_direction, async_pipeline);
     CHECK_AS_EXPECTED(nullptr != convert_nms_removed_overlapping_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
 
@@ -470,21 +564,28 @@ Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> RemoveOverlappingBboxe
     return convert_nms_removed_overlapping_elem_ptr;
 }
 
-Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> RemoveOverlappingBboxesElement::create(const net_flow::NmsPostProcessConfig nms_config,
+Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> RemoveOverlappingBboxesElement::create(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata,
     const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction,
     std::shared_ptr<AsyncPipeline> async_pipeline)
 {
-    return RemoveOverlappingBboxesElement::create(nms_config, name,
+    return RemoveOverlappingBboxesElement::create(nms_metadata, name,
         build_params.elem_stats_flags, build_params.pipeline_status, build_params.timeout, pipeline_direction, async_pipeline);
 }
 
-RemoveOverlappingBboxesElement::RemoveOverlappingBboxesElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name,
+RemoveOverlappingBboxesElement::RemoveOverlappingBboxesElement(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata, const std::string &name,
     DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
-    m_nms_config(std::move(nms_config))
+    m_nms_metadata(std::move(nms_metadata))
 {}
 
+hailo_status RemoveOverlappingBboxesElement::update_nms_config(const NmsConfigUpdate &update)
+{
+    // The score threshold was already applied by the device
+    CHECK(update.score_threshold < 0, HAILO_INVALID_OPERATION, "{} can't update the NMS score threshold", name());
+    return m_nms_metadata->update_nms_config(update);
+}
+
 hailo_status RemoveOverlappingBboxesElement::run_push(PipelineBuffer &&buffer, const PipelinePad &sink)
 {
     CHECK(PipelineDirection::PUSH == m_pipeline_direction, HAILO_INVALID_OPERATION,
@@ -504,7 +605,7 @@ std::string RemoveOverlappingBboxesElement::description() const
 {
     std::stringstream element_description;
     element_description << "(" << this->name();
-    element_description << " | " << "IoU Threshold: " << this->m_nms_config.nms_iou_th << ")";
+    element_description << " | " << "IoU Threshold: " << m_nms_metadata->nms_config_snapshot()->nms_config.nms_iou_th << ")";
     return element_description.str();
 }
 
@@ -531,7 +632,7 @@ Expected<PipelineBuffer> RemoveOverlappingBboxesElement::action(PipelineBuffer &
     auto detections_pipeline_data = input.get_metadata().get_additional_data<IouPipelineData>();
 
     net_flow::NmsPostProcessOp::remove_overlapping_boxes(detections_pipeline_data->m_detections,
-        detections_pipeline_data->m_detections_classes_count, m_nms_config.nms_iou_th);
+        detections_pipeline_data->m_detections_classes_count, m_nms_metadata->nms_config_snapshot()->nms_config.nms_iou_th);
     m_duration_collector.complete_measurement();
 
     return buffer.release();
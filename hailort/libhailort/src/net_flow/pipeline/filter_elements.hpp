@@ -11,6 +11,7 @@
 #define _HAILO_FILTER_ELEMENTS_HPP_
 
 #include "net_flow/pipeline/pipeline_internal.hpp"
+#include "transform/pre_process.hpp"
 
 namespace hailort
 {
@@ -70,18 +71,43 @@ private:
     std::unique_ptr<InputTransformContext> m_transform_context;
 };
 
+// Runs host pre-processing (resize, letterbox and color conversion) on the user frames, writing them in the HW format
+class PreProcessElement : public FilterElement
+{
+public:
+    static Expected<std::shared_ptr<PreProcessElement>> create(const hailo_pre_process_params_t &params,
+        const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &hw_image_shape,
+        const hailo_format_t &hw_format, const std::vector<hailo_quant_info_t> &hw_quant_infos, const std::string &name,
+        const ElementBuildParams &build_params, PipelineDirection pipeline_direction = PipelineDirection::PUSH,
+        std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+    PreProcessElement(std::unique_ptr<PreProcessContext> &&pre_process_context, const std::string &name, std::chrono::milliseconds timeout,
+        DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, PipelineDirection pipeline_direction,
+        std::shared_ptr<AsyncPipeline> async_pipeline);
+    virtual ~PreProcessElement() = default;
+
+    virtual Expected<PipelineBuffer> run_pull(PipelineBuffer &&optional, const PipelinePad &source) override;
+    virtual PipelinePad &next_pad() override;
+    virtual std::string description() const override;
+
+protected:
+    virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
+
+private:
+    std::unique_ptr<PreProcessContext> m_pre_process_context;
+};
+
 class RemoveOverlappingBboxesElement : public FilterElement
 {
 public:
     static Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> create(
-        const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
+        std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata, const std::string &name,
         hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
         std::chrono::milliseconds timeout, PipelineDirection pipeline_direction = PipelineDirection::PULL,
         std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
-    static Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> create(const net_flow::NmsPostProcessConfig nms_config,
+    static Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> create(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata,
         const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction = PipelineDirection::PULL, 
         std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
-    RemoveOverlappingBboxesElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name, DurationCollector &&duration_collector,
+    RemoveOverlappingBboxesElement(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata, const std::string &name, DurationCollector &&duration_collector,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, std::chrono::milliseconds timeout,
         PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline);
     virtual ~RemoveOverlappingBboxesElement() = default;
@@ -89,17 +115,22 @@ public:
     virtual PipelinePad &next_pad() override;
     virtual std::string description() const override;
 
-    virtual hailo_status set_nms_iou_threshold(float32_t threshold)
+    // Only the IoU threshold can be updated
+    virtual hailo_status update_nms_config(const NmsConfigUpdate &update) override;
+
+    virtual hailo_status set_nms_iou_threshold(float32_t threshold) override
     {
-        m_nms_config.nms_iou_th = threshold;
-        return HAILO_SUCCESS;
+        NmsConfigUpdate update;
+        update.iou_threshold = threshold;
+        return update_nms_config(update);
     }
 
 protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 
 private:
-    net_flow::NmsPostProcessConfig m_nms_config;
+    // Shared with the network group, so updates of the op's config apply to this element as well
+    std::shared_ptr<net_flow::NmsOpMetadata> m_nms_metadata;
 };
 
 class PostInferElement : public FilterElement
@@ -165,31 +196,28 @@ private:
 class FillNmsFormatElement : public FilterElement
 {
 public:
-    static Expected<std::shared_ptr<FillNmsFormatElement>> create(const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
+    static Expected<std::shared_ptr<FillNmsFormatElement>> create(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata, const std::string &name,
         hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
         std::chrono::milliseconds timeout, PipelineDirection pipeline_direction = PipelineDirection::PULL,
         std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
-    static Expected<std::shared_ptr<FillNmsFormatElement>> create(const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
+    static Expected<std::shared_ptr<FillNmsFormatElement>> create(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata, const std::string &name,
         const ElementBuildParams &build_params, PipelineDirection pipeline_direction = PipelineDirection::PULL,
         std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
-    FillNmsFormatElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name, DurationCollector &&duration_collector,
+    FillNmsFormatElement(std::shared_ptr<net_flow::NmsOpMetadata> nms_metadata, const std::string &name, DurationCollector &&duration_collector,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, std::chrono::milliseconds timeout,
         PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline);
     virtual ~FillNmsFormatElement() = default;
     virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
     virtual PipelinePad &next_pad() override;
 
-    virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) override
-    {
-        m_nms_config.max_proposals_per_class = max_proposals_per_class;
-        return HAILO_SUCCESS;
-    }
+    virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) override;
 
 protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 
 private:
-    net_flow::NmsPostProcessConfig m_nms_config;
+    // Shared with the network group, so updates of the op's config apply to this element as well
+    std::shared_ptr<net_flow::NmsOpMetadata> m_nms_metadata;
 };
 
 class ArgmaxPostProcessElement : public FilterElement
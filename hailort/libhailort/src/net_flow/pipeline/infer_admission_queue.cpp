@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) 2020-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_admission_queue.cpp
+ * @brief Bounded queue of requests waiting for room in the async inference pipeline, used by ConfiguredInferModel
+ *        to shed load and drop expired requests before they are sent to the device
+ **/
+
+#include "net_flow/pipeline/infer_admission_queue.hpp"
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+
+namespace hailort
+{
+
+Expected<std::shared_ptr<InferAdmissionQueue>> InferAdmissionQueue::create(const InferAdmissionParams &params,
+    std::function<bool()> &&can_launch)
+{
+    CHECK_AS_EXPECTED(0 < params.watermark, HAILO_INVALID_ARGUMENT, "Admission watermark must be at least 1");
+    CHECK_AS_EXPECTED(0 < params.keep_every_nth, HAILO_INVALID_ARGUMENT, "keep_every_nth must be at least 1");
+    CHECK_AS_EXPECTED(0 <= params.default_deadline.count(), HAILO_INVALID_ARGUMENT,
+        "Default deadline must not be negative (got {}ms)", params.default_deadline.count());
+
+    auto admission_queue = make_shared_nothrow<InferAdmissionQueue>(params, std::move(can_launch));
+    CHECK_NOT_NULL_AS_EXPECTED(admission_queue, HAILO_OUT_OF_HOST_MEMORY);
+
+    // The dispatcher keeps the queue alive, so a request callback may release the last external reference
+    admission_queue->m_dispatcher_thread = std::thread([admission_queue]() {
+        OsUtils::set_current_thread_name("INFER_ADMISSION");
+        admission_queue->dispatcher_thread_main();
+    });
+    return admission_queue;
+}
+
+InferAdmissionQueue::InferAdmissionQueue(const InferAdmissionParams &params, std::function<bool()> &&can_launch) :
+    m_params(params),
+    m_can_launch(std::move(can_launch)),
+    m_stats(),
+    m_overloaded_requests_count(0),
+    m_is_notified(false),
+    m_is_running(true)
+{}
+
+void InferAdmissionQueue::stop()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_is_running) {
+            return;
+        }
+        m_is_running = false;
+    }
+    m_cv.notify_all();
+
+    if (std::this_thread::get_id() == m_dispatcher_thread.get_id()) {
+        // Called from a request callback - the dispatcher drops the waiting requests and exits once it returns
+        m_dispatcher_thread.detach();
+    } else if (m_dispatcher_thread.joinable()) {
+        m_dispatcher_thread.join();
+    }
+}
+
+void InferAdmissionQueue::enqueue(Request &&request)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_is_running) {
+            // Raced with stop() - there is no dispatcher to complete the request, so it is dropped here
+            lock.unlock();
+            request.drop(HAILO_REQUEST_DROPPED);
+            return;
+        }
+        if (m_requests.size() < m_params.watermark) {
+            m_overloaded_requests_count = 0;
+            m_requests.emplace_back(std::move(request));
+        } else {
+            m_overloaded_requests_count++;
+            const bool keep_new_request = (InferSheddingPolicy::DROP_OLDEST == m_params.shedding_policy) ||
+                ((InferSheddingPolicy::KEEP_EVERY_NTH == m_params.shedding_policy) &&
+                    (0 == (m_overloaded_requests_count % m_params.keep_every_nth)));
+            if (keep_new_request) {
+                m_dropped_requests.emplace_back(std::move(m_requests.front()));
+                m_requests.pop_front();
+                m_requests.emplace_back(std::move(request));
+            } else {
+                m_dropped_requests.emplace_back(std::move(request));
+            }
+            m_stats.shed++;
+        }
+        m_stats.max_pending = std::max(m_stats.max_pending, m_requests.size());
+        m_is_notified = true;
+    }
+    m_cv.notify_one();
+}
+
+void InferAdmissionQueue::notify()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_notified = true;
+    }
+    m_cv.notify_one();
+}
+
+InferAdmissionStats InferAdmissionQueue::get_stats()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto stats = m_stats;
+    stats.pending = m_requests.size();
+    return stats;
+}
+
+InferAdmissionQueue::Clock::time_point InferAdmissionQueue::default_deadline(Clock::time_point now) const
+{
+    if (0 == m_params.default_deadline.count()) {
+        return Clock::time_point::max();
+    }
+    return now + m_params.default_deadline;
+}
+
+void InferAdmissionQueue::take_expired_requests(Clock::time_point now, std::vector<Request> &expired_requests)
+{
+    for (auto it = m_requests.begin(); it != m_requests.end();) {
+        if (it->deadline <= now) {
+            expired_requests.emplace_back(std::move(*it));
+            it = m_requests.erase(it);
+            m_stats.expired++;
+        } else {
+            it++;
+        }
+    }
+}
+
+InferAdmissionQueue::Clock::time_point InferAdmissionQueue::earliest_deadline() const
+{
+    auto deadline = Clock::time_point::max();
+    for (const auto &request : m_requests) {
+        deadline = std::min(deadline, request.deadline);
+    }
+    return deadline;
+}
+
+void InferAdmissionQueue::dispatcher_thread_main()
+{
+    // The user callbacks of dropped requests are called outside of the lock, since they may launch new requests
+    std::vector<Request> expired_requests;
+    std::vector<Request> dropped_requests;
+    while (true) {
+        bool has_waiting_requests = false;
+        bool is_running = true;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto should_wake = [this]() {
+                return !m_is_running || !m_dropped_requests.empty() || (m_is_notified && !m_requests.empty());
+            };
+            const auto deadline = earliest_deadline();
+            if (Clock::time_point::max() == deadline) {
+                m_cv.wait(lock, should_wake);
+            } else {
+                m_cv.wait_until(lock, deadline, should_wake);
+            }
+
+            take_expired_requests(Clock::now(), expired_requests);
+            std::swap(dropped_requests, m_dropped_requests);
+            is_running = m_is_running;
+            if (!is_running) {
+                for (auto &waiting_request : m_requests) {
+                    dropped_requests.emplace_back(std::move(waiting_request));
+                }
+                m_requests.clear();
+            } else if (m_is_notified && !m_requests.empty()) {
+                // Cleared before checking for room, so a completion arriving meanwhile triggers another attempt
+                m_is_notified = false;
+                has_waiting_requests = true;
+            }
+        }
+
+        for (auto &expired_request : expired_requests) {
+            expired_request.drop(HAILO_DEADLINE_EXPIRED);
+        }
+        expired_requests.clear();
+        for (auto &dropped_request : dropped_requests) {
+            dropped_request.drop(HAILO_REQUEST_DROPPED);
+        }
+        dropped_requests.clear();
+
+        if (!is_running) {
+            return;
+        }
+        if (!has_waiting_requests) {
+            continue;
+        }
+
+        // The requests stay queued while there is no room, so the queue never holds more than the watermark.
+        // The dispatcher waits for a completion to free room.
+        if (!m_can_launch()) {
+            continue;
+        }
+
+        Request request{};
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_requests.empty()) {
+                // Shed or expired while checking for room
+                continue;
+            }
+            request = std::move(m_requests.front());
+            m_requests.pop_front();
+            if (Clock::now() >= request.deadline) {
+                m_stats.expired++;
+                // The room is still free for the next waiting request
+                m_is_notified = true;
+                lock.unlock();
+                request.drop(HAILO_DEADLINE_EXPIRED);
+                continue;
+            }
+        }
+
+        auto status = request.launch();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR_RATE_LIMITED("Launching admitted infer request failed with status {}", status);
+            request.drop(status);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stats.launched++;
+        // There may be room for the next waiting request as well
+        m_is_notified = true;
+    }
+}
+
+} /* namespace hailort */
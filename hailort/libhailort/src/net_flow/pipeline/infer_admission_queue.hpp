@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2020-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_admission_queue.hpp
+ * @brief Bounded queue of requests waiting for room in the async inference pipeline, used by ConfiguredInferModel
+ *        to shed load and drop expired requests before they are sent to the device
+ **/
+
+#ifndef _HAILO_INFER_ADMISSION_QUEUE_HPP_
+#define _HAILO_INFER_ADMISSION_QUEUE_HPP_
+
+#include "hailo/infer_model.hpp"
+
+#include <condition_variable>
+#include <memory>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace hailort
+{
+
+class InferAdmissionQueue final : public std::enable_shared_from_this<InferAdmissionQueue>
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request {
+        // Clock::time_point::max() if the request has no deadline
+        Clock::time_point deadline;
+        // Sends the request to the pipeline. Called from the dispatcher thread, only after can_launch returned true.
+        std::function<hailo_status()> launch;
+        // Completes a request that won't be sent to the pipeline with the given status
+        std::function<void(hailo_status)> drop;
+    };
+
+    // can_launch returns true if the pipeline has room for another request. The dispatcher re-checks it on notify().
+    // The dispatcher thread holds a reference to the queue until stop() is called.
+    static Expected<std::shared_ptr<InferAdmissionQueue>> create(const InferAdmissionParams &params,
+        std::function<bool()> &&can_launch);
+
+    InferAdmissionQueue(const InferAdmissionParams &params, std::function<bool()> &&can_launch);
+    ~InferAdmissionQueue() = default;
+
+    // Drops the waiting requests with HAILO_REQUEST_DROPPED and stops the dispatcher. May be called from a request
+    // callback (which runs on the dispatcher thread) - the dispatcher then exits once the callback returns.
+    void stop();
+
+    InferAdmissionQueue(const InferAdmissionQueue &) = delete;
+    InferAdmissionQueue &operator=(const InferAdmissionQueue &) = delete;
+    InferAdmissionQueue(InferAdmissionQueue &&) = delete;
+    InferAdmissionQueue &operator=(InferAdmissionQueue &&) = delete;
+
+    // Queues a request, applying the shedding policy
+    void enqueue(Request &&request);
+    // Called when a request completes, so room may have been freed in the pipeline
+    void notify();
+    InferAdmissionStats get_stats();
+
+    // Deadline of a request launched without an explicit deadline
+    Clock::time_point default_deadline(Clock::time_point now) const;
+
+private:
+    void dispatcher_thread_main();
+    // Must be called with m_mutex held. Moves the expired requests to expired_requests.
+    void take_expired_requests(Clock::time_point now, std::vector<Request> &expired_requests);
+    // Must be called with m_mutex held
+    Clock::time_point earliest_deadline() const;
+
+    const InferAdmissionParams m_params;
+    std::function<bool()> m_can_launch;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Request> m_requests;
+    // Requests shed by enqueue, completed by the dispatcher so callbacks aren't called from the launching thread
+    std::vector<Request> m_dropped_requests;
+    InferAdmissionStats m_stats;
+    // Requests received while at the watermark, for KEEP_EVERY_NTH
+    uint64_t m_overloaded_requests_count;
+    bool m_is_notified;
+    bool m_is_running;
+
+    std::thread m_dispatcher_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_INFER_ADMISSION_QUEUE_HPP_ */
@@ -8,12 +8,14 @@
  **/
 
 #include "common/utils.hpp"
+#include "common/shared_library.hpp"
 #include "hailo/hailort_common.hpp"
 #include "hailo/vdevice.hpp"
 #include "hailo/infer_model.hpp"
 #include "hef/hef_internal.hpp"
 #include "net_flow/pipeline/infer_model_internal.hpp"
 #include "net_flow/pipeline/async_infer_runner.hpp"
+#include "transform/pre_process.hpp"
 
 
 #define WAIT_FOR_ASYNC_IN_DTOR_TIMEOUT (std::chrono::milliseconds(10000))
@@ -38,6 +40,10 @@ hailo_format_t InferModelBase::InferStream::Impl::format() const
 
 size_t InferModelBase::InferStream::Impl::get_frame_size() const
 {
+    if (m_has_pre_process) {
+        // Validated in set_pre_process()
+        return PreProcessContext::get_src_frame_size(m_pre_process_params).value();
+    }
     return HailoRTCommon::get_frame_size(m_vstream_info, m_user_buffer_format);
 }
 
@@ -112,6 +118,33 @@ uint32_t InferModelBase::InferStream::Impl::nms_max_accumulated_mask_size() cons
     return m_nms_max_accumulated_mask_size;
 }
 
+hailo_status InferModelBase::InferStream::Impl::set_pre_process(const hailo_pre_process_params_t &params)
+{
+    CHECK(HAILO_H2D_STREAM == m_vstream_info.direction, HAILO_INVALID_OPERATION,
+        "Pre-process can only be set for inputs, {} is an output", name());
+    CHECK_SUCCESS(PreProcessContext::validate_params(params, m_vstream_info.shape));
+
+    m_pre_process_params = params;
+    m_has_pre_process = true;
+    return HAILO_SUCCESS;
+}
+
+Expected<hailo_letterbox_info_t> InferModelBase::InferStream::Impl::get_letterbox_info() const
+{
+    CHECK_AS_EXPECTED(m_has_pre_process, HAILO_INVALID_OPERATION, "Pre-process was not set for {}", name());
+    return PreProcessContext::get_letterbox_info(m_pre_process_params, m_vstream_info.shape);
+}
+
+bool InferModelBase::InferStream::Impl::has_pre_process() const
+{
+    return m_has_pre_process;
+}
+
+const hailo_pre_process_params_t &InferModelBase::InferStream::Impl::pre_process_params() const
+{
+    return m_pre_process_params;
+}
+
 InferModelBase::InferStream::InferStream(std::shared_ptr<InferModelBase::InferStream::Impl> pimpl) : m_pimpl(pimpl)
 {
 }
@@ -181,6 +214,16 @@ void InferModelBase::InferStream::set_nms_max_accumulated_mask_size(uint32_t max
     m_pimpl->set_nms_max_accumulated_mask_size(max_accumulated_mask_size);
 }
 
+hailo_status InferModelBase::InferStream::set_pre_process(const hailo_pre_process_params_t &params)
+{
+    return m_pimpl->set_pre_process(params);
+}
+
+Expected<hailo_letterbox_info_t> InferModelBase::InferStream::get_letterbox_info() const
+{
+    return m_pimpl->get_letterbox_info();
+}
+
 float32_t InferModelBase::InferStream::nms_score_threshold() const
 {
     return m_pimpl->nms_score_threshold();
@@ -262,7 +305,8 @@ InferModelBase::InferModelBase(InferModelBase &&other) :
     m_outputs(std::move(other.m_outputs)),
     m_input_names(std::move(other.m_input_names)),
     m_output_names(std::move(other.m_output_names)),
-    m_config_params(std::move(other.m_config_params))
+    m_config_params(std::move(other.m_config_params)),
+    m_post_process_plugins(std::move(other.m_post_process_plugins))
 {
 }
 
@@ -332,6 +376,7 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
     std::unordered_map<std::string, hailo_format_t> outputs_formats;
     std::unordered_map<std::string, size_t> inputs_frame_sizes;
     std::unordered_map<std::string, size_t> outputs_frame_sizes;
+    std::unordered_map<std::string, hailo_pre_process_params_t> inputs_pre_process;
 
     auto input_vstream_infos = network_groups.value()[0]->get_input_vstream_infos();
     CHECK_EXPECTED(input_vstream_infos);
@@ -340,17 +385,47 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
         assert(contains(m_inputs, std::string(vstream_info.name)));
         inputs_formats[vstream_info.name] = m_inputs.at(vstream_info.name).format();
         inputs_frame_sizes[vstream_info.name] = m_inputs.at(vstream_info.name).get_frame_size();
+        if (has_pre_process(m_inputs.at(vstream_info.name))) {
+            inputs_pre_process[vstream_info.name] = m_inputs.at(vstream_info.name).m_pimpl->pre_process_params();
+        }
     }
 
     auto output_vstream_infos = network_groups.value()[0]->get_output_vstream_infos();
     CHECK_EXPECTED(output_vstream_infos);
 
+    std::set<std::string> plugins_streams;
+    for (const auto &plugin_params : m_post_process_plugins) {
+        for (const auto &input_stream_name : plugin_params.inputs_streams_names) {
+            plugins_streams.insert(input_stream_name.second);
+        }
+    }
+
     for (const auto &vstream_info : output_vstream_infos.value()) {
-        assert(contains(m_outputs, std::string(vstream_info.name)));
+        if (!contains(m_outputs, std::string(vstream_info.name))) {
+            // Replaced by a post-process plugin. A device stream can't feed both a plugin and an output, so all
+            // of the output's streams must be consumed by plugins.
+            TRY(const auto stream_names, network_groups.value()[0]->get_stream_names_from_vstream_name(vstream_info.name));
+            for (const auto &stream_name : stream_names) {
+                CHECK_AS_EXPECTED(contains(plugins_streams, stream_name), HAILO_INVALID_OPERATION,
+                    "Output '{}' is only partially consumed by post-process plugins (stream '{}' is not consumed)",
+                    vstream_info.name, stream_name);
+            }
+            continue;
+        }
         outputs_formats[vstream_info.name] = m_outputs.at(vstream_info.name).format();
         outputs_frame_sizes[vstream_info.name] = m_outputs.at(vstream_info.name).get_frame_size();
     }
 
+    for (const auto &plugin_params : m_post_process_plugins) {
+        const std::string output_name = plugin_params.output_vstream_info.name;
+        assert(contains(m_outputs, output_name));
+        const auto user_format = m_outputs.at(output_name).format();
+        CHECK_AS_EXPECTED((plugin_params.output_vstream_info.format.type == user_format.type) &&
+            (plugin_params.output_vstream_info.format.order == user_format.order), HAILO_INVALID_OPERATION,
+            "The format of post-process plugin output '{}' can't be changed", output_name);
+        outputs_frame_sizes[output_name] = plugin_params.output_frame_size;
+    }
+
     CHECK_AS_EXPECTED(std::all_of(m_inputs.begin(), m_inputs.end(), [](const auto &input_pair) {
         return ((input_pair.second.m_pimpl->m_nms_score_threshold == INVALID_NMS_CONFIG) &&
                 (input_pair.second.m_pimpl->m_nms_iou_threshold == INVALID_NMS_CONFIG) &&
@@ -385,7 +460,8 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
     }
 
     auto configured_infer_model_pimpl = ConfiguredInferModelImpl::create(network_groups.value()[0], inputs_formats, outputs_formats,
-        get_input_names(), get_output_names(), m_vdevice, inputs_frame_sizes, outputs_frame_sizes);
+        get_input_names(), get_output_names(), m_vdevice, inputs_frame_sizes, outputs_frame_sizes,
+        HAILO_DEFAULT_VSTREAM_TIMEOUT_MS, inputs_pre_process, m_post_process_plugins);
     CHECK_EXPECTED(configured_infer_model_pimpl);
 
     // The hef buffer is being used only when working with the service.
@@ -512,6 +588,152 @@ Expected<std::vector<InferModel::InferStream>> InferModelBase::create_infer_stre
     return outputs;
 }
 
+bool InferModelBase::has_pre_process(const InferStream &stream)
+{
+    return stream.m_pimpl->has_pre_process();
+}
+
+Expected<hailo_stream_info_t> InferModelBase::get_plugin_input_stream_info(const std::string &input_name)
+{
+    // The input is either a device output stream, or an output backed by a single device stream
+    TRY(const auto output_stream_infos, m_hef.get_output_stream_infos(m_network_name));
+    std::string stream_name = input_name;
+    if (std::none_of(output_stream_infos.begin(), output_stream_infos.end(),
+            [&input_name](const auto &stream_info) { return input_name == stream_info.name; })) {
+        CHECK_AS_EXPECTED(contains(m_outputs, input_name), HAILO_NOT_FOUND,
+            "Post-process plugin input '{}' is not an output of the model", input_name);
+        TRY(const auto stream_names, m_hef.get_stream_names_from_vstream_name(input_name, m_network_name));
+        CHECK_AS_EXPECTED(1 == stream_names.size(), HAILO_NOT_SUPPORTED,
+            "Output '{}' is made of {} device streams, post-process plugins should take the stream names instead",
+            input_name, stream_names.size());
+        stream_name = stream_names[0];
+    }
+
+    for (const auto &stream_info : output_stream_infos) {
+        if (stream_name == stream_info.name) {
+            return Expected<hailo_stream_info_t>(stream_info);
+        }
+    }
+    LOGGER__ERROR("Device stream '{}' of post-process plugin input '{}' was not found", stream_name, input_name);
+    return make_unexpected(HAILO_NOT_FOUND);
+}
+
+void InferModelBase::remove_output(const std::string &name)
+{
+    m_outputs.erase(name);
+    m_output_names.erase(std::remove(m_output_names.begin(), m_output_names.end(), name), m_output_names.end());
+    m_outputs_vector.erase(std::remove_if(m_outputs_vector.begin(), m_outputs_vector.end(),
+        [&name](const auto &output) { return name == output.name(); }), m_outputs_vector.end());
+}
+
+hailo_status InferModelBase::add_post_process_plugin(PostProcessPluginPtr plugin)
+{
+    CHECK_ARG_NOT_NULL(plugin);
+    const auto plugin_name = plugin->name();
+    CHECK(!contains(m_inputs, plugin_name) && !contains(m_outputs, plugin_name), HAILO_INVALID_ARGUMENT,
+        "Post-process plugin name '{}' is already used by the model", plugin_name);
+    CHECK(plugin_name.size() < HAILO_MAX_STREAM_NAME_SIZE, HAILO_INVALID_ARGUMENT,
+        "Post-process plugin name '{}' is too long", plugin_name);
+
+    const auto input_names = plugin->input_names();
+    CHECK(!input_names.empty(), HAILO_INVALID_ARGUMENT, "Post-process plugin '{}' has no inputs", plugin_name);
+
+    // A device stream can feed a single pipeline branch
+    std::set<std::string> consumed_streams;
+    for (const auto &other_plugin : m_post_process_plugins) {
+        for (const auto &input_stream_name : other_plugin.inputs_streams_names) {
+            consumed_streams.insert(input_stream_name.second);
+        }
+    }
+
+    PostProcessPluginParams plugin_params{};
+    plugin_params.plugin = plugin;
+    std::map<std::string, PostProcessPluginInputInfo> inputs_info;
+    for (const auto &input_name : input_names) {
+        TRY(const auto stream_info, get_plugin_input_stream_info(input_name));
+        CHECK(!contains(consumed_streams, std::string(stream_info.name)), HAILO_INVALID_OPERATION,
+            "Device stream '{}' (post-process plugin '{}' input '{}') is already consumed by a post-process plugin",
+            stream_info.name, plugin_name, input_name);
+        consumed_streams.insert(stream_info.name);
+
+        PostProcessPluginInputInfo input_info{};
+        input_info.stream_name = stream_info.name;
+        input_info.shape = stream_info.shape;
+        input_info.hw_shape = stream_info.hw_shape;
+        input_info.format = stream_info.format;
+        input_info.quant_info = stream_info.quant_info;
+        input_info.frame_size = stream_info.hw_frame_size;
+        inputs_info.emplace(input_name, input_info);
+        plugin_params.inputs_streams_names.emplace(input_name, stream_info.name);
+    }
+
+    TRY(plugin_params.output_frame_size, plugin->configure(inputs_info),
+        "Failed configuring post-process plugin '{}'", plugin_name);
+    CHECK((0 < plugin_params.output_frame_size) && (plugin_params.output_frame_size <= UINT32_MAX), HAILO_INVALID_ARGUMENT,
+        "Invalid output frame size {} of post-process plugin '{}'", plugin_params.output_frame_size, plugin_name);
+
+    // The outputs sharing device streams with the plugin's inputs are replaced by the plugin's output
+    TRY(const auto output_vstream_infos, m_hef.get_output_vstream_infos(m_network_name));
+    for (const auto &vstream_info : output_vstream_infos) {
+        if (!contains(m_outputs, std::string(vstream_info.name))) {
+            continue;
+        }
+        TRY(const auto stream_names, m_hef.get_stream_names_from_vstream_name(vstream_info.name, m_network_name));
+        const auto is_consumed = std::any_of(stream_names.begin(), stream_names.end(), [&plugin_params](const auto &stream_name) {
+            return std::any_of(plugin_params.inputs_streams_names.begin(), plugin_params.inputs_streams_names.end(),
+                [&stream_name](const auto &input_stream_name) { return stream_name == input_stream_name.second; });
+        });
+        if (is_consumed) {
+            LOGGER__INFO("Output '{}' is replaced by post-process plugin '{}'", vstream_info.name, plugin_name);
+            remove_output(vstream_info.name);
+        }
+    }
+
+    auto &output_vstream_info = plugin_params.output_vstream_info;
+    output_vstream_info = {};
+    strncpy(output_vstream_info.name, plugin_name.c_str(), HAILO_MAX_STREAM_NAME_SIZE - 1);
+    strncpy(output_vstream_info.network_name, output_vstream_infos[0].network_name, HAILO_MAX_NETWORK_NAME_SIZE - 1);
+    output_vstream_info.direction = HAILO_D2H_STREAM;
+    output_vstream_info.format.type = HAILO_FORMAT_TYPE_UINT8;
+    output_vstream_info.format.order = HAILO_FORMAT_ORDER_NC;
+    output_vstream_info.format.flags = HAILO_FORMAT_FLAGS_NONE;
+    output_vstream_info.shape = {1, 1, static_cast<uint32_t>(plugin_params.output_frame_size)};
+    output_vstream_info.quant_info = {0.0f, 1.0f, 0.0f, 255.0f};
+
+    auto pimpl = make_shared_nothrow<InferModel::InferStream::Impl>(output_vstream_info);
+    CHECK_NOT_NULL(pimpl, HAILO_OUT_OF_HOST_MEMORY);
+    InferModel::InferStream stream(pimpl);
+    m_outputs_vector.push_back(stream);
+    m_outputs.emplace(plugin_name, stream);
+    m_output_names.push_back(plugin_name);
+
+    m_post_process_plugins.emplace_back(std::move(plugin_params));
+    return HAILO_SUCCESS;
+}
+
+hailo_status InferModelBase::add_post_process_plugin(const std::string &library_path, const std::string &config)
+{
+    TRY(auto library, SharedLibrary::open(library_path));
+    TRY(auto create_plugin,
+        library.get_function<hailo_create_post_process_plugin_func_t>(HAILO_POST_PROCESS_PLUGIN_CREATE_FUNC_NAME));
+
+    auto raw_plugin = create_plugin(HAILO_POST_PROCESS_PLUGIN_API_VERSION, config.c_str());
+    CHECK(nullptr != raw_plugin, HAILO_INVALID_OPERATION, "Post-process plugin library {} failed creating the plugin",
+        library_path);
+
+    auto library_ptr = make_shared_nothrow<SharedLibrary>(std::move(library));
+    if (nullptr == library_ptr) {
+        delete raw_plugin;
+        return HAILO_OUT_OF_HOST_MEMORY;
+    }
+
+    // The plugin's code lives in the library, so the library is unloaded only after the plugin is deleted
+    PostProcessPluginPtr plugin(raw_plugin, [library_ptr](PostProcessPlugin *plugin_to_delete) {
+        delete plugin_to_delete;
+    });
+    return add_post_process_plugin(plugin);
+}
+
 ConfiguredInferModel::ConfiguredInferModel(std::shared_ptr<ConfiguredInferModelBase> pimpl) : m_pimpl(pimpl)
 {
 }
@@ -594,6 +816,53 @@ hailo_status ConfiguredInferModel::shutdown()
     return m_pimpl->shutdown();
 }
 
+hailo_status ConfiguredInferModel::enable_result_cache(const InferResultCacheParams &params)
+{
+    return m_pimpl->enable_result_cache(params);
+}
+
+hailo_status ConfiguredInferModel::disable_result_cache()
+{
+    return m_pimpl->disable_result_cache();
+}
+
+Expected<InferResultCacheStats> ConfiguredInferModel::get_result_cache_stats()
+{
+    return m_pimpl->get_result_cache_stats();
+}
+
+Expected<AsyncInferJob> ConfiguredInferModel::run_async(const ConfiguredInferModel::Bindings &bindings,
+    std::chrono::steady_clock::time_point deadline, std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    auto async_infer_job = m_pimpl->run_async_with_deadline(bindings, deadline, callback);
+    if (HAILO_SUCCESS != async_infer_job.status()) {
+        shutdown();
+        return make_unexpected(async_infer_job.status());
+    }
+
+    return async_infer_job.release();
+}
+
+hailo_status ConfiguredInferModel::enable_admission_control(const InferAdmissionParams &params)
+{
+    return m_pimpl->enable_admission_control(params);
+}
+
+hailo_status ConfiguredInferModel::disable_admission_control()
+{
+    return m_pimpl->disable_admission_control();
+}
+
+Expected<InferAdmissionStats> ConfiguredInferModel::get_admission_stats()
+{
+    return m_pimpl->get_admission_stats();
+}
+
+hailo_status ConfiguredInferModel::update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates)
+{
+    return m_pimpl->update_nms_config(updates);
+}
+
 Expected<AsyncInferJob> ConfiguredInferModel::run_async(const std::vector<ConfiguredInferModel::Bindings> &bindings,
     std::function<void(const AsyncInferCompletionInfo &)> callback)
 {
@@ -657,6 +926,55 @@ void ConfiguredInferModelBase::mark_callback_done(std::shared_ptr<AsyncInferJobI
     job_pimpl->mark_callback_done();
 }
 
+hailo_status ConfiguredInferModelBase::enable_result_cache(const InferResultCacheParams &/*params*/)
+{
+    LOGGER__ERROR("Result cache is not supported for this configured infer model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelBase::disable_result_cache()
+{
+    LOGGER__ERROR("Result cache is not supported for this configured infer model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<InferResultCacheStats> ConfiguredInferModelBase::get_result_cache_stats()
+{
+    LOGGER__ERROR("Result cache is not supported for this configured infer model");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelBase::run_async_with_deadline(const ConfiguredInferModel::Bindings &/*bindings*/,
+    std::chrono::steady_clock::time_point /*deadline*/, std::function<void(const AsyncInferCompletionInfo &)> /*callback*/)
+{
+    LOGGER__ERROR("Admission control is not supported for this configured infer model");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+hailo_status ConfiguredInferModelBase::enable_admission_control(const InferAdmissionParams &/*params*/)
+{
+    LOGGER__ERROR("Admission control is not supported for this configured infer model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelBase::disable_admission_control()
+{
+    LOGGER__ERROR("Admission control is not supported for this configured infer model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<InferAdmissionStats> ConfiguredInferModelBase::get_admission_stats()
+{
+    LOGGER__ERROR("Admission control is not supported for this configured infer model");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+hailo_status ConfiguredInferModelBase::update_nms_config(const std::map<std::string, NmsConfigUpdate> &/*updates*/)
+{
+    LOGGER__ERROR("Updating the NMS config is not supported for this configured infer model");
+    return HAILO_NOT_SUPPORTED;
+}
+
 hailo_status ConfiguredInferModelBase::run(const ConfiguredInferModel::Bindings &bindings, std::chrono::milliseconds timeout)
 {
     auto job = run_async(bindings, [] (const AsyncInferCompletionInfo &) {});
@@ -673,9 +991,11 @@ Expected<std::shared_ptr<ConfiguredInferModelImpl>> ConfiguredInferModelImpl::cr
     const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
     const std::vector<std::string> &input_names, const std::vector<std::string> &output_names, VDevice &vdevice,
     const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
-    const uint32_t timeout)
+    const uint32_t timeout, const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process,
+    const std::vector<PostProcessPluginParams> &post_process_plugins)
 {
-    auto async_infer_runner = AsyncInferRunnerImpl::create(net_group, inputs_formats, outputs_formats, timeout);
+    auto async_infer_runner = AsyncInferRunnerImpl::create(net_group, inputs_formats, outputs_formats, timeout,
+        inputs_pre_process, post_process_plugins);
     CHECK_EXPECTED(async_infer_runner);
 
     auto &hw_elem = async_infer_runner.value()->get_async_pipeline()->get_async_hw_element();
@@ -690,8 +1010,14 @@ Expected<std::shared_ptr<ConfiguredInferModelImpl>> ConfiguredInferModelImpl::cr
         }
     }
 
+    std::vector<hailo_vstream_info_t> plugins_outputs_infos;
+    plugins_outputs_infos.reserve(post_process_plugins.size());
+    for (const auto &plugin_params : post_process_plugins) {
+        plugins_outputs_infos.push_back(plugin_params.output_vstream_info);
+    }
+
     auto configured_infer_model_pimpl = make_shared_nothrow<ConfiguredInferModelImpl>(net_group, async_infer_runner.release(),
-        input_names, output_names, inputs_frame_sizes, outputs_frame_sizes);
+        input_names, output_names, inputs_frame_sizes, outputs_frame_sizes, plugins_outputs_infos);
     CHECK_NOT_NULL_AS_EXPECTED(configured_infer_model_pimpl, HAILO_OUT_OF_HOST_MEMORY);
 
     return configured_infer_model_pimpl;
@@ -710,9 +1036,11 @@ Expected<std::shared_ptr<ConfiguredInferModelImpl>> ConfiguredInferModelImpl::cr
 
 ConfiguredInferModelImpl::ConfiguredInferModelImpl(std::shared_ptr<ConfiguredNetworkGroup> cng,
     std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
-    const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes) :
+    const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
+    const std::vector<hailo_vstream_info_t> &plugins_outputs_infos) :
     ConfiguredInferModelBase(inputs_frame_sizes, outputs_frame_sizes),
-    m_cng(cng), m_async_infer_runner(async_infer_runner), m_ongoing_parallel_transfers(0), m_input_names(input_names), m_output_names(output_names)
+    m_cng(cng), m_async_infer_runner(async_infer_runner), m_ongoing_parallel_transfers(0), m_input_names(input_names), m_output_names(output_names),
+    m_plugins_outputs_infos(plugins_outputs_infos)
 {
 }
 
@@ -738,6 +1066,15 @@ Expected<ConfiguredInferModel::Bindings> ConfiguredInferModelImpl::create_bindin
     CHECK_EXPECTED(output_vstream_infos);
 
     for (const auto &vstream_info : output_vstream_infos.value()) {
+        if (!contains(m_output_names, std::string(vstream_info.name))) {
+            // Replaced by a post-process plugin
+            continue;
+        }
+        TRY(auto stream, ConfiguredInferModelBase::create_infer_stream(vstream_info));
+        outputs.emplace(vstream_info.name, std::move(stream));
+    }
+
+    for (const auto &vstream_info : m_plugins_outputs_infos) {
         TRY(auto stream, ConfiguredInferModelBase::create_infer_stream(vstream_info));
         outputs.emplace(vstream_info.name, std::move(stream));
     }
@@ -749,6 +1086,11 @@ Expected<ConfiguredInferModel::Bindings> ConfiguredInferModelImpl::create_bindin
 hailo_status ConfiguredInferModelImpl::wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count)
 {
     std::unique_lock<std::mutex> lock(m_mutex);
+    if (nullptr != m_admission_queue) {
+        // Requests wait in the admission queue (or are shed) instead of failing on a full pipeline
+        return HAILO_SUCCESS;
+    }
+
     hailo_status status = HAILO_SUCCESS;
     std::string elem_name = "";
     bool was_successful = m_cv.wait_for(lock, timeout, [this, frames_count, &status, &elem_name] () -> bool {
@@ -762,15 +1104,21 @@ hailo_status ConfiguredInferModelImpl::wait_for_async_ready(std::chrono::millise
     });
     CHECK_SUCCESS(status);
 
-    CHECK(was_successful, HAILO_TIMEOUT,
-        "Got timeout in `wait_for_async_ready` ({}ms) - the edge '{}' could not receive {} transfer-requests",
-        timeout.count(), elem_name, frames_count);
+    // Applications commonly poll with short timeouts, so this may fail on every frame
+    if (!was_successful) {
+        LOGGER__ERROR_RATE_LIMITED(
+            "Got timeout in `wait_for_async_ready` ({}ms) - the edge '{}' could not receive {} transfer-requests",
+            timeout.count(), elem_name, frames_count);
+        return HAILO_TIMEOUT;
+    }
 
     return HAILO_SUCCESS;
 }
 
 hailo_status ConfiguredInferModelImpl::shutdown()
 {
+    // Requests waiting for admission are dropped, so they don't hold the shutdown
+    disable_admission_control();
     m_async_infer_runner->abort();
     std::unique_lock<std::mutex> lock(m_mutex);
     m_cv.wait_for(lock, WAIT_FOR_ASYNC_IN_DTOR_TIMEOUT, [this] () -> bool {
@@ -869,29 +1217,107 @@ hailo_status ConfiguredInferModelImpl::validate_bindings(const ConfiguredInferMo
 
 Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(const ConfiguredInferModel::Bindings &bindings,
     std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    std::shared_ptr<InferAdmissionQueue> admission_queue = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        admission_queue = m_admission_queue;
+    }
+
+    const auto deadline = (nullptr != admission_queue) ?
+        admission_queue->default_deadline(std::chrono::steady_clock::now()) : std::chrono::steady_clock::time_point::max();
+    return run_async_impl(bindings, callback, admission_queue, deadline);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async_with_deadline(const ConfiguredInferModel::Bindings &bindings,
+    std::chrono::steady_clock::time_point deadline, std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    std::shared_ptr<InferAdmissionQueue> admission_queue = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        admission_queue = m_admission_queue;
+    }
+    CHECK_AS_EXPECTED(nullptr != admission_queue, HAILO_INVALID_OPERATION,
+        "Requests with a deadline require admission control (see enable_admission_control)");
+
+    return run_async_impl(bindings, callback, admission_queue, deadline);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async_impl(const ConfiguredInferModel::Bindings &bindings,
+    std::function<void(const AsyncInferCompletionInfo &)> callback, std::shared_ptr<InferAdmissionQueue> admission_queue,
+    std::chrono::steady_clock::time_point deadline)
 {
     CHECK_SUCCESS_AS_EXPECTED(validate_bindings(bindings));
 
+    std::shared_ptr<InferResultCache> result_cache = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        result_cache = m_result_cache;
+    }
+
+    uint64_t cache_key = 0;
+    std::vector<MemoryView> cached_outputs;
+    if (nullptr != result_cache) {
+        if (!get_result_cache_key(bindings, cache_key, cached_outputs)) {
+            result_cache->count_bypassed();
+            result_cache = nullptr;
+        } else if (result_cache->fetch(cache_key, cached_outputs)) {
+            return run_async_from_cache(result_cache, callback);
+        }
+    }
+
     auto job_pimpl = make_shared_nothrow<AsyncInferJobImpl>(static_cast<uint32_t>(m_input_names.size() + m_output_names.size()));
     CHECK_NOT_NULL_AS_EXPECTED(job_pimpl, HAILO_OUT_OF_HOST_MEMORY);
 
-    TransferDoneCallbackAsyncInfer transfer_done = [this, bindings, job_pimpl, callback](hailo_status status) {
+    TransferDoneCallbackAsyncInfer transfer_done = [this, bindings, job_pimpl, callback, result_cache, cache_key, cached_outputs]
+        (hailo_status status) {
         bool should_call_callback = ConfiguredInferModelBase::get_stream_done(status, job_pimpl);
         if (should_call_callback) {
             auto final_status = (m_async_infer_runner->get_pipeline_status() == HAILO_SUCCESS) ?
                 ConfiguredInferModelBase::get_completion_status(job_pimpl) : m_async_infer_runner->get_pipeline_status();
 
+            // Outputs are stored before the callback, since the user may reuse the buffers once it is called
+            if ((nullptr != result_cache) && (HAILO_SUCCESS == final_status)) {
+                auto status = result_cache->store(cache_key, cached_outputs);
+                if (HAILO_SUCCESS != status) {
+                    LOGGER__WARNING("Failed to store inference result in cache, status = {}", status);
+                }
+            }
+
             AsyncInferCompletionInfo completion_info(final_status);
             callback(completion_info);
             ConfiguredInferModelBase::mark_callback_done(job_pimpl);
             {
                 std::unique_lock<std::mutex> lock(m_mutex);
                 m_ongoing_parallel_transfers--;
+                if (nullptr != m_admission_queue) {
+                    m_admission_queue->notify();
+                }
             }
             m_cv.notify_all();
         }
     };
 
+    if (nullptr != admission_queue) {
+        {
+            // Counted from admission, so shutdown waits for the request until it is launched or dropped
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ongoing_parallel_transfers++;
+        }
+
+        InferAdmissionQueue::Request request{};
+        request.deadline = deadline;
+        request.launch = [this, bindings, transfer_done]() {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return m_async_infer_runner->run(bindings, transfer_done);
+        };
+        request.drop = [this, job_pimpl, callback](hailo_status status) {
+            complete_dropped_request(job_pimpl, callback, status);
+        };
+        admission_queue->enqueue(std::move(request));
+        return AsyncInferJobImpl::create(job_pimpl);
+    }
+
     {
         std::unique_lock<std::mutex> lock(m_mutex);
         auto status = m_async_infer_runner->run(bindings, transfer_done);
@@ -903,6 +1329,170 @@ Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(const ConfiguredInfe
     return AsyncInferJobImpl::create(job_pimpl);
 }
 
+bool ConfiguredInferModelImpl::get_result_cache_key(const ConfiguredInferModel::Bindings &bindings, uint64_t &key,
+    std::vector<MemoryView> &outputs)
+{
+    // Only user memory is hashed and copied - other buffer types (e.g. dma-bufs) are sent to the device
+    key = 0;
+    for (const auto &name : m_input_names) {
+        auto stream = bindings.input(name);
+        if (!stream || (BufferType::VIEW != ConfiguredInferModelBase::get_infer_stream_buffer_type(stream.value()))) {
+            return false;
+        }
+        auto view = stream->get_buffer();
+        if (!view) {
+            return false;
+        }
+        key = InferResultCache::hash(view.value(), key);
+    }
+
+    outputs.clear();
+    outputs.reserve(m_output_names.size());
+    for (const auto &name : m_output_names) {
+        auto stream = bindings.output(name);
+        if (!stream || (BufferType::VIEW != ConfiguredInferModelBase::get_infer_stream_buffer_type(stream.value()))) {
+            return false;
+        }
+        auto view = stream->get_buffer();
+        if (!view) {
+            return false;
+        }
+        outputs.emplace_back(view.release());
+    }
+
+    return true;
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async_from_cache(std::shared_ptr<InferResultCache> result_cache,
+    std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    auto job_pimpl = make_shared_nothrow<AsyncInferJobImpl>(1);
+    CHECK_NOT_NULL_AS_EXPECTED(job_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_ongoing_parallel_transfers++;
+    }
+
+    // The callback is not called from the caller's context, same as for requests sent to the device
+    result_cache->dispatch_callback([this, job_pimpl, callback]() {
+        ConfiguredInferModelBase::get_stream_done(HAILO_SUCCESS, job_pimpl);
+        AsyncInferCompletionInfo completion_info(HAILO_SUCCESS);
+        callback(completion_info);
+        ConfiguredInferModelBase::mark_callback_done(job_pimpl);
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ongoing_parallel_transfers--;
+        }
+        m_cv.notify_all();
+    });
+
+    return AsyncInferJobImpl::create(job_pimpl);
+}
+
+void ConfiguredInferModelImpl::complete_dropped_request(std::shared_ptr<AsyncInferJobImpl> job_pimpl,
+    std::function<void(const AsyncInferCompletionInfo &)> callback, hailo_status status)
+{
+    AsyncInferCompletionInfo completion_info(status);
+    callback(completion_info);
+    ConfiguredInferModelBase::mark_callback_done(job_pimpl);
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_ongoing_parallel_transfers--;
+    }
+    m_cv.notify_all();
+}
+
+hailo_status ConfiguredInferModelImpl::enable_admission_control(const InferAdmissionParams &params)
+{
+    TRY(auto admission_queue, InferAdmissionQueue::create(params, [this]() {
+        auto pools_are_ready_pair = m_async_infer_runner->can_push_buffers(1);
+        // On failure the request is launched anyway, so it is completed with the pipeline's error
+        return !pools_are_ready_pair || pools_are_ready_pair->first;
+    }));
+
+    {
+        // The previous queue is stopped outside of the lock, since dropping its requests takes the lock
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::swap(admission_queue, m_admission_queue);
+    }
+    if (nullptr != admission_queue) {
+        admission_queue->stop();
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::disable_admission_control()
+{
+    std::shared_ptr<InferAdmissionQueue> admission_queue = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::swap(admission_queue, m_admission_queue);
+    }
+    if (nullptr != admission_queue) {
+        admission_queue->stop();
+    }
+    return HAILO_SUCCESS;
+}
+
+Expected<InferAdmissionStats> ConfiguredInferModelImpl::get_admission_stats()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    CHECK_AS_EXPECTED(nullptr != m_admission_queue, HAILO_INVALID_OPERATION, "Admission control is not enabled");
+    return m_admission_queue->get_stats();
+}
+
+hailo_status ConfiguredInferModelImpl::update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates)
+{
+    for (const auto &name_to_update : updates) {
+        CHECK(contains(m_output_names, name_to_update.first), HAILO_NOT_FOUND, "Output {} not found", name_to_update.first);
+    }
+    // The pipeline's NMS ops share the post-process metadata of the network group
+    CHECK_SUCCESS(m_cng->update_nms_config(updates));
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (nullptr != m_result_cache) {
+        // The cached results were produced with the previous thresholds
+        m_result_cache->clear();
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::enable_result_cache(const InferResultCacheParams &params)
+{
+    std::vector<size_t> outputs_frame_sizes;
+    outputs_frame_sizes.reserve(m_output_names.size());
+    for (const auto &name : m_output_names) {
+        CHECK(contains(m_outputs_frame_sizes, name), HAILO_INTERNAL_FAILURE);
+        outputs_frame_sizes.emplace_back(m_outputs_frame_sizes.at(name));
+    }
+    TRY(auto result_cache, InferResultCache::create(params, outputs_frame_sizes));
+
+    {
+        // The previous cache is released outside of the lock, since it waits for pending callbacks that take the lock
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::swap(result_cache, m_result_cache);
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::disable_result_cache()
+{
+    std::shared_ptr<InferResultCache> result_cache = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::swap(result_cache, m_result_cache);
+    }
+    return HAILO_SUCCESS;
+}
+
+Expected<InferResultCacheStats> ConfiguredInferModelImpl::get_result_cache_stats()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    CHECK_AS_EXPECTED(nullptr != m_result_cache, HAILO_INVALID_OPERATION, "Result cache is not enabled");
+    return m_result_cache->get_stats();
+}
+
 Expected<LatencyMeasurementResult> ConfiguredInferModelImpl::get_hw_latency_measurement()
 {
     return m_cng->get_latency_measurement();
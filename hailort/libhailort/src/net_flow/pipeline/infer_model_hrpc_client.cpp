@@ -70,6 +70,9 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
 {
     rpc_create_configured_infer_model_request_params_t request_params;
     for (const auto &input : m_inputs) {
+        CHECK_AS_EXPECTED(!has_pre_process(input.second), HAILO_NOT_SUPPORTED,
+            "Pre-process is not supported when working with a remote device (input {})", input.second.name());
+
         rpc_stream_params_t current_stream_params;
         current_stream_params.format_order = static_cast<uint32_t>(input.second.format().order);
         current_stream_params.format_type = static_cast<uint32_t>(input.second.format().type);
@@ -135,6 +138,21 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
     return ConfiguredInferModelBase::create(cim_client_ptr);
 }
 
+hailo_status InferModelHrpcClient::add_post_process_plugin(PostProcessPluginPtr plugin)
+{
+    (void)plugin;
+    LOGGER__ERROR("Post-process plugins are not supported when working with a remote device");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status InferModelHrpcClient::add_post_process_plugin(const std::string &library_path, const std::string &config)
+{
+    (void)library_path;
+    (void)config;
+    LOGGER__ERROR("Post-process plugins are not supported when working with a remote device");
+    return HAILO_NOT_SUPPORTED;
+}
+
 Expected<ConfiguredInferModel> InferModelHrpcClient::configure_for_ut(std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
     const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
     const std::unordered_map<std::string, size_t> inputs_frame_sizes,
@@ -37,6 +37,8 @@ public:
     InferModelHrpcClient &operator=(InferModelHrpcClient &&) = delete;
 
     virtual Expected<ConfiguredInferModel> configure() override;
+    virtual hailo_status add_post_process_plugin(PostProcessPluginPtr plugin) override;
+    virtual hailo_status add_post_process_plugin(const std::string &library_path, const std::string &config = "") override;
 
     virtual Expected<ConfiguredInferModel> configure_for_ut(std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
@@ -16,6 +16,8 @@
 
 #include "hailo/infer_model.hpp"
 #include "net_flow/pipeline/async_infer_runner.hpp"
+#include "net_flow/pipeline/infer_result_cache.hpp"
+#include "net_flow/pipeline/infer_admission_queue.hpp"
 #include "net_flow/ops/nms_post_process.hpp"
 #include "hrpc/client.hpp"
 
@@ -71,6 +73,8 @@ public:
     virtual const std::vector<InferStream> &outputs() const override;
     virtual const std::vector<std::string> &get_input_names() const override;
     virtual const std::vector<std::string> &get_output_names() const override;
+    virtual hailo_status add_post_process_plugin(PostProcessPluginPtr plugin) override;
+    virtual hailo_status add_post_process_plugin(const std::string &library_path, const std::string &config = "") override;
 
     virtual Expected<ConfiguredInferModel> configure_for_ut(std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
@@ -81,6 +85,9 @@ public:
 protected:
     static Expected<std::vector<InferModel::InferStream>> create_infer_stream_inputs(Hef &hef, const std::string &network_name);
     static Expected<std::vector<InferModel::InferStream>> create_infer_stream_outputs(Hef &hef, const std::string &network_name);
+    static bool has_pre_process(const InferStream &stream);
+    Expected<hailo_stream_info_t> get_plugin_input_stream_info(const std::string &input_name);
+    void remove_output(const std::string &name);
 
     std::reference_wrapper<VDevice> m_vdevice;
     Hef m_hef;
@@ -92,6 +99,7 @@ protected:
     std::vector<std::string> m_input_names;
     std::vector<std::string> m_output_names;
     ConfigureNetworkParams m_config_params;
+    std::vector<PostProcessPluginParams> m_post_process_plugins;
 };
 
 class InferModel::InferStream::Impl
@@ -99,7 +107,8 @@ class InferModel::InferStream::Impl
 public:
     Impl(const hailo_vstream_info_t &vstream_info) : m_vstream_info(vstream_info), m_user_buffer_format(vstream_info.format),
         m_nms_score_threshold(static_cast<float32_t>(INVALID_NMS_CONFIG)), m_nms_iou_threshold(static_cast<float32_t>(INVALID_NMS_CONFIG)),
-        m_nms_max_proposals_per_class(static_cast<uint32_t>(INVALID_NMS_CONFIG)), m_nms_max_accumulated_mask_size(static_cast<uint32_t>(INVALID_NMS_CONFIG))
+        m_nms_max_proposals_per_class(static_cast<uint32_t>(INVALID_NMS_CONFIG)), m_nms_max_accumulated_mask_size(static_cast<uint32_t>(INVALID_NMS_CONFIG)),
+        m_has_pre_process(false), m_pre_process_params()
     {
         m_user_buffer_format.flags = HAILO_FORMAT_FLAGS_NONE; // Init user's format flags to NONE for transposed models
     }
@@ -124,6 +133,11 @@ public:
     uint32_t nms_max_proposals_per_class() const;
     uint32_t nms_max_accumulated_mask_size() const;
 
+    hailo_status set_pre_process(const hailo_pre_process_params_t &params);
+    Expected<hailo_letterbox_info_t> get_letterbox_info() const;
+    bool has_pre_process() const;
+    const hailo_pre_process_params_t &pre_process_params() const;
+
 private:
     friend class InferModel;
     friend class InferModelBase;
@@ -136,6 +150,9 @@ private:
     float32_t m_nms_iou_threshold;
     uint32_t m_nms_max_proposals_per_class;
     uint32_t m_nms_max_accumulated_mask_size;
+
+    bool m_has_pre_process;
+    hailo_pre_process_params_t m_pre_process_params;
 };
 
 class AsyncInferJobBase
@@ -194,6 +211,15 @@ public:
     virtual hailo_status set_scheduler_priority(uint8_t priority) = 0;
     virtual Expected<size_t> get_async_queue_size() = 0;
     virtual hailo_status shutdown() = 0;
+    virtual hailo_status enable_result_cache(const InferResultCacheParams &params);
+    virtual hailo_status disable_result_cache();
+    virtual Expected<InferResultCacheStats> get_result_cache_stats();
+    virtual Expected<AsyncInferJob> run_async_with_deadline(const ConfiguredInferModel::Bindings &bindings,
+        std::chrono::steady_clock::time_point deadline, std::function<void(const AsyncInferCompletionInfo &)> callback);
+    virtual hailo_status enable_admission_control(const InferAdmissionParams &params);
+    virtual hailo_status disable_admission_control();
+    virtual Expected<InferAdmissionStats> get_admission_stats();
+    virtual hailo_status update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates);
 
     static Expected<ConfiguredInferModel::Bindings> create_bindings(
         std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&inputs,
@@ -220,11 +246,14 @@ public:
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names, VDevice &vdevice,
         const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
-        const uint32_t timeout = HAILO_DEFAULT_VSTREAM_TIMEOUT_MS);
+        const uint32_t timeout = HAILO_DEFAULT_VSTREAM_TIMEOUT_MS,
+        const std::unordered_map<std::string, hailo_pre_process_params_t> &inputs_pre_process = {},
+        const std::vector<PostProcessPluginParams> &post_process_plugins = {});
 
     ConfiguredInferModelImpl(std::shared_ptr<ConfiguredNetworkGroup> cng, std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
-        const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes);
+        const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
+        const std::vector<hailo_vstream_info_t> &plugins_outputs_infos = {});
     ~ConfiguredInferModelImpl();
     virtual Expected<ConfiguredInferModel::Bindings> create_bindings() override;
     virtual hailo_status wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count) override;
@@ -238,6 +267,15 @@ public:
     virtual hailo_status set_scheduler_priority(uint8_t priority) override;
     virtual Expected<size_t> get_async_queue_size() override;
     virtual hailo_status shutdown() override;
+    virtual hailo_status enable_result_cache(const InferResultCacheParams &params) override;
+    virtual hailo_status disable_result_cache() override;
+    virtual Expected<InferResultCacheStats> get_result_cache_stats() override;
+    virtual Expected<AsyncInferJob> run_async_with_deadline(const ConfiguredInferModel::Bindings &bindings,
+        std::chrono::steady_clock::time_point deadline, std::function<void(const AsyncInferCompletionInfo &)> callback) override;
+    virtual hailo_status enable_admission_control(const InferAdmissionParams &params) override;
+    virtual hailo_status disable_admission_control() override;
+    virtual Expected<InferAdmissionStats> get_admission_stats() override;
+    virtual hailo_status update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates) override;
 
     static Expected<std::shared_ptr<ConfiguredInferModelImpl>> create_for_ut(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
@@ -245,6 +283,16 @@ public:
 
 private:
     virtual hailo_status validate_bindings(const ConfiguredInferModel::Bindings &bindings) override;
+    // Returns false if the bindings can't be cached
+    bool get_result_cache_key(const ConfiguredInferModel::Bindings &bindings, uint64_t &key, std::vector<MemoryView> &outputs);
+    Expected<AsyncInferJob> run_async_from_cache(std::shared_ptr<InferResultCache> result_cache,
+        std::function<void(const AsyncInferCompletionInfo &)> callback);
+    // If admission_queue isn't nullptr, the request is queued in it instead of being sent to the pipeline
+    Expected<AsyncInferJob> run_async_impl(const ConfiguredInferModel::Bindings &bindings,
+        std::function<void(const AsyncInferCompletionInfo &)> callback,
+        std::shared_ptr<InferAdmissionQueue> admission_queue, std::chrono::steady_clock::time_point deadline);
+    void complete_dropped_request(std::shared_ptr<AsyncInferJobImpl> job_pimpl,
+        std::function<void(const AsyncInferCompletionInfo &)> callback, hailo_status status);
 
     std::shared_ptr<ConfiguredNetworkGroup> m_cng;
     std::unique_ptr<ActivatedNetworkGroup> m_ang;
@@ -254,6 +302,10 @@ private:
     std::condition_variable m_cv;
     std::vector<std::string> m_input_names;
     std::vector<std::string> m_output_names;
+    // Outputs produced by post-process plugins (not outputs of the network group)
+    std::vector<hailo_vstream_info_t> m_plugins_outputs_infos;
+    std::shared_ptr<InferResultCache> m_result_cache;
+    std::shared_ptr<InferAdmissionQueue> m_admission_queue;
 };
 
 } /* namespace hailort */
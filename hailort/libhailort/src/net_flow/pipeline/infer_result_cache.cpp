@@ -0,0 +1,259 @@
+/**
+ * Copyright (c) 2020-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_result_cache.cpp
+ * @brief Content addressed cache of inference results, used by ConfiguredInferModel
+ **/
+
+#include "net_flow/pipeline/infer_result_cache.hpp"
+#include "common/utils.hpp"
+
+#include <cstring>
+
+
+namespace hailort
+{
+
+static constexpr uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static constexpr uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static constexpr uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+static constexpr uint64_t XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static constexpr uint64_t XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+static inline uint64_t rotl64(uint64_t value, uint32_t bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t read64(const uint8_t *ptr)
+{
+    uint64_t value = 0;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+static inline uint32_t read32(const uint8_t *ptr)
+{
+    uint32_t value = 0;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+static inline uint64_t xxh64_round(uint64_t acc, uint64_t input)
+{
+    acc += input * XXH_PRIME64_2;
+    acc = rotl64(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+
+static inline uint64_t xxh64_merge_round(uint64_t acc, uint64_t value)
+{
+    acc ^= xxh64_round(0, value);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+uint64_t InferResultCache::hash(const MemoryView buffer, uint64_t seed)
+{
+    const uint8_t *ptr = buffer.data();
+    const size_t size = buffer.size();
+    const uint8_t *const end = ptr + size;
+    uint64_t result = 0;
+
+    if (size >= 32) {
+        // 4 independent lanes, so the loop is bound by memory bandwidth and not by the multiply latency
+        uint64_t v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = seed + XXH_PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME64_1;
+        const uint8_t *const limit = end - 32;
+        do {
+            v1 = xxh64_round(v1, read64(ptr));
+            v2 = xxh64_round(v2, read64(ptr + 8));
+            v3 = xxh64_round(v3, read64(ptr + 16));
+            v4 = xxh64_round(v4, read64(ptr + 24));
+            ptr += 32;
+        } while (ptr <= limit);
+
+        result = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        result = xxh64_merge_round(result, v1);
+        result = xxh64_merge_round(result, v2);
+        result = xxh64_merge_round(result, v3);
+        result = xxh64_merge_round(result, v4);
+    } else {
+        result = seed + XXH_PRIME64_5;
+    }
+
+    result += static_cast<uint64_t>(size);
+
+    while ((ptr + 8) <= end) {
+        result ^= xxh64_round(0, read64(ptr));
+        result = rotl64(result, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        ptr += 8;
+    }
+    if ((ptr + 4) <= end) {
+        result ^= static_cast<uint64_t>(read32(ptr)) * XXH_PRIME64_1;
+        result = rotl64(result, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        ptr += 4;
+    }
+    while (ptr < end) {
+        result ^= (*ptr) * XXH_PRIME64_5;
+        result = rotl64(result, 11) * XXH_PRIME64_1;
+        ptr++;
+    }
+
+    // Avalanche
+    result ^= result >> 33;
+    result *= XXH_PRIME64_2;
+    result ^= result >> 29;
+    result *= XXH_PRIME64_3;
+    result ^= result >> 32;
+    return result;
+}
+
+Expected<std::shared_ptr<InferResultCache>> InferResultCache::create(const InferResultCacheParams &params,
+    const std::vector<size_t> &outputs_frame_sizes)
+{
+    CHECK_AS_EXPECTED(params.previous_frame_only || (0 != params.capacity), HAILO_INVALID_ARGUMENT,
+        "Result cache capacity must be positive");
+    CHECK_AS_EXPECTED(params.ttl.count() >= 0, HAILO_INVALID_ARGUMENT, "Result cache ttl must not be negative");
+
+    auto cache = make_shared_nothrow<InferResultCache>(params, outputs_frame_sizes);
+    CHECK_NOT_NULL_AS_EXPECTED(cache, HAILO_OUT_OF_HOST_MEMORY);
+    return cache;
+}
+
+InferResultCache::InferResultCache(const InferResultCacheParams &params, const std::vector<size_t> &outputs_frame_sizes) :
+    m_params(params),
+    m_capacity(params.previous_frame_only ? 1 : params.capacity),
+    m_outputs_frame_sizes(outputs_frame_sizes),
+    m_stats(),
+    m_previous_key(0),
+    m_has_previous_key(false),
+    m_callbacks_thread(1)
+{}
+
+bool InferResultCache::is_expired(const Entry &entry, std::chrono::steady_clock::time_point now) const
+{
+    return (0 != m_params.ttl.count()) && ((now - entry.insertion_time) > m_params.ttl);
+}
+
+bool InferResultCache::fetch(uint64_t key, const std::vector<MemoryView> &outputs)
+{
+    assert(outputs.size() == m_outputs_frame_sizes.size());
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_params.previous_frame_only) {
+        // The cached entry may belong to an older frame, if the previous request is still running
+        const bool is_repeated_frame = m_has_previous_key && (m_previous_key == key);
+        m_previous_key = key;
+        m_has_previous_key = true;
+        if (!is_repeated_frame) {
+            m_stats.misses++;
+            return false;
+        }
+    }
+
+    auto it = m_entries_by_key.find(key);
+    if (m_entries_by_key.end() == it) {
+        m_stats.misses++;
+        return false;
+    }
+
+    if (is_expired(*it->second, std::chrono::steady_clock::now())) {
+        m_entries.erase(it->second);
+        m_entries_by_key.erase(it);
+        m_stats.evictions++;
+        m_stats.misses++;
+        return false;
+    }
+
+    // Move to front (most recently used)
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    const auto &cached_outputs = it->second->outputs;
+    for (size_t i = 0; i < outputs.size(); i++) {
+        auto output = outputs[i];
+        assert(output.size() == cached_outputs[i].size());
+        std::memcpy(output.data(), cached_outputs[i].data(), cached_outputs[i].size());
+    }
+    m_stats.hits++;
+    return true;
+}
+
+Expected<std::vector<Buffer>> InferResultCache::take_free_outputs()
+{
+    if (m_entries.size() >= m_capacity) {
+        // Reuse the buffers of the least recently used entry
+        auto outputs = std::move(m_entries.back().outputs);
+        m_entries_by_key.erase(m_entries.back().key);
+        m_entries.pop_back();
+        m_stats.evictions++;
+        return outputs;
+    }
+
+    std::vector<Buffer> outputs;
+    outputs.reserve(m_outputs_frame_sizes.size());
+    for (const auto frame_size : m_outputs_frame_sizes) {
+        TRY(auto buffer, Buffer::create(frame_size, BufferStorageParams::create_dma()));
+        outputs.emplace_back(std::move(buffer));
+    }
+    return outputs;
+}
+
+hailo_status InferResultCache::store(uint64_t key, const std::vector<MemoryView> &outputs)
+{
+    assert(outputs.size() == m_outputs_frame_sizes.size());
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto it = m_entries_by_key.find(key);
+    if (m_entries_by_key.end() != it) {
+        // Same inputs were sent again before the first request had completed
+        it->second->insertion_time = std::chrono::steady_clock::now();
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return HAILO_SUCCESS;
+    }
+
+    TRY(auto cached_outputs, take_free_outputs());
+    for (size_t i = 0; i < outputs.size(); i++) {
+        CHECK(outputs[i].size() == cached_outputs[i].size(), HAILO_INTERNAL_FAILURE,
+            "Unexpected output size {} (expected {})", outputs[i].size(), cached_outputs[i].size());
+        std::memcpy(cached_outputs[i].data(), outputs[i].data(), outputs[i].size());
+    }
+
+    m_entries.emplace_front(Entry{key, std::chrono::steady_clock::now(), std::move(cached_outputs)});
+    m_entries_by_key[key] = m_entries.begin();
+    return HAILO_SUCCESS;
+}
+
+void InferResultCache::clear()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_entries_by_key.clear();
+    m_entries.clear();
+    m_has_previous_key = false;
+}
+
+void InferResultCache::count_bypassed()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_stats.bypassed++;
+}
+
+InferResultCacheStats InferResultCache::get_stats()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto stats = m_stats;
+    stats.entries = m_entries.size();
+    return stats;
+}
+
+void InferResultCache::dispatch_callback(std::function<void()> &&callback)
+{
+    m_callbacks_thread.add_job([callback]() -> hailo_status {
+        callback();
+        return HAILO_SUCCESS;
+    });
+}
+
+} /* namespace hailort */
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2020-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_result_cache.hpp
+ * @brief Content addressed cache of inference results, used by ConfiguredInferModel
+ **/
+
+#ifndef _HAILO_INFER_RESULT_CACHE_HPP_
+#define _HAILO_INFER_RESULT_CACHE_HPP_
+
+#include "hailo/infer_model.hpp"
+#include "hailo/buffer.hpp"
+
+#include "common/thread_pool.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace hailort
+{
+
+class InferResultCache final
+{
+public:
+    static Expected<std::shared_ptr<InferResultCache>> create(const InferResultCacheParams &params,
+        const std::vector<size_t> &outputs_frame_sizes);
+
+    // 64 bit XXH64 hash of a buffer, chained with a previous hash as the seed
+    static uint64_t hash(const MemoryView buffer, uint64_t seed);
+
+    // Copies the cached outputs of key to outputs (ordered as outputs_frame_sizes). Returns false on a miss.
+    bool fetch(uint64_t key, const std::vector<MemoryView> &outputs);
+    // Stores the outputs of a completed request
+    hailo_status store(uint64_t key, const std::vector<MemoryView> &outputs);
+    // Drops the cached results, e.g. when the post-process config they were produced with changes
+    void clear();
+    void count_bypassed();
+    InferResultCacheStats get_stats();
+
+    // Runs a completion callback of a cache hit, in request order
+    void dispatch_callback(std::function<void()> &&callback);
+
+    InferResultCache(const InferResultCacheParams &params, const std::vector<size_t> &outputs_frame_sizes);
+
+private:
+    struct Entry {
+        uint64_t key;
+        std::chrono::steady_clock::time_point insertion_time;
+        std::vector<Buffer> outputs;
+    };
+    using EntriesList = std::list<Entry>;
+
+    bool is_expired(const Entry &entry, std::chrono::steady_clock::time_point now) const;
+    // Must be called with m_mutex held
+    Expected<std::vector<Buffer>> take_free_outputs();
+
+    const InferResultCacheParams m_params;
+    const size_t m_capacity;
+    const std::vector<size_t> m_outputs_frame_sizes;
+
+    std::mutex m_mutex;
+    // Ordered from the most recently used to the least recently used
+    EntriesList m_entries;
+    std::unordered_map<uint64_t, EntriesList::iterator> m_entries_by_key;
+    InferResultCacheStats m_stats;
+    // Key of the previous fetched request, used if previous_frame_only is set
+    uint64_t m_previous_key;
+    bool m_has_previous_key;
+
+    // Single worker, so hit callbacks are called in the order the requests were launched
+    HailoThreadPool m_callbacks_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_INFER_RESULT_CACHE_HPP_ */
@@ -10,13 +10,15 @@
 #include "hailo/inference_pipeline.hpp"
 #include "hailo/hailort_defaults.hpp"
 
-#include "common/async_thread.hpp"
+#include "common/thread_pool.hpp"
 
 #include "net_flow/pipeline/vstream_internal.hpp"
 #include "network_group/network_group_internal.hpp"
 #include "core_op/resource_manager/resource_manager.hpp"
 
 #include <sstream>
+#include <mutex>
+#include <condition_variable>
 
 
 namespace hailort
@@ -28,7 +30,8 @@ InferVStreams::InferVStreams(std::vector<InputVStream> &&inputs, std::vector<Out
     m_outputs(std::move(outputs)),
     m_is_multi_context(is_multi_context),
     m_is_scheduled(is_scheduled),
-    m_batch_size(batch_size)
+    m_batch_size(batch_size),
+    m_workers(nullptr)
 {
     for (auto &input : m_inputs) {
         if (contains(m_network_name_to_input_count, input.network_name())) {
@@ -203,62 +206,94 @@ hailo_status InferVStreams::infer(const std::map<std::string, MemoryView>& input
     status = verify_frames_count(frames_count);
     CHECK_SUCCESS(status);
 
-    std::vector<AsyncThreadPtr<hailo_status>> results;
-
-    // Launch async read/writes
+    // Resolve all vstreams before submitting any job, so we never return while jobs still reference local data
+    std::vector<std::pair<std::reference_wrapper<InputVStream>, MemoryView>> inputs;
     for (auto &input_name_to_data_pair : input_data) {
-        auto input_vstream_exp = get_input_by_name(input_name_to_data_pair.first);
-        CHECK_EXPECTED_AS_STATUS(input_vstream_exp);
-        auto &input_vstream = input_vstream_exp.release().get();
-        results.emplace_back(std::make_unique<AsyncThread<hailo_status>>(
-            [&input_vstream, &input_name_to_data_pair, frames_count]() -> hailo_status {
-                const auto &input_buffer = input_name_to_data_pair.second;
-                for (uint32_t i = 0; i < frames_count; i++) {
-                    const size_t offset = i * input_vstream.get_frame_size();
-                    auto status = input_vstream.write(MemoryView::create_const(
-                        input_buffer.data() + offset,
-                        input_vstream.get_frame_size()));
-                    if (HAILO_STREAM_ABORT == status) {
-                        LOGGER__DEBUG("Input stream was aborted!");
-                        return status;
-                    }
-                    CHECK_SUCCESS(status);
+        auto input_vstream = get_input_by_name(input_name_to_data_pair.first);
+        CHECK_EXPECTED_AS_STATUS(input_vstream);
+        inputs.emplace_back(input_vstream.release(), input_name_to_data_pair.second);
+    }
+    std::vector<std::pair<std::reference_wrapper<OutputVStream>, MemoryView>> outputs;
+    for (auto &output_name_to_data_pair : output_data) {
+        auto output_vstream = get_output_by_name(output_name_to_data_pair.first);
+        CHECK_EXPECTED_AS_STATUS(output_vstream);
+        outputs.emplace_back(output_vstream.release(), output_name_to_data_pair.second);
+    }
+
+    // Created on the first infer() call, so objects that are only used for write/read don't hold idle threads.
+    // Each infer() job blocks on a single vstream for the whole call, so one worker per vstream is needed.
+    if (nullptr == m_workers) {
+        m_workers = make_shared_nothrow<HailoThreadPool>(m_inputs.size() + m_outputs.size());
+        CHECK_NOT_NULL(m_workers, HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    // Shared with the jobs, since the last job may still be notifying after infer() saw it done and returned
+    struct JobsState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t jobs_left = 0;
+        hailo_status error_status = HAILO_SUCCESS;
+    };
+    auto jobs_state = make_shared_nothrow<JobsState>();
+    CHECK_NOT_NULL(jobs_state, HAILO_OUT_OF_HOST_MEMORY);
+    jobs_state->jobs_left = inputs.size() + outputs.size();
+    auto on_job_done = [jobs_state](hailo_status job_status) {
+        {
+            std::unique_lock<std::mutex> lock(jobs_state->mutex);
+            if ((HAILO_SUCCESS != job_status) && (HAILO_STREAM_ABORT != job_status)) {
+                jobs_state->error_status = job_status;
+                LOGGER__ERROR("Failed waiting for infer jobs with status {}", job_status);
+            }
+            jobs_state->jobs_left--;
+        }
+        jobs_state->cv.notify_all();
+    };
+
+    // Launch async read/writes on the persistent workers
+    for (auto &input : inputs) {
+        m_workers->add_job([&input, frames_count, on_job_done]() -> hailo_status {
+            auto &input_vstream = input.first.get();
+            const auto &input_buffer = input.second;
+            auto status = HAILO_SUCCESS;
+            for (uint32_t i = 0; i < frames_count; i++) {
+                const size_t offset = i * input_vstream.get_frame_size();
+                status = input_vstream.write(MemoryView::create_const(
+                    input_buffer.data() + offset,
+                    input_vstream.get_frame_size()));
+                if (HAILO_STREAM_ABORT == status) {
+                    LOGGER__DEBUG("Input stream was aborted!");
+                    break;
+                }
+                if (HAILO_SUCCESS != status) {
+                    LOGGER__ERROR("Failed writing to input vstream {} with status {}", input_vstream.name(), status);
+                    break;
                 }
-                return HAILO_SUCCESS;
             }
-        ));
+            on_job_done(status);
+            return HAILO_SUCCESS;
+        });
     }
-    for (auto &output_name_to_data_pair : output_data) {
-        auto output_vstream_exp = get_output_by_name(output_name_to_data_pair.first);
-        CHECK_EXPECTED_AS_STATUS(output_vstream_exp);
-        auto &output_vstream = output_vstream_exp.release().get();
-        results.emplace_back(std::make_unique<AsyncThread<hailo_status>>(
-            [&output_vstream, &output_name_to_data_pair, frames_count]() {
-                for (size_t i = 0; i < frames_count; i++) {
-                    auto status = output_vstream.read(MemoryView(output_name_to_data_pair.second.data() + i * output_vstream.get_frame_size(), output_vstream.get_frame_size()));
-                    if (HAILO_SUCCESS != status) {
-                        return status;
-                    }
+    for (auto &output : outputs) {
+        m_workers->add_job([&output, frames_count, on_job_done]() -> hailo_status {
+            auto &output_vstream = output.first.get();
+            auto status = HAILO_SUCCESS;
+            for (size_t i = 0; i < frames_count; i++) {
+                status = output_vstream.read(MemoryView(output.second.data() + i * output_vstream.get_frame_size(),
+                    output_vstream.get_frame_size()));
+                if (HAILO_SUCCESS != status) {
+                    break;
                 }
-                return HAILO_SUCCESS;
             }
-        ));
+            on_job_done(status);
+            return HAILO_SUCCESS;
+        });
     }
 
-    // Wait for all results
-    auto error_status = HAILO_SUCCESS;
-    for (auto& result : results) {
-        status = result->get();
-        if (HAILO_STREAM_ABORT == status) {
-            continue;
-        }
-        if (HAILO_SUCCESS != status) {
-            error_status = status;
-            LOGGER__ERROR("Failed waiting for threads with status {}", error_status);
-        }
-    }
-    if (HAILO_SUCCESS != error_status) {
-        return error_status;
+    // Wait for all jobs
+    std::unique_lock<std::mutex> lock(jobs_state->mutex);
+    jobs_state->cv.wait(lock, [&jobs_state]() { return 0 == jobs_state->jobs_left; });
+    if (HAILO_SUCCESS != jobs_state->error_status) {
+        return jobs_state->error_status;
     }
 
     return HAILO_SUCCESS;
@@ -393,13 +428,34 @@ hailo_status InferVStreams::set_nms_max_accumulated_mask_size(uint32_t max_accum
 {
     auto has_mask_output = false;
     for (auto &ouput_vstream : m_outputs) {
-        if (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == ouput_vstream.get_info().format.order) {
+        if (HailoRTCommon::is_nms_with_mask(ouput_vstream.get_info().format.order)) {
             has_mask_output = true;
             CHECK_SUCCESS(ouput_vstream.set_nms_max_accumulated_mask_size(max_accumulated_mask_size));
         }
     }
     CHECK(has_mask_output, HAILO_INVALID_OPERATION,
-        "'set_nms_max_accumulated_mask_size()' is called, but there is no NMS WITH BYTE MASK output in this model.");
+        "'set_nms_max_accumulated_mask_size()' is called, but there is no NMS WITH MASK output in this model.");
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status InferVStreams::update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates)
+{
+    std::vector<std::pair<std::reference_wrapper<OutputVStream>, NmsConfigUpdate>> vstreams_updates;
+    vstreams_updates.reserve(updates.size());
+    for (const auto &name_to_update : updates) {
+        TRY(auto output_vstream, get_output_by_name(name_to_update.first));
+        CHECK(HailoRTCommon::is_nms(output_vstream.get().get_info()), HAILO_INVALID_OPERATION,
+            "'update_nms_config()' is called, but {} is not an NMS output", name_to_update.first);
+        const auto &update = name_to_update.second;
+        CHECK((update.score_threshold <= 1.0f) && (update.iou_threshold <= 1.0f), HAILO_INVALID_ARGUMENT,
+            "Invalid NMS config update for {} - thresholds must be at most 1", name_to_update.first);
+        vstreams_updates.emplace_back(output_vstream, update);
+    }
+
+    for (auto &vstream_update : vstreams_updates) {
+        CHECK_SUCCESS(vstream_update.first.get().update_nms_config(vstream_update.second));
+    }
 
     return HAILO_SUCCESS;
 }
@@ -242,6 +242,83 @@ std::string NmsPostProcessMuxElement::description() const
     return element_description.str();
 }
 
+Expected<std::shared_ptr<PostProcessPluginElement>> PostProcessPluginElement::create(const PostProcessPluginParams &plugin_params,
+    const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction,
+    std::shared_ptr<AsyncPipeline> async_pipeline)
+{
+    std::vector<std::string> sinks_inputs_names;
+    sinks_inputs_names.reserve(plugin_params.inputs_streams_names.size());
+    for (const auto &input_stream_name : plugin_params.inputs_streams_names) {
+        sinks_inputs_names.push_back(input_stream_name.first);
+    }
+
+    TRY(auto duration_collector, DurationCollector::create(build_params.elem_stats_flags));
+    auto pipeline_status = build_params.pipeline_status;
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    auto plugin_elem_ptr = make_shared_nothrow<PostProcessPluginElement>(plugin_params.plugin, std::move(sinks_inputs_names),
+        name, build_params.timeout, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, async_pipeline,
+        status);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+    CHECK_AS_EXPECTED(nullptr != plugin_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    LOGGER__INFO("Created {}", plugin_elem_ptr->description());
+    return plugin_elem_ptr;
+}
+
+PostProcessPluginElement::PostProcessPluginElement(PostProcessPluginPtr plugin, std::vector<std::string> &&sinks_inputs_names,
+    const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector,
+    std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, PipelineDirection pipeline_direction,
+    std::shared_ptr<AsyncPipeline> async_pipeline, hailo_status &status) :
+    BaseMuxElement(sinks_inputs_names.size(), name, timeout, std::move(duration_collector), std::move(pipeline_status),
+        pipeline_direction, async_pipeline, status),
+    m_plugin(plugin),
+    m_sinks_inputs_names(std::move(sinks_inputs_names))
+{}
+
+Expected<PipelineBuffer> PostProcessPluginElement::action(std::vector<PipelineBuffer> &&input_buffers, PipelineBuffer &&optional)
+{
+    std::map<std::string, MemoryView> inputs;
+    for (size_t i = 0; i < input_buffers.size(); ++i) {
+        TRY(auto src, input_buffers[i].as_view(BufferProtection::READ));
+        inputs.insert({m_sinks_inputs_names[i], src});
+    }
+    auto pool = next_pad_downstream().element().get_buffer_pool();
+    assert(pool);
+
+    auto acquired_buffer = pool->get_available_buffer(std::move(optional), m_timeout);
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == acquired_buffer.status()) {
+        return make_unexpected(acquired_buffer.status());
+    }
+
+    if (!acquired_buffer) {
+        for (auto &input : input_buffers) {
+            input.set_action_status(acquired_buffer.status());
+        }
+    }
+    CHECK_EXPECTED(acquired_buffer);
+    TRY(auto dst, acquired_buffer->as_view(BufferProtection::WRITE));
+    m_duration_collector.start_measurement();
+
+    auto execute_status = m_plugin->execute(inputs, dst);
+    m_duration_collector.complete_measurement();
+
+    for (auto &input : input_buffers) {
+        input.set_action_status(execute_status);
+    }
+    acquired_buffer->set_action_status(execute_status);
+
+    CHECK_SUCCESS_AS_EXPECTED(execute_status, "Post-process plugin {} failed", m_plugin->name());
+    return acquired_buffer;
+}
+
+std::string PostProcessPluginElement::description() const
+{
+    std::stringstream element_description;
+    element_description << "(" << this->name() << " | Plugin: " << m_plugin->name() << ")";
+    return element_description.str();
+}
+
 static hailo_nms_info_t fuse_nms_info(const std::vector<hailo_nms_info_t> &nms_infos)
 {
     hailo_nms_info_t fused_info = nms_infos[0];
@@ -389,11 +466,11 @@ hailo_status BaseDemuxElement::run_push(PipelineBuffer &&buffer, const PipelineP
         auto status = pad->run_push(std::move(outputs.value()[source_index]));
 
         if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-            LOGGER__INFO("run_push of {} was shutdown!", name());
+            LOGGER__INFO_RATE_LIMITED("run_push of {} was shutdown!", name());
             return status;
         }
         if (HAILO_STREAM_ABORT == status) {
-            LOGGER__INFO("run_push of {} was aborted!", name());
+            LOGGER__INFO_RATE_LIMITED("run_push of {} was aborted!", name());
             return status;
         }
         CHECK_SUCCESS(status);
@@ -457,14 +534,14 @@ Expected<PipelineBuffer> BaseDemuxElement::run_pull(PipelineBuffer &&optional, c
         // If all srcs arrived, execute the demux
         auto input = execution_pads()[0]->run_pull();
         if (HAILO_STREAM_ABORT == input.status()) {
-            LOGGER__INFO("run_pull of demux element was aborted!");
+            LOGGER__INFO_RATE_LIMITED("run_pull of demux element was aborted!");
             m_was_stream_aborted = true;
             lock.unlock();
             m_cv.notify_all();
             return make_unexpected(input.status());
         }
         if (HAILO_SHUTDOWN_EVENT_SIGNALED == input.status()) {
-            LOGGER__INFO("run_pull of demux element was aborted in {} because pipeline deactivated!", name());
+            LOGGER__INFO_RATE_LIMITED("run_pull of demux element was aborted in {} because pipeline deactivated!", name());
             m_is_activated = false;
             lock.unlock();
             m_cv.notify_all();
@@ -474,7 +551,7 @@ Expected<PipelineBuffer> BaseDemuxElement::run_pull(PipelineBuffer &&optional, c
 
         auto outputs = action(input.release());
         if (HAILO_SHUTDOWN_EVENT_SIGNALED == outputs.status()) {
-            LOGGER__INFO("run_pull of demux element was aborted in {} because pipeline deactivated!", name());
+            LOGGER__INFO_RATE_LIMITED("run_pull of demux element was aborted in {} because pipeline deactivated!", name());
             m_is_activated = false;
             lock.unlock();
             m_cv.notify_all();
@@ -10,6 +10,7 @@
 #ifndef _HAILO_MULTI_IO_ELEMENTS_HPP_
 #define _HAILO_MULTI_IO_ELEMENTS_HPP_
 
+#include "hailo/post_process_plugin.hpp"
 #include "net_flow/ops_metadata/yolov5_seg_op_metadata.hpp"
 
 namespace hailort
@@ -77,31 +78,33 @@ public:
 
     std::shared_ptr<net_flow::Op> get_op() { return m_nms_op; }
 
-    virtual hailo_status set_nms_score_threshold(float32_t threshold)
+    virtual hailo_status update_nms_config(const NmsConfigUpdate &update) override
     {
         auto nms_metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(get_op()->metadata());
         assert(nullptr != nms_metadata);
-        nms_metadata->nms_config().nms_score_th = threshold;
-
-        return HAILO_SUCCESS;
+        // Publishes a new config snapshot - the op picks it up on its next frame
+        return nms_metadata->update_nms_config(update);
     }
 
-    virtual hailo_status set_nms_iou_threshold(float32_t threshold)
+    virtual hailo_status set_nms_score_threshold(float32_t threshold) override
     {
-        auto nms_metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(get_op()->metadata());
-        assert(nullptr != nms_metadata);
-        nms_metadata->nms_config().nms_iou_th = threshold;
+        NmsConfigUpdate update;
+        update.score_threshold = threshold;
+        return update_nms_config(update);
+    }
 
-        return HAILO_SUCCESS;
+    virtual hailo_status set_nms_iou_threshold(float32_t threshold) override
+    {
+        NmsConfigUpdate update;
+        update.iou_threshold = threshold;
+        return update_nms_config(update);
     }
 
-    virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class)
+    virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) override
     {
         auto nms_metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(get_op()->metadata());
         assert(nullptr != nms_metadata);
-        nms_metadata->nms_config().max_proposals_per_class = max_proposals_per_class;
-
-        return HAILO_SUCCESS;
+        return nms_metadata->set_max_proposals_per_class(max_proposals_per_class);
     }
 
     virtual hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size)
@@ -121,6 +124,37 @@ private:
     std::vector<std::string> m_sinks_names; // TODO: remove this (HRT-8875)
 };
 
+struct PostProcessPluginParams {
+    PostProcessPluginPtr plugin;
+    // Plugin input name -> name of the device output stream feeding it
+    std::map<std::string, std::string> inputs_streams_names;
+    // The plugin's output, as exposed to the user (UINT8, frame sized)
+    hailo_vstream_info_t output_vstream_info;
+    size_t output_frame_size;
+};
+
+// Runs a user PostProcessPlugin on the raw device buffers of its inputs, writing into the plugin's output buffer
+class PostProcessPluginElement : public BaseMuxElement
+{
+public:
+    static Expected<std::shared_ptr<PostProcessPluginElement>> create(const PostProcessPluginParams &plugin_params,
+        const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction = PipelineDirection::PUSH,
+        std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+    PostProcessPluginElement(PostProcessPluginPtr plugin, std::vector<std::string> &&sinks_inputs_names, const std::string &name,
+        std::chrono::milliseconds timeout, DurationCollector &&duration_collector,
+        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, PipelineDirection pipeline_direction,
+        std::shared_ptr<AsyncPipeline> async_pipeline, hailo_status &status);
+    virtual std::string description() const override;
+
+protected:
+    virtual Expected<PipelineBuffer> action(std::vector<PipelineBuffer> &&inputs, PipelineBuffer &&optional) override;
+
+private:
+    PostProcessPluginPtr m_plugin;
+    // The plugin input name of each sink, by the sink index
+    std::vector<std::string> m_sinks_inputs_names;
+};
+
 class NmsMuxElement : public BaseMuxElement
 {
 public:
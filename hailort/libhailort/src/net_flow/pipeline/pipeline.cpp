@@ -294,10 +294,10 @@ hailo_status PipelineBuffer::set_dma_buf_as_memview(BufferProtection dma_buffer_
 {
     auto dma_buffer = get_metadata().get_additional_data<DmaBufferPipelineData>();
 
-    TRY(m_view, DmaBufferUtils::mmap_dma_buffer(dma_buffer->m_dma_buffer, dma_buffer_protection));
+    TRY(m_view, DmaBufferUtils::mmap_dma_buffer_cached(dma_buffer->m_dma_buffer, dma_buffer_protection));
 
     m_exec_done = [mem_view=m_view, exec_done=m_exec_done, dma_buffer, dma_buffer_protection](hailo_status status) {
-        auto mumap_status = DmaBufferUtils::munmap_dma_buffer(dma_buffer->m_dma_buffer, mem_view, dma_buffer_protection);
+        auto mumap_status = DmaBufferUtils::munmap_dma_buffer_cached(dma_buffer->m_dma_buffer, mem_view, dma_buffer_protection);
         if (HAILO_SUCCESS != mumap_status) {
             LOGGER__ERROR("Failed to unmap dma buffer");
             status = HAILO_FILE_OPERATION_FAILURE;
@@ -386,6 +386,10 @@ public:
         return 0;
     }
 
+    virtual hailo_status update_nms_config(const NmsConfigUpdate &/*update*/) {
+        return HAILO_INVALID_OPERATION;
+    }
+
     virtual hailo_status set_nms_score_threshold(float32_t /*threshold*/) {
         return HAILO_INVALID_OPERATION;
     }
@@ -40,7 +40,7 @@ BaseQueueElement::BaseQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPool
 
 BaseQueueElement::~BaseQueueElement()
 {
-    LOGGER__INFO("Queue element {} has {} frames in his Queue on destruction", name(), m_queue.size_approx());
+    LOGGER__INFO_RATE_LIMITED("Queue element {} has {} frames in his Queue on destruction", name(), m_queue.size_approx());
 }
 
 void BaseQueueElement::start_thread()
@@ -293,7 +293,7 @@ hailo_status PushQueueElement::run_push(PipelineBuffer &&buffer, const PipelineP
 {
     auto status = m_pipeline_status->load();
     if (HAILO_STREAM_ABORT == status) {
-        LOGGER__INFO("run_push of {} was aborted!", name());
+        LOGGER__INFO_RATE_LIMITED("run_push of {} was aborted!", name());
         return status;
     }
     CHECK_SUCCESS(m_pipeline_status->load());
@@ -308,7 +308,7 @@ hailo_status PushQueueElement::run_push(PipelineBuffer &&buffer, const PipelineP
         CHECK_SUCCESS(queue_thread_status,
             "Shutdown event was signaled in enqueue of queue element {} because thread has failed with status={}!", name(),
             queue_thread_status);
-        LOGGER__INFO("Shutdown event was signaled in enqueue of queue element {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in enqueue of queue element {}!", name());
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     CHECK_SUCCESS(status);
@@ -334,7 +334,7 @@ hailo_status PushQueueElement::execute_deactivate()
         auto deactivation_status = PipelineElementInternal::execute_deactivate();
         CHECK_SUCCESS(deactivation_status);
         if ((HAILO_STREAM_ABORT == status) || (HAILO_SHUTDOWN_EVENT_SIGNALED == status)) {
-            LOGGER__INFO("enqueue() in element {} was aborted, got status = {}", name(), status);
+            LOGGER__INFO_RATE_LIMITED("enqueue() in element {} was aborted, got status = {}", name(), status);
         }
         else {
              LOGGER__ERROR("enqueue() in element {} failed, got status = {}", name(), status);
@@ -355,7 +355,7 @@ hailo_status PushQueueElement::run_in_thread()
 {
     auto buffer = m_queue.dequeue(INIFINITE_TIMEOUT());
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer.status()) {
-        LOGGER__INFO("Shutdown event was signaled in dequeue of queue element {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in dequeue of queue element {}!", name());
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     CHECK_EXPECTED_AS_STATUS(buffer);
@@ -375,11 +375,11 @@ hailo_status PushQueueElement::run_in_thread()
 
     hailo_status status = next_pad().run_push(buffer.release());
     if (HAILO_STREAM_ABORT == status) {
-        LOGGER__INFO("run_push of {} was aborted!", name());
+        LOGGER__INFO_RATE_LIMITED("run_push of {} was aborted!", name());
         return status;
     }
     else if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("run_push of {} stopped because Shutdown event was signaled!", name());
+        LOGGER__INFO_RATE_LIMITED("run_push of {} stopped because Shutdown event was signaled!", name());
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     CHECK_SUCCESS(status);
@@ -540,7 +540,7 @@ hailo_status AsyncPushQueueElement::execute_deactivate()
         auto deactivation_status = PipelineElementInternal::execute_deactivate();
         CHECK_SUCCESS(deactivation_status);
         if ((HAILO_STREAM_ABORT == status) || (HAILO_SHUTDOWN_EVENT_SIGNALED == status)) {
-            LOGGER__INFO("enqueue() in element {} was aborted, got status = {}", name(), status);
+            LOGGER__INFO_RATE_LIMITED("enqueue() in element {} was aborted, got status = {}", name(), status);
         } else {
              LOGGER__ERROR("enqueue() in element {} failed, got status = {}", name(), status);
              return status;
@@ -676,7 +676,7 @@ Expected<PipelineBuffer> PullQueueElement::run_pull(PipelineBuffer &&optional, c
         CHECK_SUCCESS_AS_EXPECTED(queue_thread_status,
             "Shutdown event was signaled in dequeue of queue element {} because thread has failed with status={}!", name(),
             queue_thread_status);
-        LOGGER__INFO("Shutdown event was signaled in dequeue of queue element {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in dequeue of queue element {}!", name());
         return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
     }
     CHECK_EXPECTED(output);
@@ -704,11 +704,11 @@ hailo_status PullQueueElement::run_in_thread()
 {
     auto buffer = next_pad().run_pull();
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer.status()) {
-        LOGGER__INFO("Shutdown event was signaled in run_pull of queue element {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in run_pull of queue element {}!", name());
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     if (HAILO_STREAM_ABORT == buffer.status()) {
-        LOGGER__INFO("run_pull of queue element {} was aborted!", name());
+        LOGGER__INFO_RATE_LIMITED("run_pull of queue element {} was aborted!", name());
         return HAILO_STREAM_ABORT;
     }
     if (HAILO_NETWORK_GROUP_NOT_ACTIVATED == buffer.status()) {
@@ -723,7 +723,7 @@ hailo_status PullQueueElement::run_in_thread()
 
     hailo_status status = m_queue.enqueue(buffer.release(), INIFINITE_TIMEOUT());
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("Shutdown event was signaled in enqueue of queue element {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in enqueue of queue element {}!", name());
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     CHECK_SUCCESS(status);
@@ -797,14 +797,14 @@ Expected<PipelineBuffer> UserBufferQueueElement::run_pull(PipelineBuffer &&optio
 
     hailo_status status = m_pool->enqueue_buffer(std::move(optional));
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("Shutdown event was signaled in enqueue of queue element {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in enqueue of queue element {}!", name());
         return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
     }
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     auto output = m_queue.dequeue(m_timeout);
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == output.status()) {
-        LOGGER__INFO("Shutdown event was signaled in dequeue of queue element {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in dequeue of queue element {}!", name());
         return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
     }
 
@@ -825,19 +825,19 @@ hailo_status UserBufferQueueElement::run_in_thread()
 {
     auto optional = m_pool->acquire_buffer(INIFINITE_TIMEOUT());
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == optional.status()) {
-        LOGGER__INFO("Shutdown event was signaled in dequeue of {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in dequeue of {}!", name());
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     CHECK_EXPECTED_AS_STATUS(optional);
 
     auto buffer = next_pad().run_pull(optional.release());
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer.status()) {
-        LOGGER__INFO("Shutdown event was signaled in run_pull of {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in run_pull of {}!", name());
 
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     if (HAILO_STREAM_ABORT == buffer.status()) {
-        LOGGER__INFO("run_pull of {} was aborted!", name());
+        LOGGER__INFO_RATE_LIMITED("run_pull of {} was aborted!", name());
 
         return HAILO_STREAM_ABORT;
     }
@@ -845,7 +845,7 @@ hailo_status UserBufferQueueElement::run_in_thread()
 
     hailo_status status = m_queue.enqueue(buffer.release(), INIFINITE_TIMEOUT());
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("Shutdown event was signaled in enqueue of {}!", name());
+        LOGGER__INFO_RATE_LIMITED("Shutdown event was signaled in enqueue of {}!", name());
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     CHECK_SUCCESS(status);
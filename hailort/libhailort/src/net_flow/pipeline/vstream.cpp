@@ -646,6 +646,11 @@ hailo_status OutputVStream::set_nms_max_accumulated_mask_size(uint32_t max_accum
     return m_vstream->set_nms_max_accumulated_mask_size(max_accumulated_mask_size);
 }
 
+hailo_status OutputVStream::update_nms_config(const NmsConfigUpdate &update)
+{
+    return m_vstream->update_nms_config(update);
+}
+
 OutputVStream::OutputVStream(std::shared_ptr<OutputVStreamInternal> vstream) : m_vstream(std::move(vstream)) {}
 
 std::map<std::string, AccumulatorPtr> get_pipeline_accumulators_by_type(
@@ -771,11 +776,11 @@ hailo_status InputVStreamImpl::write(const MemoryView &buffer)
     assert(1 == m_entry_element->sinks().size());
     auto status = m_entry_element->sinks()[0].run_push(PipelineBuffer(buffer, [](hailo_status){}, HAILO_SUCCESS, false, BufferPoolWeakPtr(), m_measure_pipeline_latency));
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("Sending to VStream was shutdown!");
+        LOGGER__INFO_RATE_LIMITED("Sending to VStream was shutdown!");
         status = m_pipeline_status->load();
     }
     if (HAILO_STREAM_ABORT == status) {
-        LOGGER__INFO("Sending to VStream was aborted!");
+        LOGGER__INFO_RATE_LIMITED("Sending to VStream was aborted!");
         return HAILO_STREAM_ABORT;
     }
     return status;
@@ -795,11 +800,11 @@ hailo_status InputVStreamImpl::write(const hailo_pix_buffer_t &buffer)
     assert(1 == m_entry_element->sinks().size());
     auto status = m_entry_element->sinks()[0].run_push(PipelineBuffer(buffer));
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("Sending to VStream was shutdown!");
+        LOGGER__INFO_RATE_LIMITED("Sending to VStream was shutdown!");
         status = m_pipeline_status->load();
     }
     if (HAILO_STREAM_ABORT == status) {
-        LOGGER__INFO("Sending to VStream was aborted!");
+        LOGGER__INFO_RATE_LIMITED("Sending to VStream was aborted!");
         return HAILO_STREAM_ABORT;
     }
     return status;
@@ -810,7 +815,7 @@ hailo_status InputVStreamImpl::flush()
     assert(1 == m_entry_element->sinks().size());
     auto status =  m_entry_element->sinks()[0].run_push(PipelineBuffer(PipelineBuffer::Type::FLUSH));
     if (HAILO_STREAM_ABORT == status) {
-        LOGGER__INFO("Sending to VStream was aborted!");
+        LOGGER__INFO_RATE_LIMITED("Sending to VStream was aborted!");
         return HAILO_STREAM_ABORT;
     }
     CHECK_SUCCESS(status);
@@ -1135,7 +1140,7 @@ hailo_status OutputVStreamImpl::read(MemoryView buffer)
     auto recv_buffer = m_entry_element->sources()[0].run_pull(PipelineBuffer(buffer, [](hailo_status){},  HAILO_SUCCESS, false, BufferPoolWeakPtr(), m_measure_pipeline_latency));
     auto status = recv_buffer.status();
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("Receiving to VStream was shutdown!");
+        LOGGER__INFO_RATE_LIMITED("Receiving to VStream was shutdown!");
         status = m_pipeline_status->load();
     }
 
@@ -1156,6 +1161,23 @@ hailo_status OutputVStreamImpl::set_nms_score_threshold(float32_t threshold)
     return HAILO_SUCCESS;
 }
 
+hailo_status OutputVStreamImpl::update_nms_config(const NmsConfigUpdate &update)
+{
+    auto status = HAILO_INVALID_OPERATION; // Assuming there is no valid element
+    for (auto &elem : m_pipeline) {
+        auto elem_status = elem->update_nms_config(update);
+        if (HAILO_SUCCESS == elem_status) {
+            status = elem_status; // 1 element is enough to call this setter successful
+        } else if (HAILO_INVALID_OPERATION != elem_status) {
+            // The element supports NMS config updates, but rejected this one
+            CHECK_SUCCESS(elem_status, "Unable to update NMS config in {}", name());
+        }
+    }
+    CHECK_SUCCESS(status, "Unable to update NMS config in {}", name());
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status OutputVStreamImpl::set_nms_iou_threshold(float32_t threshold)
 {
     auto status = HAILO_INVALID_OPERATION; // Assuming there is no valid element
@@ -1402,6 +1424,18 @@ hailo_status OutputVStreamClient::set_nms_score_threshold(float32_t threshold)
     return HAILO_SUCCESS;
 }
 
+hailo_status OutputVStreamClient::update_nms_config(const NmsConfigUpdate &update)
+{
+    auto expected_client = HailoRtRpcClientUtils::create_client();
+    CHECK_EXPECTED_AS_STATUS(expected_client);
+    auto vstream_client = expected_client.release();
+
+    // A single RPC for all the updated thresholds
+    CHECK_SUCCESS(vstream_client->OutputVStream_update_nms_config(m_identifier, update));
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status OutputVStreamClient::set_nms_iou_threshold(float32_t threshold)
 {
     auto expected_client = HailoRtRpcClientUtils::create_client();
@@ -723,7 +723,7 @@ Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> VStreamsBuilderUtils::
     auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
     assert(nullptr != metadata);
 
-    auto remove_overlapping_bboxes_element = RemoveOverlappingBboxesElement::create(metadata->nms_config(),
+    auto remove_overlapping_bboxes_element = RemoveOverlappingBboxesElement::create(metadata,
         PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
         build_params);
     CHECK_EXPECTED(remove_overlapping_bboxes_element);
@@ -738,7 +738,7 @@ Expected<std::shared_ptr<FillNmsFormatElement>> VStreamsBuilderUtils::add_fill_n
     auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
     assert(nullptr != metadata);
 
-    auto fill_nms_format_element = FillNmsFormatElement::create(metadata->nms_config(),
+    auto fill_nms_format_element = FillNmsFormatElement::create(metadata,
         PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
         build_params);
     CHECK_EXPECTED(fill_nms_format_element);
@@ -1171,7 +1171,7 @@ hailo_status VStreamsBuilderUtils::add_nms_post_process(OutputStreamPtrVector &o
 
     if (!op_metadata->nms_config().bbox_only) {
         CHECK(HailoRTCommon::is_nms(vstreams_params.user_buffer_format.order), HAILO_INVALID_ARGUMENT,
-            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK");
+            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS, HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_RLE_MASK");
     }
 
     std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
@@ -156,6 +156,7 @@ public:
     virtual hailo_status set_nms_iou_threshold(float32_t threshold) = 0;
     virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) = 0;
     virtual hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size) = 0;
+    virtual hailo_status update_nms_config(const NmsConfigUpdate &update) = 0;
 
 protected:
     OutputVStreamInternal(const hailo_vstream_info_t &vstream_info, const std::vector<hailo_quant_info_t> &quant_infos, const hailo_vstream_params_t &vstream_params,
@@ -213,6 +214,7 @@ public:
     virtual hailo_status set_nms_iou_threshold(float32_t threshold) override;
     virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) override;
     virtual hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size) override;
+    virtual hailo_status update_nms_config(const NmsConfigUpdate &update) override;
 
 private:
     OutputVStreamImpl(const hailo_vstream_info_t &vstream_info, const std::vector<hailo_quant_info_t> &quant_infos, const hailo_vstream_params_t &vstream_params,
@@ -303,6 +305,7 @@ public:
     virtual hailo_status set_nms_iou_threshold(float32_t threshold) override;
     virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) override;
     virtual hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size) override;
+    virtual hailo_status update_nms_config(const NmsConfigUpdate &update) override;
 
 private:
     OutputVStreamClient(std::unique_ptr<HailoRtRpcClient> client, const VStreamIdentifier &&identifier, hailo_format_t &&user_buffer_format,
@@ -347,25 +347,41 @@ Expected<std::shared_ptr<net_flow::NmsOpMetadata>> ConfiguredNetworkGroupBase::g
 
 hailo_status ConfiguredNetworkGroupBase::set_nms_score_threshold(const std::string &edge_name, float32_t nms_score_threshold)
 {
-    auto expected_nms_op_metadata = get_nms_meta_data(edge_name);
-    CHECK_EXPECTED_AS_STATUS(expected_nms_op_metadata);
-    expected_nms_op_metadata.value()->nms_config().nms_score_th = nms_score_threshold;
-    return HAILO_SUCCESS;
+    NmsConfigUpdate update;
+    update.score_threshold = nms_score_threshold;
+    return update_nms_config({{edge_name, update}});
 }
 
 hailo_status ConfiguredNetworkGroupBase::set_nms_iou_threshold(const std::string &edge_name, float32_t iou_threshold)
 {
-    auto expected_nms_op_metadata = get_nms_meta_data(edge_name);
-    CHECK_EXPECTED_AS_STATUS(expected_nms_op_metadata);
-    expected_nms_op_metadata.value()->nms_config().nms_iou_th = iou_threshold;
-    return HAILO_SUCCESS;
+    NmsConfigUpdate update;
+    update.iou_threshold = iou_threshold;
+    return update_nms_config({{edge_name, update}});
 }
 
 hailo_status ConfiguredNetworkGroupBase::set_nms_max_bboxes_per_class(const std::string &edge_name, uint32_t max_bboxes_per_class)
 {
-    auto expected_nms_op_metadata = get_nms_meta_data(edge_name);
-    CHECK_EXPECTED_AS_STATUS(expected_nms_op_metadata);
-    expected_nms_op_metadata.value()->nms_config().max_proposals_per_class = max_bboxes_per_class;
+    TRY(auto nms_op_metadata, get_nms_meta_data(edge_name));
+    return nms_op_metadata->set_max_proposals_per_class(max_bboxes_per_class);
+}
+
+hailo_status ConfiguredNetworkGroupBase::update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates)
+{
+    std::vector<std::pair<std::shared_ptr<net_flow::NmsOpMetadata>, NmsConfigUpdate>> metadata_updates;
+    metadata_updates.reserve(updates.size());
+    for (const auto &edge_name_to_update : updates) {
+        TRY(auto nms_op_metadata, get_nms_meta_data(edge_name_to_update.first));
+        const auto &update = edge_name_to_update.second;
+        CHECK((update.score_threshold <= 1.0f) && (update.iou_threshold <= 1.0f), HAILO_INVALID_ARGUMENT,
+            "Invalid NMS config update for {} - thresholds must be at most 1", edge_name_to_update.first);
+        metadata_updates.emplace_back(nms_op_metadata, update);
+    }
+
+    // Each update publishes a new config snapshot, which the ops pick up on their next frame
+    for (auto &metadata_update : metadata_updates) {
+        CHECK_SUCCESS(metadata_update.first->update_nms_config(metadata_update.second));
+    }
+
     return HAILO_SUCCESS;
 }
 
@@ -812,16 +828,18 @@ Expected<size_t> ConfiguredNetworkGroupBase::get_min_buffer_pool_size()
 hailo_status ConfiguredNetworkGroupBase::infer_async(const NamedBuffersCallbacks &named_buffers_callbacks,
     const std::function<void(hailo_status)> &infer_request_done_cb)
 {
-    InferRequest infer_request{};
+    auto core_op = get_core_op();
+    InferRequest infer_request{StreamsTransfers(core_op->streams_count()), nullptr};
     for (auto &named_buffer_callback : named_buffers_callbacks) {
         const auto &name = named_buffer_callback.first;
         const auto &callback = named_buffer_callback.second.second;
+        TRY(const auto stream_index, core_op->get_stream_index(name));
         if (BufferType::VIEW == named_buffer_callback.second.first.buffer_type) {
             const auto &buffer = named_buffer_callback.second.first.view;
-            infer_request.transfers.emplace(name, TransferRequest{buffer, callback});
+            infer_request.transfers.emplace(stream_index, TransferRequest{buffer, callback});
         } else if (BufferType::DMA_BUFFER == named_buffer_callback.second.first.buffer_type) {
             const auto &dma_buffer = named_buffer_callback.second.first.dma_buffer;
-            infer_request.transfers.emplace(name, TransferRequest{dma_buffer, callback});
+            infer_request.transfers.emplace(stream_index, TransferRequest{dma_buffer, callback});
         } else {
             LOGGER__ERROR("infer_async does not support buffers with type {}", static_cast<int>(named_buffer_callback.second.first.buffer_type));
             return HAILO_INVALID_ARGUMENT;
@@ -841,7 +859,7 @@ hailo_status ConfiguredNetworkGroupBase::infer_async(const NamedBuffersCallbacks
 
     increase_ongoing_callbacks(); // Increase before lunch, as the cb may be called before we got the chance to increase the counter
     std::unique_lock<std::mutex> lock(m_mutex);
-    auto status = get_core_op()->infer_async(std::move(infer_request));
+    auto status = core_op->infer_async(std::move(infer_request));
     if (status != HAILO_SUCCESS) {
         // If we got error in `infer_async()`, then the callbacks will not be called.
         decrease_ongoing_callbacks();
@@ -10,65 +10,256 @@
 #include <sys/ioctl.h>
 #include <linux/dma-buf.h>
 
+#include <list>
+#include <mutex>
 
 #include "hailo/hailort.h"
 #include "hailo/event.hpp"
 #include "common/utils.hpp"
+#include "common/file_descriptor.hpp"
 #include "utils/dma_buffer_utils.hpp"
 
 namespace hailort
 {
 
-Expected<MemoryView> DmaBufferUtils::mmap_dma_buffer(hailo_dma_buffer_t dma_buffer, BufferProtection dma_buffer_protection)
+static Expected<int> get_mmap_prot(BufferProtection dma_buffer_protection)
 {
-    int prot = 0;
-    uint64_t dma_buf_sync_flags = 0;
     if (BufferProtection::READ == dma_buffer_protection) {
-        prot = PROT_READ;
-        dma_buf_sync_flags = DMA_BUF_SYNC_START | DMA_BUF_SYNC_READ;
+        return PROT_READ;
     } else if (BufferProtection::WRITE == dma_buffer_protection) {
-        prot = PROT_WRITE;
-        dma_buf_sync_flags = DMA_BUF_SYNC_START | DMA_BUF_SYNC_WRITE;
-    } else {
-        return make_unexpected(HAILO_INVALID_ARGUMENT);
+        return PROT_WRITE;
     }
+    return make_unexpected(HAILO_INVALID_ARGUMENT);
+}
 
-    void* dma_buf_ptr = mmap(NULL, dma_buffer.size, prot, MAP_SHARED, dma_buffer.fd, 0);
-    CHECK_AS_EXPECTED(MAP_FAILED != dma_buf_ptr, HAILO_INTERNAL_FAILURE, "Failed to run mmap on DMA buffer");
+static hailo_status sync_dma_buffer(hailo_dma_buffer_t dma_buffer, BufferProtection dma_buffer_protection, bool is_start)
+{
+    uint64_t dma_buf_sync_flags = is_start ? DMA_BUF_SYNC_START : DMA_BUF_SYNC_END;
+    if (BufferProtection::READ == dma_buffer_protection) {
+        dma_buf_sync_flags |= DMA_BUF_SYNC_READ;
+    } else if (BufferProtection::WRITE == dma_buffer_protection) {
+        dma_buf_sync_flags |= DMA_BUF_SYNC_WRITE;
+    } else {
+        return HAILO_INVALID_ARGUMENT;
+    }
 
     struct dma_buf_sync sync = {
         .flags = dma_buf_sync_flags,
     };
     auto err = ioctl(dma_buffer.fd, DMA_BUF_IOCTL_SYNC, &sync);
-    CHECK_AS_EXPECTED(0 == err, HAILO_INTERNAL_FAILURE, "Failed to run DMA_BUF_IOCTL_SYNC on FD, size: {}, fd: {}, address: {}, errno {}", dma_buffer.size,
-        dma_buffer.fd, static_cast<void*>(dma_buf_ptr), err);
+    CHECK(0 == err, HAILO_INTERNAL_FAILURE, "Failed to run DMA_BUF_IOCTL_SYNC on FD, size: {}, fd: {}, errno {}",
+        dma_buffer.size, dma_buffer.fd, errno);
 
-    return MemoryView(dma_buf_ptr, dma_buffer.size);
+    return HAILO_SUCCESS;
 }
 
-hailo_status DmaBufferUtils::munmap_dma_buffer(hailo_dma_buffer_t dma_buffer, MemoryView dma_buffer_memview, BufferProtection dma_buffer_protection)
+/**
+ * LRU cache of CPU mappings of dma-bufs. Entries are keyed by the dma-buf identity (the inode of the dma-buf file,
+ * which the kernel never reuses for another dma-buf) and not by the fd, since fds are recycled by the OS.
+ * Mappings that are currently lent out are never evicted.
+ * A mapping holds a reference to its dma-buf, so each entry also tracks the caller's fd it was last used with. Once
+ * that fd is closed (or refers to another file), the caller released the dma-buf and its idle mapping is dropped on
+ * the next miss, instead of keeping the dma-buf alive until it is evicted. A hit is keyed by the caller's fd, so it
+ * needs no check - released entries are looked for only on a miss, which pays for an mmap anyway.
+ */
+class DmaBufferMappingCache final
 {
-    uint64_t dma_buf_sync_flags = 0;
-    if (BufferProtection::READ == dma_buffer_protection) {
-        dma_buf_sync_flags = DMA_BUF_SYNC_END | DMA_BUF_SYNC_READ;
-    } else if (BufferProtection::WRITE == dma_buffer_protection) {
-        dma_buf_sync_flags = DMA_BUF_SYNC_END | DMA_BUF_SYNC_WRITE;
-    } else {
-        return make_unexpected(HAILO_INVALID_ARGUMENT);
+public:
+    static DmaBufferMappingCache &get_instance()
+    {
+        static DmaBufferMappingCache instance;
+        return instance;
     }
 
-    struct dma_buf_sync sync = {
-        .flags = dma_buf_sync_flags,
+    ~DmaBufferMappingCache()
+    {
+        for (auto &entry : m_entries) {
+            munmap(entry.address, entry.size);
+        }
+    }
+
+    Expected<void*> acquire(hailo_dma_buffer_t dma_buffer, int prot)
+    {
+        TRY(const auto key, get_key(dma_buffer.fd, dma_buffer.size, prot));
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end(); it++) {
+            if (!it->is_stale && (it->key == key)) {
+                it->users++;
+                it->fd = dma_buffer.fd;
+                // Move to front (most recently used)
+                m_entries.splice(m_entries.begin(), m_entries, it);
+                return Expected<void*>(m_entries.front().address);
+            }
+        }
+
+        drop_released_entries();
+        void *address = mmap(NULL, dma_buffer.size, prot, MAP_SHARED, dma_buffer.fd, 0);
+        CHECK_AS_EXPECTED(MAP_FAILED != address, HAILO_INTERNAL_FAILURE, "Failed to run mmap on DMA buffer, errno {}", errno);
+
+        m_entries.emplace_front(Entry{key, address, dma_buffer.size, dma_buffer.fd, 1, false});
+        evict();
+        return Expected<void*>(address);
+    }
+
+    void release(void *address)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end(); it++) {
+            if (it->address == address) {
+                assert(it->users > 0);
+                it->users--;
+                if (it->is_stale && (0 == it->users)) {
+                    munmap(it->address, it->size);
+                    m_entries.erase(it);
+                }
+                break;
+            }
+        }
+        evict();
+    }
+
+    void invalidate(int dmabuf_fd)
+    {
+        auto identity = FileDescriptor::get_identity(dmabuf_fd);
+        if (!identity) {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (it->key.identity == identity.value()) {
+                if (0 == it->users) {
+                    munmap(it->address, it->size);
+                    it = m_entries.erase(it);
+                    continue;
+                }
+                it->is_stale = true;
+            }
+            it++;
+        }
+    }
+
+private:
+    static constexpr size_t MAX_CACHED_MAPPINGS = 32;
+
+    struct Key {
+        FileIdentity identity;
+        size_t size;
+        int prot;
+
+        bool operator==(const Key &other) const
+        {
+            return (identity == other.identity) && (size == other.size) && (prot == other.prot);
+        }
     };
 
-    auto err = ioctl(dma_buffer.fd, DMA_BUF_IOCTL_SYNC, &sync);
-    CHECK(0 == err, HAILO_INTERNAL_FAILURE, "Failed to run DMA_BUF_IOCTL_SYNC ioctl, errno {}", err);
+    struct Entry {
+        Key key;
+        void *address;
+        size_t size;
+        int fd; // The caller's fd the mapping was last acquired with (not owned by the cache)
+        uint32_t users;
+        bool is_stale;
+    };
 
-    err = munmap(static_cast<void*>(dma_buffer_memview.data()), dma_buffer.size);
+    DmaBufferMappingCache() = default;
+
+    static Expected<Key> get_key(int fd, size_t size, int prot)
+    {
+        auto identity = FileDescriptor::get_identity(fd);
+        CHECK_AS_EXPECTED(identity, HAILO_INVALID_ARGUMENT, "Invalid dma-buf fd {}", fd);
+        return Key{identity.release(), size, prot};
+    }
+
+    // Must be called with m_mutex held
+    void drop_released_entries()
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if ((0 == it->users) && !FileDescriptor::refers_to(it->fd, it->key.identity)) {
+                munmap(it->address, it->size);
+                it = m_entries.erase(it);
+                continue;
+            }
+            it++;
+        }
+    }
+
+    // Must be called with m_mutex held
+    void evict()
+    {
+        auto it = m_entries.end();
+        while ((m_entries.size() > MAX_CACHED_MAPPINGS) && (it != m_entries.begin())) {
+            it--;
+            if (0 == it->users) {
+                munmap(it->address, it->size);
+                it = m_entries.erase(it);
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    // Ordered from the most recently used to the least recently used
+    std::list<Entry> m_entries;
+};
+
+Expected<MemoryView> DmaBufferUtils::mmap_dma_buffer(hailo_dma_buffer_t dma_buffer, BufferProtection dma_buffer_protection)
+{
+    TRY(const auto prot, get_mmap_prot(dma_buffer_protection));
+
+    void* dma_buf_ptr = mmap(NULL, dma_buffer.size, prot, MAP_SHARED, dma_buffer.fd, 0);
+    CHECK_AS_EXPECTED(MAP_FAILED != dma_buf_ptr, HAILO_INTERNAL_FAILURE, "Failed to run mmap on DMA buffer");
+
+    auto status = sync_dma_buffer(dma_buffer, dma_buffer_protection, true);
+    if (HAILO_SUCCESS != status) {
+        munmap(dma_buf_ptr, dma_buffer.size);
+        return make_unexpected(status);
+    }
+
+    return MemoryView(dma_buf_ptr, dma_buffer.size);
+}
+
+hailo_status DmaBufferUtils::munmap_dma_buffer(hailo_dma_buffer_t dma_buffer, MemoryView dma_buffer_memview, BufferProtection dma_buffer_protection)
+{
+    auto status = sync_dma_buffer(dma_buffer, dma_buffer_protection, false);
+    CHECK_SUCCESS(status);
+
+    auto err = munmap(static_cast<void*>(dma_buffer_memview.data()), dma_buffer.size);
     CHECK(0 == err, HAILO_INTERNAL_FAILURE, "Failed to munmap dma buffer, size: {}, fd: {}, address: {}, errno {}", dma_buffer.size, dma_buffer.fd,
         static_cast<void*>(dma_buffer_memview.data()), err);
 
     return HAILO_SUCCESS;
 }
 
+Expected<MemoryView> DmaBufferUtils::mmap_dma_buffer_cached(hailo_dma_buffer_t dma_buffer, BufferProtection dma_buffer_protection)
+{
+    TRY(const auto prot, get_mmap_prot(dma_buffer_protection));
+
+    auto &cache = DmaBufferMappingCache::get_instance();
+    TRY(auto dma_buf_ptr, cache.acquire(dma_buffer, prot));
+
+    auto status = sync_dma_buffer(dma_buffer, dma_buffer_protection, true);
+    if (HAILO_SUCCESS != status) {
+        cache.release(dma_buf_ptr);
+        return make_unexpected(status);
+    }
+
+    return MemoryView(dma_buf_ptr, dma_buffer.size);
+}
+
+hailo_status DmaBufferUtils::munmap_dma_buffer_cached(hailo_dma_buffer_t dma_buffer, MemoryView dma_buffer_memview,
+    BufferProtection dma_buffer_protection)
+{
+    auto status = sync_dma_buffer(dma_buffer, dma_buffer_protection, false);
+    DmaBufferMappingCache::get_instance().release(static_cast<void*>(dma_buffer_memview.data()));
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+void DmaBufferUtils::invalidate_cached_mappings(int dmabuf_fd)
+{
+    DmaBufferMappingCache::get_instance().invalidate(dmabuf_fd);
+}
+
 } /* namespace hailort */
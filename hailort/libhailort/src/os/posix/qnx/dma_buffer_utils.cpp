@@ -26,4 +26,19 @@ hailo_status DmaBufferUtils::munmap_dma_buffer(hailo_dma_buffer_t /*dma_buffer*/
     return HAILO_NOT_IMPLEMENTED;
 }
 
+Expected<MemoryView> DmaBufferUtils::mmap_dma_buffer_cached(hailo_dma_buffer_t /*dma_buffer*/,
+    BufferProtection /*dma_buffer_protection*/)
+{
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
+hailo_status DmaBufferUtils::munmap_dma_buffer_cached(hailo_dma_buffer_t /*dma_buffer*/, MemoryView /*dma_buffer_memview*/,
+    BufferProtection /*dma_buffer_protection*/)
+{
+    return HAILO_NOT_IMPLEMENTED;
+}
+
+void DmaBufferUtils::invalidate_cached_mappings(int /*dmabuf_fd*/)
+{}
+
 } /* namespace hailort */
@@ -12,13 +12,21 @@
 namespace hailort
 {
 
-AsyncInferJobHrpcClient::AsyncInferJobHrpcClient(EventPtr event) : m_event(event)
+AsyncInferJobHrpcClient::AsyncInferJobHrpcClient(EventPtr event) : m_event(event), m_submission_status(HAILO_SUCCESS)
 {
 }
 
 hailo_status AsyncInferJobHrpcClient::wait(std::chrono::milliseconds timeout)
 {
-    return m_event->wait(timeout);
+    auto status = m_event->wait(timeout);
+    CHECK_SUCCESS(status);
+
+    return m_submission_status.load();
+}
+
+void AsyncInferJobHrpcClient::set_submission_status(hailo_status status)
+{
+    m_submission_status = status;
 }
 
 CallbacksQueue::CallbacksQueue(const std::vector<std::string> &outputs_names) : m_outputs_names(outputs_names)
@@ -116,5 +124,18 @@ hailo_status CallbacksQueue::push_callback(hailo_status callback_status, rpc_obj
     return HAILO_SUCCESS;
 }
 
+hailo_status CallbacksQueue::push_failed_callback(hailo_status callback_status, callback_id_t callback_handle_id)
+{
+    assert(HAILO_SUCCESS != callback_status);
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CHECK(contains(m_callbacks, callback_handle_id), HAILO_NOT_FOUND, "Callback handle (id={}) not found!", callback_handle_id);
+        m_callbacks_status[callback_handle_id] = callback_status;
+        m_callbacks_queue.push(callback_handle_id);
+    }
+
+    m_cv.notify_one();
+    return HAILO_SUCCESS;
+}
 
 } // namespace hailort
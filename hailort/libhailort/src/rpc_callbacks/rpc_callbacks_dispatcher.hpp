@@ -43,8 +43,12 @@ public:
 
     virtual hailo_status wait(std::chrono::milliseconds timeout) override;
 
+    // The job's request was rejected (or couldn't be sent), so it never reached the inference. Returned by wait().
+    void set_submission_status(hailo_status status);
+
 private:
     EventPtr m_event;
+    std::atomic<hailo_status> m_submission_status;
 };
 
 class CallbacksQueue
@@ -63,6 +67,8 @@ public:
         std::function<void(const AsyncInferCompletionInfo&)> callback);
     hailo_status push_callback(hailo_status callback_status, rpc_object_handle_t callback_handle_id,
         hrpc::RpcConnection connection);
+    // Completes a callback whose request failed to be submitted, so there are no outputs to read
+    hailo_status push_failed_callback(hailo_status callback_status, callback_id_t callback_handle_id);
 
 private:
     const std::vector<std::string> m_outputs_names;
@@ -293,6 +293,33 @@ Expected<ProtoCallbackIdentifier> HailoRtRpcClient::VDevice_get_callback_id(cons
     return cb_id;
 }
 
+Expected<std::vector<ProtoCallbackIdentifier>> HailoRtRpcClient::VDevice_get_callback_ids(const VDeviceIdentifier &identifier,
+    uint32_t max_count, std::chrono::milliseconds linger)
+{
+    VDevice_get_callback_ids_Request request;
+    auto proto_identifier = request.mutable_identifier();
+    VDevice_convert_identifier_to_proto(identifier, proto_identifier);
+    request.set_max_count(max_count);
+    request.set_linger_ms(static_cast<uint32_t>(linger.count()));
+
+    VDevice_get_callback_ids_Reply reply;
+    grpc::ClientContext context;
+    grpc::Status status = m_stub->VDevice_get_callback_ids(&context, request, &reply);
+    CHECK_GRPC_STATUS_AS_EXPECTED(status);
+    assert(reply.status() < HAILO_STATUS_COUNT);
+    if (reply.status() == HAILO_SHUTDOWN_EVENT_SIGNALED) {
+        return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
+    }
+    CHECK_SUCCESS_AS_EXPECTED(static_cast<hailo_status>(reply.status()));
+
+    std::vector<ProtoCallbackIdentifier> cb_ids;
+    cb_ids.reserve(reply.callback_ids_size());
+    for (auto &cb_id : *reply.mutable_callback_ids()) {
+        cb_ids.emplace_back(std::move(cb_id));
+    }
+    return cb_ids;
+}
+
 hailo_status HailoRtRpcClient::VDevice_finish_callback_listener(const VDeviceIdentifier &identifier)
 {
     VDevice_finish_callback_listener_Request request;
@@ -1428,6 +1455,27 @@ hailo_status HailoRtRpcClient::ConfiguredNetworkGroup_set_nms_max_accumulated_ma
     return static_cast<hailo_status>(reply.status());
 }
 
+hailo_status HailoRtRpcClient::ConfiguredNetworkGroup_update_nms_config(const NetworkGroupIdentifier &identifier,
+    const std::map<std::string, NmsConfigUpdate> &updates)
+{
+    ConfiguredNetworkGroup_update_nms_config_Request request;
+    auto proto_identifier = request.mutable_identifier();
+    ConfiguredNetworkGroup_convert_identifier_to_proto(identifier, proto_identifier);
+    for (const auto &edge_name_to_update : updates) {
+        auto proto_update = request.add_updates();
+        proto_update->set_edge_name(edge_name_to_update.first);
+        proto_update->set_score_threshold(edge_name_to_update.second.score_threshold);
+        proto_update->set_iou_threshold(edge_name_to_update.second.iou_threshold);
+    }
+
+    ConfiguredNetworkGroup_update_nms_config_Reply reply;
+    ClientContextWithTimeout context;
+    grpc::Status status = m_stub->ConfiguredNetworkGroup_update_nms_config(&context, request, &reply);
+    CHECK_GRPC_STATUS(status);
+    assert(reply.status() < HAILO_STATUS_COUNT);
+    return static_cast<hailo_status>(reply.status());
+}
+
 Expected<std::vector<std::string>> HailoRtRpcClient::ConfiguredNetworkGroup_get_stream_names_from_vstream_name(const NetworkGroupIdentifier &identifier,
     const std::string &vstream_name)
 {
@@ -1983,6 +2031,22 @@ hailo_status HailoRtRpcClient::OutputVStream_set_nms_max_accumulated_mask_size(c
     return static_cast<hailo_status>(reply.status());
 }
 
+hailo_status HailoRtRpcClient::OutputVStream_update_nms_config(const VStreamIdentifier &identifier, const NmsConfigUpdate &update)
+{
+    VStream_update_nms_config_Request request;
+    auto proto_identifier = request.mutable_identifier();
+    VStream_convert_identifier_to_proto(identifier, proto_identifier);
+    request.set_score_threshold(update.score_threshold);
+    request.set_iou_threshold(update.iou_threshold);
+
+    ClientContextWithTimeout context;
+    VStream_update_nms_config_Reply reply;
+    grpc::Status status = m_stub->OutputVStream_update_nms_config(&context, request, &reply);
+    CHECK_GRPC_STATUS(status);
+    assert(reply.status() < HAILO_STATUS_COUNT);
+    return static_cast<hailo_status>(reply.status());
+}
+
 void HailoRtRpcClient::VDevice_convert_identifier_to_proto(const VDeviceIdentifier &identifier, ProtoVDeviceIdentifier *proto_identifier)
 {
     proto_identifier->set_vdevice_handle(identifier.m_vdevice_handle);
@@ -463,6 +463,11 @@ hailo_status ConfiguredNetworkGroupClient::set_nms_max_accumulated_mask_size(con
     return m_client->ConfiguredNetworkGroup_set_nms_max_accumulated_mask_size(m_identifier, edge_name, max_accumulated_mask_size);
 }
 
+hailo_status ConfiguredNetworkGroupClient::update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates)
+{
+    return m_client->ConfiguredNetworkGroup_update_nms_config(m_identifier, updates);
+}
+
 // TODO: support kv-cache over service (HRT-13968)
 hailo_status ConfiguredNetworkGroupClient::init_cache(uint32_t /* read_offset */, int32_t /* write_offset_delta */)
 {
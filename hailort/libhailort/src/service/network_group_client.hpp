@@ -122,6 +122,7 @@ public:
     virtual hailo_status set_nms_iou_threshold(const std::string &edge_name, float32_t iou_threshold) override;
     virtual hailo_status set_nms_max_bboxes_per_class(const std::string &edge_name, uint32_t max_bboxes_per_class) override;
     virtual hailo_status set_nms_max_accumulated_mask_size(const std::string &edge_name, uint32_t max_accumulated_mask_size) override;
+    virtual hailo_status update_nms_config(const std::map<std::string, NmsConfigUpdate> &updates) override;
 
     virtual hailo_status init_cache(uint32_t read_offset, int32_t write_offset_delta) override;
     virtual Expected<hailo_cache_info_t> get_cache_info() const override;
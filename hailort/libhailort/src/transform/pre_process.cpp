@@ -0,0 +1,391 @@
+/**
+ * Copyright (c) 2020-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file pre_process.cpp
+ * @brief Host pre-processing of input frames
+ *
+ * The whole pre-processing is done in a single pass over the output rows: each output row is produced from (at most)
+ * two color converted source rows, resized horizontally and vertically with fixed point bilinear weights, and written
+ * straight in the HW layout. The inner loops work on contiguous uint8/uint32 data with no branches, so they are left
+ * for the compiler to vectorize.
+ **/
+
+#include "transform/pre_process.hpp"
+#include "hailo/hailort_common.hpp"
+#include "common/utils.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+
+namespace hailort
+{
+
+static constexpr uint32_t INVALID_ROW_INDEX = UINT32_MAX;
+
+static inline uint8_t clip_to_uint8(int32_t value)
+{
+    return static_cast<uint8_t>((value < 0) ? 0 : ((value > UINT8_MAX) ? UINT8_MAX : value));
+}
+
+// BT.601 limited range YUV to RGB, in integer arithmetic
+static inline void yuv_to_rgb(int32_t y, int32_t u, int32_t v, uint8_t *rgb)
+{
+    const int32_t c = 298 * (y - 16) + 128;
+    const int32_t d = u - 128;
+    const int32_t e = v - 128;
+    rgb[0] = clip_to_uint8((c + 409 * e) >> 8);
+    rgb[1] = clip_to_uint8((c - 100 * d - 208 * e) >> 8);
+    rgb[2] = clip_to_uint8((c + 516 * d) >> 8);
+}
+
+hailo_status PreProcessContext::validate_params(const hailo_pre_process_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape)
+{
+    CHECK((0 != params.src_width) && (0 != params.src_height), HAILO_INVALID_ARGUMENT,
+        "Pre-process source frame dimensions must be non-zero (got {}x{})", params.src_width, params.src_height);
+    CHECK(RGB_CHANNELS == dst_image_shape.features, HAILO_INVALID_OPERATION,
+        "Pre-process is supported only for inputs with {} features (got {})", RGB_CHANNELS, dst_image_shape.features);
+
+    switch (params.src_order) {
+    case HAILO_FORMAT_ORDER_NHWC:
+        break;
+    case HAILO_FORMAT_ORDER_NV12:
+        CHECK((0 == (params.src_width % 2)) && (0 == (params.src_height % 2)), HAILO_INVALID_ARGUMENT,
+            "NV12 source frame dimensions must be even (got {}x{})", params.src_width, params.src_height);
+        break;
+    case HAILO_FORMAT_ORDER_YUY2:
+        CHECK(0 == (params.src_width % 2), HAILO_INVALID_ARGUMENT,
+            "YUY2 source frame width must be even (got {})", params.src_width);
+        break;
+    default:
+        LOGGER__ERROR("Pre-process source order {} is not supported (NHWC, NV12 and YUY2 are supported)",
+            HailoRTCommon::get_format_order_str(params.src_order));
+        return HAILO_INVALID_ARGUMENT;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+Expected<size_t> PreProcessContext::get_src_frame_size(const hailo_pre_process_params_t &params)
+{
+    const size_t pixels = static_cast<size_t>(params.src_width) * params.src_height;
+    switch (params.src_order) {
+    case HAILO_FORMAT_ORDER_NHWC:
+        return pixels * RGB_CHANNELS;
+    case HAILO_FORMAT_ORDER_NV12:
+        return pixels * 3 / 2;
+    case HAILO_FORMAT_ORDER_YUY2:
+        return pixels * 2;
+    default:
+        return make_unexpected(HAILO_INVALID_ARGUMENT);
+    }
+}
+
+PreProcessContext::ResizedSize PreProcessContext::get_resized_size(const hailo_pre_process_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape)
+{
+    if (!params.keep_aspect_ratio) {
+        return ResizedSize{dst_image_shape.width, dst_image_shape.height};
+    }
+
+    // Clamped to the destination frame, so the padding is never negative
+    const auto scale = std::min(static_cast<float64_t>(dst_image_shape.width) / params.src_width,
+        static_cast<float64_t>(dst_image_shape.height) / params.src_height);
+    const auto resized_width = std::min(dst_image_shape.width,
+        std::max(1u, static_cast<uint32_t>(std::lround(params.src_width * scale))));
+    const auto resized_height = std::min(dst_image_shape.height,
+        std::max(1u, static_cast<uint32_t>(std::lround(params.src_height * scale))));
+    return ResizedSize{resized_width, resized_height};
+}
+
+hailo_letterbox_info_t PreProcessContext::get_letterbox_info(const hailo_pre_process_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape)
+{
+    hailo_letterbox_info_t info = {};
+    info.src_width = params.src_width;
+    info.src_height = params.src_height;
+    info.dst_width = dst_image_shape.width;
+    info.dst_height = dst_image_shape.height;
+
+    const auto resized_size = get_resized_size(params, dst_image_shape);
+    info.scale_x = static_cast<float32_t>(resized_size.width) / static_cast<float32_t>(params.src_width);
+    info.scale_y = static_cast<float32_t>(resized_size.height) / static_cast<float32_t>(params.src_height);
+    info.pad_left = (dst_image_shape.width - resized_size.width) / 2;
+    info.pad_top = (dst_image_shape.height - resized_size.height) / 2;
+    return info;
+}
+
+std::vector<PreProcessContext::AxisSample> PreProcessContext::create_axis_samples(uint32_t resized_size, uint32_t src_size)
+{
+    // Pixel centers are aligned (same as cv2.resize with INTER_LINEAR)
+    const auto ratio = static_cast<float64_t>(src_size) / resized_size;
+    std::vector<AxisSample> samples(resized_size);
+    for (uint32_t i = 0; i < resized_size; i++) {
+        auto center = (i + 0.5) * ratio - 0.5;
+        center = std::min(std::max(center, 0.0), static_cast<float64_t>(src_size - 1));
+        const auto index0 = static_cast<uint32_t>(center);
+        samples[i].index0 = index0;
+        samples[i].index1 = std::min(index0 + 1, src_size - 1);
+        samples[i].weight1 = static_cast<uint32_t>(std::lround((center - index0) * WEIGHT_ONE));
+    }
+    return samples;
+}
+
+Expected<PreProcessContext::StoreLayout> PreProcessContext::get_direct_store_layout(
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &hw_image_shape,
+    const hailo_format_t &hw_format)
+{
+    if ((HAILO_FORMAT_TYPE_UINT8 != hw_format.type) || (dst_image_shape.height != hw_image_shape.height)) {
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    const bool same_shape = (dst_image_shape.width == hw_image_shape.width) &&
+        (dst_image_shape.features == hw_image_shape.features);
+    if ((HAILO_FORMAT_ORDER_NHWC == hw_format.order) && same_shape) {
+        return StoreLayout::NHWC;
+    }
+    if ((HAILO_FORMAT_ORDER_NHCW == hw_format.order) && same_shape) {
+        return StoreLayout::NHCW;
+    }
+    if ((HAILO_FORMAT_ORDER_RGB888 == hw_format.order) && ((RGB_CHANNELS + 1) == hw_image_shape.features) &&
+        (hw_image_shape.width >= dst_image_shape.width)) {
+        return StoreLayout::RGB888;
+    }
+    return make_unexpected(HAILO_NOT_FOUND);
+}
+
+Expected<std::unique_ptr<PreProcessContext>> PreProcessContext::create(const hailo_pre_process_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &hw_image_shape,
+    const hailo_format_t &hw_format, const std::vector<hailo_quant_info_t> &hw_quant_infos)
+{
+    CHECK_SUCCESS_AS_EXPECTED(validate_params(params, dst_image_shape));
+    TRY(const auto src_frame_size, get_src_frame_size(params));
+
+    auto store_layout = StoreLayout::NHWC;
+    std::unique_ptr<InputTransformContext> hw_transform_context;
+    Buffer nhwc_frame;
+
+    auto direct_store_layout = get_direct_store_layout(dst_image_shape, hw_image_shape, hw_format);
+    if (direct_store_layout) {
+        store_layout = direct_store_layout.release();
+    } else {
+        // The HW format needs a transformation of its own (e.g. quantization or padding) - build the frame in NHWC
+        // and let the regular input transformation handle it
+        const hailo_format_t nhwc_format = {HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_FLAGS_NONE};
+        TRY(hw_transform_context, InputTransformContext::create(dst_image_shape, nhwc_format, hw_image_shape,
+            hw_format, hw_quant_infos));
+        // Only the CPU accesses it - the transformation writes the DMA-able destination
+        TRY(nhwc_frame, Buffer::create(HailoRTCommon::get_shape_size(dst_image_shape)));
+    }
+
+    const size_t src_row_size = static_cast<size_t>(params.src_width) * RGB_CHANNELS;
+    const size_t dst_row_size = static_cast<size_t>(dst_image_shape.width) * RGB_CHANNELS;
+    TRY(auto rgb_rows, Buffer::create(2 * src_row_size + dst_row_size));
+
+    auto context = make_unique_nothrow<PreProcessContext>(params, dst_image_shape, hw_image_shape, src_frame_size,
+        store_layout, std::move(hw_transform_context), std::move(nhwc_frame), std::move(rgb_rows));
+    CHECK_NOT_NULL_AS_EXPECTED(context, HAILO_OUT_OF_HOST_MEMORY);
+    return context;
+}
+
+PreProcessContext::PreProcessContext(const hailo_pre_process_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &hw_image_shape,
+    size_t src_frame_size, StoreLayout store_layout, std::unique_ptr<InputTransformContext> &&hw_transform_context,
+    Buffer &&nhwc_frame, Buffer &&rgb_rows) :
+        m_params(params),
+        m_dst_image_shape(dst_image_shape),
+        m_hw_image_shape(hw_image_shape),
+        m_src_frame_size(src_frame_size),
+        m_store_layout(store_layout),
+        m_resized_size(get_resized_size(params, dst_image_shape)),
+        m_letterbox_info(get_letterbox_info(params, dst_image_shape)),
+        m_hw_transform_context(std::move(hw_transform_context)),
+        m_nhwc_frame(std::move(nhwc_frame)),
+        m_rgb_rows(std::move(rgb_rows)),
+        m_rgb_rows_index({INVALID_ROW_INDEX, INVALID_ROW_INDEX})
+{
+    m_x_samples = create_axis_samples(m_resized_size.width, params.src_width);
+    m_y_samples = create_axis_samples(m_resized_size.height, params.src_height);
+}
+
+void PreProcessContext::convert_row_to_rgb(const uint8_t *src, uint32_t row, uint8_t *rgb_row)
+{
+    const uint32_t width = m_params.src_width;
+    if (HAILO_FORMAT_ORDER_NV12 == m_params.src_order) {
+        const uint8_t *y_row = src + static_cast<size_t>(row) * width;
+        const uint8_t *uv_row = src + static_cast<size_t>(width) * m_params.src_height + static_cast<size_t>(row / 2) * width;
+        for (uint32_t x = 0; x < width; x++) {
+            const uint32_t uv_index = x & ~1u;
+            yuv_to_rgb(y_row[x], uv_row[uv_index], uv_row[uv_index + 1], rgb_row + x * RGB_CHANNELS);
+        }
+    } else {
+        assert(HAILO_FORMAT_ORDER_YUY2 == m_params.src_order);
+        const uint8_t *yuyv_row = src + static_cast<size_t>(row) * width * 2;
+        for (uint32_t x = 0; x < width; x++) {
+            const uint32_t pair_offset = (x & ~1u) * 2;
+            yuv_to_rgb(yuyv_row[x * 2], yuyv_row[pair_offset + 1], yuyv_row[pair_offset + 3], rgb_row + x * RGB_CHANNELS);
+        }
+    }
+}
+
+void PreProcessContext::get_rgb_rows(const uint8_t *src, uint32_t top_row, uint32_t bottom_row, const uint8_t *&top,
+    const uint8_t *&bottom)
+{
+    const size_t src_row_size = static_cast<size_t>(m_params.src_width) * RGB_CHANNELS;
+    if (HAILO_FORMAT_ORDER_NHWC == m_params.src_order) {
+        // Source is already RGB - sample it in place
+        top = src + top_row * src_row_size;
+        bottom = src + bottom_row * src_row_size;
+        return;
+    }
+
+    auto get_slot = [this, src, src_row_size](uint32_t row, int excluded_slot) -> const uint8_t* {
+        for (uint32_t slot = 0; slot < m_rgb_rows_index.size(); slot++) {
+            if (m_rgb_rows_index[slot] == row) {
+                return m_rgb_rows.data() + slot * src_row_size;
+            }
+        }
+        const uint32_t slot = (0 == excluded_slot) ? 1 : 0;
+        convert_row_to_rgb(src, row, m_rgb_rows.data() + slot * src_row_size);
+        m_rgb_rows_index[slot] = row;
+        return m_rgb_rows.data() + slot * src_row_size;
+    };
+
+    // The slot holding the bottom row (if cached) must not be overwritten by the top row
+    int bottom_slot = -1;
+    for (uint32_t slot = 0; slot < m_rgb_rows_index.size(); slot++) {
+        if (m_rgb_rows_index[slot] == bottom_row) {
+            bottom_slot = static_cast<int>(slot);
+        }
+    }
+    top = get_slot(top_row, bottom_slot);
+    const int top_slot = (top == m_rgb_rows.data()) ? 0 : 1;
+    bottom = get_slot(bottom_row, top_slot);
+}
+
+void PreProcessContext::resize_row(const uint8_t *top_row, const uint8_t *bottom_row, uint32_t weight1, uint8_t *dst_row)
+{
+    static constexpr uint32_t ROUNDING = 1u << (2 * WEIGHT_BITS - 1);
+    const uint32_t weight0 = WEIGHT_ONE - weight1;
+    const uint32_t pad_left = m_letterbox_info.pad_left;
+    const uint32_t resized_width = m_resized_size.width;
+    const uint8_t padding_value = m_params.padding_value;
+
+    memset(dst_row, padding_value, pad_left * RGB_CHANNELS);
+    uint8_t *resized = dst_row + pad_left * RGB_CHANNELS;
+    for (uint32_t x = 0; x < resized_width; x++) {
+        const auto &sample = m_x_samples[x];
+        const uint32_t x_weight1 = sample.weight1;
+        const uint32_t x_weight0 = WEIGHT_ONE - x_weight1;
+        const uint8_t *top0 = top_row + sample.index0 * RGB_CHANNELS;
+        const uint8_t *top1 = top_row + sample.index1 * RGB_CHANNELS;
+        const uint8_t *bottom0 = bottom_row + sample.index0 * RGB_CHANNELS;
+        const uint8_t *bottom1 = bottom_row + sample.index1 * RGB_CHANNELS;
+        for (uint32_t c = 0; c < RGB_CHANNELS; c++) {
+            const uint32_t top_value = top0[c] * x_weight0 + top1[c] * x_weight1;
+            const uint32_t bottom_value = bottom0[c] * x_weight0 + bottom1[c] * x_weight1;
+            resized[x * RGB_CHANNELS + c] = static_cast<uint8_t>((top_value * weight0 + bottom_value * weight1 + ROUNDING) >> (2 * WEIGHT_BITS));
+        }
+    }
+    assert((pad_left + resized_width) <= m_dst_image_shape.width);
+    const uint32_t pad_right = m_dst_image_shape.width - pad_left - resized_width;
+    memset(resized + resized_width * RGB_CHANNELS, padding_value, pad_right * RGB_CHANNELS);
+}
+
+void PreProcessContext::store_row(const uint8_t *rgb_row, uint32_t row, uint8_t *dst)
+{
+    const uint32_t width = m_dst_image_shape.width;
+    switch (m_store_layout) {
+    case StoreLayout::NHCW:
+    {
+        uint8_t *dst_row = dst + static_cast<size_t>(row) * width * RGB_CHANNELS;
+        for (uint32_t c = 0; c < RGB_CHANNELS; c++) {
+            uint8_t *dst_channel = dst_row + c * width;
+            for (uint32_t x = 0; x < width; x++) {
+                dst_channel[x] = rgb_row[x * RGB_CHANNELS + c];
+            }
+        }
+        break;
+    }
+    case StoreLayout::RGB888:
+    {
+        // Same layout as transform__h2d_NHWC_to_RGB888 - features flipped, followed by a zero byte, and zero padded width
+        const uint32_t hw_features = m_hw_image_shape.features;
+        uint8_t *dst_row = dst + static_cast<size_t>(row) * m_hw_image_shape.width * hw_features;
+        for (uint32_t x = 0; x < width; x++) {
+            dst_row[x * hw_features + 0] = rgb_row[x * RGB_CHANNELS + 2];
+            dst_row[x * hw_features + 1] = rgb_row[x * RGB_CHANNELS + 1];
+            dst_row[x * hw_features + 2] = rgb_row[x * RGB_CHANNELS + 0];
+            dst_row[x * hw_features + 3] = 0;
+        }
+        memset(dst_row + width * hw_features, 0, (m_hw_image_shape.width - width) * hw_features);
+        break;
+    }
+    case StoreLayout::NHWC:
+    default:
+        // Rows are resized in place (see process)
+        break;
+    }
+}
+
+hailo_status PreProcessContext::process(const MemoryView src, MemoryView dst)
+{
+    CHECK(src.size() == m_src_frame_size, HAILO_INVALID_ARGUMENT,
+        "Pre-process source frame size must be {} (got {})", m_src_frame_size, src.size());
+
+    const bool is_nhwc_target = m_hw_transform_context || (StoreLayout::NHWC == m_store_layout);
+    uint8_t *target = m_hw_transform_context ? m_nhwc_frame.data() : dst.data();
+    if (!m_hw_transform_context) {
+        const auto hw_frame_size = HailoRTCommon::get_shape_size(m_hw_image_shape);
+        CHECK(dst.size() >= hw_frame_size, HAILO_INVALID_ARGUMENT,
+            "Pre-process destination size must be at least {} (got {})", hw_frame_size, dst.size());
+    }
+
+    // The source buffer changes between frames - drop the cached rows
+    m_rgb_rows_index = {INVALID_ROW_INDEX, INVALID_ROW_INDEX};
+
+    const size_t src_row_size = static_cast<size_t>(m_params.src_width) * RGB_CHANNELS;
+    const size_t dst_row_size = static_cast<size_t>(m_dst_image_shape.width) * RGB_CHANNELS;
+    uint8_t *out_row = m_rgb_rows.data() + 2 * src_row_size;
+    const uint32_t pad_top = m_letterbox_info.pad_top;
+    const uint32_t resized_height = m_resized_size.height;
+
+    for (uint32_t row = 0; row < m_dst_image_shape.height; row++) {
+        uint8_t *row_target = is_nhwc_target ? (target + row * dst_row_size) : out_row;
+        if ((row < pad_top) || (row >= (pad_top + resized_height))) {
+            memset(row_target, m_params.padding_value, dst_row_size);
+        } else {
+            const auto &sample = m_y_samples[row - pad_top];
+            const uint8_t *top = nullptr;
+            const uint8_t *bottom = nullptr;
+            get_rgb_rows(src.data(), sample.index0, sample.index1, top, bottom);
+            resize_row(top, bottom, sample.weight1, row_target);
+        }
+        if (!is_nhwc_target) {
+            store_row(out_row, row, target);
+        }
+    }
+
+    if (m_hw_transform_context) {
+        return m_hw_transform_context->transform(MemoryView(m_nhwc_frame), dst);
+    }
+    return HAILO_SUCCESS;
+}
+
+std::string PreProcessContext::description() const
+{
+    std::stringstream description;
+    description << "src: " << m_params.src_width << "x" << m_params.src_height << " " <<
+        HailoRTCommon::get_format_order_str(m_params.src_order) << ", dst: " << m_dst_image_shape.width << "x" <<
+        m_dst_image_shape.height << ", " << (m_params.keep_aspect_ratio ? "letterbox" : "stretch");
+    if (m_hw_transform_context) {
+        description << ", " << m_hw_transform_context->description();
+    }
+    return description.str();
+}
+
+} /* namespace hailort */
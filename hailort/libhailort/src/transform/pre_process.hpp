@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2020-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file pre_process.hpp
+ * @brief Host pre-processing of input frames - fused resize, letterbox, color conversion and HW format reorder
+ **/
+
+#ifndef _HAILO_PRE_PROCESS_HPP_
+#define _HAILO_PRE_PROCESS_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+#include "hailo/transform.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+
+namespace hailort
+{
+
+class PreProcessContext final
+{
+public:
+    static Expected<std::unique_ptr<PreProcessContext>> create(const hailo_pre_process_params_t &params,
+        const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &hw_image_shape,
+        const hailo_format_t &hw_format, const std::vector<hailo_quant_info_t> &hw_quant_infos);
+
+    static hailo_status validate_params(const hailo_pre_process_params_t &params, const hailo_3d_image_shape_t &dst_image_shape);
+    static Expected<size_t> get_src_frame_size(const hailo_pre_process_params_t &params);
+    static hailo_letterbox_info_t get_letterbox_info(const hailo_pre_process_params_t &params,
+        const hailo_3d_image_shape_t &dst_image_shape);
+
+    // Processes a single source frame into dst, which is laid out in the HW format
+    hailo_status process(const MemoryView src, MemoryView dst);
+
+    size_t src_frame_size() const { return m_src_frame_size; }
+    const hailo_letterbox_info_t &letterbox_info() const { return m_letterbox_info; }
+    std::string description() const;
+
+    // Layout the resized rows are written in
+    enum class StoreLayout {
+        NHWC,
+        NHCW,
+        RGB888,
+    };
+
+    PreProcessContext(const hailo_pre_process_params_t &params, const hailo_3d_image_shape_t &dst_image_shape,
+        const hailo_3d_image_shape_t &hw_image_shape, size_t src_frame_size, StoreLayout store_layout,
+        std::unique_ptr<InputTransformContext> &&hw_transform_context, Buffer &&nhwc_frame, Buffer &&rgb_rows);
+
+private:
+    static constexpr uint32_t RGB_CHANNELS = 3;
+    // Fixed point precision of the bilinear interpolation weights
+    static constexpr uint32_t WEIGHT_BITS = 11;
+    static constexpr uint32_t WEIGHT_ONE = 1 << WEIGHT_BITS;
+
+    // Size of the resized source frame inside the destination frame (smaller than it when letterboxed)
+    struct ResizedSize {
+        uint32_t width;
+        uint32_t height;
+    };
+
+    struct AxisSample {
+        uint32_t index0;
+        uint32_t index1;
+        uint32_t weight1;
+    };
+
+    static ResizedSize get_resized_size(const hailo_pre_process_params_t &params,
+        const hailo_3d_image_shape_t &dst_image_shape);
+    static std::vector<AxisSample> create_axis_samples(uint32_t resized_size, uint32_t src_size);
+    static Expected<StoreLayout> get_direct_store_layout(const hailo_3d_image_shape_t &dst_image_shape,
+        const hailo_3d_image_shape_t &hw_image_shape, const hailo_format_t &hw_format);
+
+    void convert_row_to_rgb(const uint8_t *src, uint32_t row, uint8_t *rgb_row);
+    void get_rgb_rows(const uint8_t *src, uint32_t top_row, uint32_t bottom_row, const uint8_t *&top, const uint8_t *&bottom);
+    void resize_row(const uint8_t *top_row, const uint8_t *bottom_row, uint32_t weight1, uint8_t *dst_row);
+    void store_row(const uint8_t *rgb_row, uint32_t row, uint8_t *dst);
+
+    const hailo_pre_process_params_t m_params;
+    const hailo_3d_image_shape_t m_dst_image_shape;
+    const hailo_3d_image_shape_t m_hw_image_shape;
+    const size_t m_src_frame_size;
+    const StoreLayout m_store_layout;
+    const ResizedSize m_resized_size;
+    const hailo_letterbox_info_t m_letterbox_info;
+
+    // Used when the HW format can't be written directly - the frame is built in NHWC and then transformed
+    std::unique_ptr<InputTransformContext> m_hw_transform_context;
+    Buffer m_nhwc_frame;
+
+    std::vector<AxisSample> m_x_samples;
+    std::vector<AxisSample> m_y_samples;
+
+    // Color converted source rows, plus one row for the resized output. The source row held by each slot is cached,
+    // since consecutive output rows usually sample the same source rows.
+    Buffer m_rgb_rows;
+    std::array<uint32_t, 2> m_rgb_rows_index;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_PRE_PROCESS_HPP_ */
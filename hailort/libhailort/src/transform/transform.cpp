@@ -36,8 +36,8 @@ Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream
     const hailo_format_type_t &src_format_type, const hailo_format_type_t &dst_format_type)
 {
     if (HAILO_H2D_STREAM == stream_direction) {
-        CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 != dst_format_type, HAILO_INVALID_ARGUMENT,
-            "dst type cant be {} on input quantization", HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        CHECK_AS_EXPECTED(!HailoRTCommon::is_float_format_type(dst_format_type), HAILO_INVALID_ARGUMENT,
+            "dst type cant be {} on input quantization", HailoRTCommon::get_format_type_str(dst_format_type));
         CHECK_AS_EXPECTED(!((HAILO_FORMAT_TYPE_UINT8 == dst_format_type) && (HAILO_FORMAT_TYPE_UINT16 == src_format_type)),
             HAILO_INVALID_ARGUMENT, "src type is {}, while the model compiled for type {}. Input quantization is impossible with this src type.",
             HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8));
@@ -48,8 +48,8 @@ Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream
         }
         return ((src_format_type != HAILO_FORMAT_TYPE_AUTO) && (dst_format_type != src_format_type));
     } else {
-        CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 != src_format_type, HAILO_INVALID_ARGUMENT,
-            "src type cant be {} on output de-quantization", HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        CHECK_AS_EXPECTED(!HailoRTCommon::is_float_format_type(src_format_type), HAILO_INVALID_ARGUMENT,
+            "src type cant be {} on output de-quantization", HailoRTCommon::get_format_type_str(src_format_type));
         CHECK_AS_EXPECTED(!((HAILO_FORMAT_TYPE_UINT8 == dst_format_type) && (HAILO_FORMAT_TYPE_UINT16 == src_format_type)),
             HAILO_INVALID_ARGUMENT, "The model compiled for type {}, while the dst type is {}. Output de-quantization is impossible to this dst type",
             HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8));
@@ -851,6 +851,21 @@ hailo_status transform__h2d_RGB4_to_NHCW(const T *src_ptr, const hailo_3d_image_
     return HAILO_SUCCESS;
 }
 
+template<typename T>
+hailo_status InputTransformContext::quantize_float_stream(const T *src_ptr, void *quant_buffer, uint32_t shape_size)
+{
+    if (HAILO_FORMAT_TYPE_UINT8 == m_dst_format.type) {
+        Quantization::quantize_input_buffer<T, uint8_t>(const_cast<T*>(src_ptr), static_cast<uint8_t*>(quant_buffer), shape_size,
+            m_dst_quant_infos[0]);
+    } else if (HAILO_FORMAT_TYPE_UINT16 == m_dst_format.type) {
+        Quantization::quantize_input_buffer<T, uint16_t>(const_cast<T*>(src_ptr), static_cast<uint16_t*>(quant_buffer), shape_size,
+            m_dst_quant_infos[0]);
+    } else {
+        return HAILO_INVALID_OPERATION;
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status InputTransformContext::quantize_stream(const void *src_ptr, void *quant_buffer)
 {
     auto shape_size = HailoRTCommon::get_shape_size(m_src_image_shape);
@@ -865,16 +880,11 @@ hailo_status InputTransformContext::quantize_stream(const void *src_ptr, void *q
             }
             break;
         case HAILO_FORMAT_TYPE_FLOAT32:
-            if (HAILO_FORMAT_TYPE_UINT8 == m_dst_format.type) {
-                Quantization::quantize_input_buffer<float32_t, uint8_t>((float32_t*)src_ptr, (uint8_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
-            }
-            else if (HAILO_FORMAT_TYPE_UINT16 == m_dst_format.type) {
-                Quantization::quantize_input_buffer<float32_t, uint16_t>((float32_t*)src_ptr, (uint16_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
-            }
-            else {
-                return HAILO_INVALID_OPERATION;
-            }
-            break;
+            return quantize_float_stream<float32_t>(static_cast<const float32_t*>(src_ptr), quant_buffer, shape_size);
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return quantize_float_stream<Float16>(static_cast<const Float16*>(src_ptr), quant_buffer, shape_size);
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            return quantize_float_stream<BFloat16>(static_cast<const BFloat16*>(src_ptr), quant_buffer, shape_size);
         default:
             LOGGER__ERROR("Invalid src-buffer's type format");
             return HAILO_INVALID_ARGUMENT;
@@ -882,6 +892,41 @@ hailo_status InputTransformContext::quantize_stream(const void *src_ptr, void *q
     return HAILO_SUCCESS;
 }
 
+template<typename T>
+hailo_status FrameOutputTransformContext::dequantize_float_stream(T *dst_ptr, uint32_t shape_size)
+{
+    if (HAILO_FORMAT_ORDER_NHW != m_dst_format.order) {
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            if (m_are_all_qps_the_same) {
+                Quantization::dequantize_output_buffer_in_place<T, uint8_t>(dst_ptr, shape_size, m_dst_quant_infos[0]);
+            } else {
+                dequantize_output_by_feature<T, uint8_t>(dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+            }
+        }
+        else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+            if (m_are_all_qps_the_same) {
+                Quantization::dequantize_output_buffer_in_place<T, uint16_t>(dst_ptr, shape_size, m_dst_quant_infos[0]);
+            } else {
+                dequantize_output_by_feature<T, uint16_t>(dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+            }
+        }
+        else {
+            return HAILO_INVALID_OPERATION;
+        }
+    } else {
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            cast_elements_inplace<T, uint8_t>(dst_ptr, shape_size);
+        }
+        else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+            cast_elements_inplace<T, uint16_t>(dst_ptr, shape_size);
+        }
+        else {
+            return HAILO_INVALID_OPERATION;
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
 {
     auto shape_size = HailoRTCommon::get_shape_size(m_dst_image_shape);
@@ -895,36 +940,11 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
             }
             break;
         case HAILO_FORMAT_TYPE_FLOAT32:
-            if (HAILO_FORMAT_ORDER_NHW != m_dst_format.order) {
-                if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
-                    if (m_are_all_qps_the_same) {
-                        Quantization::dequantize_output_buffer_in_place<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_dst_quant_infos[0]);
-                    } else {
-                        dequantize_output_by_feature<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
-                    }
-                }
-                else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
-                    if (m_are_all_qps_the_same) {
-                        Quantization::dequantize_output_buffer_in_place<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_dst_quant_infos[0]);
-                    } else {
-                        dequantize_output_by_feature<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
-                    }
-                }
-                else {
-                    return HAILO_INVALID_OPERATION;
-                }
-            } else {
-                if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
-                    cast_elements_inplace<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size);
-                }
-                else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
-                    cast_elements_inplace<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size);
-                }
-                else {
-                    return HAILO_INVALID_OPERATION;
-                }
-            }
-            break;
+            return dequantize_float_stream<float32_t>(static_cast<float32_t*>(const_cast<void*>(dst_ptr)), shape_size);
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return dequantize_float_stream<Float16>(static_cast<Float16*>(const_cast<void*>(dst_ptr)), shape_size);
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            return dequantize_float_stream<BFloat16>(static_cast<BFloat16*>(const_cast<void*>(dst_ptr)), shape_size);
         default:
             LOGGER__ERROR("Invalid dst-buffer's type format");
             return HAILO_INVALID_ARGUMENT;
@@ -1379,9 +1399,13 @@ hailo_status InputTransformContext::transform_inner(const void *src_ptr, void *q
     }
 
     if (m_should_reorder){
-        auto status = reorder_input_stream(src_ptr, transposed_image_shape, quantized_src_format, dst_ptr, 
-            m_dst_image_shape, m_dst_format);
-        CHECK_SUCCESS(status);
+        if (nullptr != m_reorder_kernel) {
+            m_reorder_kernel(src_ptr, transposed_image_shape, dst_ptr, m_dst_image_shape);
+        } else {
+            auto status = reorder_input_stream(src_ptr, transposed_image_shape, quantized_src_format, dst_ptr,
+                m_dst_image_shape, m_dst_format);
+            CHECK_SUCCESS(status);
+        }
     }
 
     return HAILO_SUCCESS;
@@ -1425,9 +1449,13 @@ hailo_status FrameOutputTransformContext::transform_inner(const void *src_ptr, v
         } else {
             orig_dst_ptr = dst_ptr;
         }
-        auto status = reorder_output_stream(src_ptr, m_src_image_shape, m_src_format, orig_dst_ptr, transposed_image_shape, 
-            m_dst_format);
-        CHECK_SUCCESS(status);
+        if (nullptr != m_reorder_kernel) {
+            m_reorder_kernel(src_ptr, m_src_image_shape, orig_dst_ptr, transposed_image_shape);
+        } else {
+            auto status = reorder_output_stream(src_ptr, m_src_image_shape, m_src_format, orig_dst_ptr,
+                transposed_image_shape, m_dst_format);
+            CHECK_SUCCESS(status);
+        }
     }
 
     if (m_should_transpose) {
@@ -1702,8 +1730,20 @@ InputTransformContext::InputTransformContext(size_t src_frame_size, const hailo_
         m_should_reorder(should_reorder),
         m_should_pad_periph(should_pad_periph),
         m_quant_buffer(std::move(quant_buffer)),
-        m_transpose_buffer(std::move(transpose_buffer))
-{}
+        m_transpose_buffer(std::move(transpose_buffer)),
+        m_reorder_kernel(nullptr)
+{
+    if (m_should_reorder) {
+        // Same shape and format as given to reorder_input_stream by transform_inner
+        auto reorder_src_format = m_src_format;
+        if (m_should_quantize) {
+            reorder_src_format.type = m_dst_format.type;
+        }
+        auto reorder_src_shape = m_should_transpose ? transposed_shape(m_src_image_shape) : m_src_image_shape;
+        m_reorder_kernel = TransformKernels::get_input_reorder_kernel(reorder_src_shape, reorder_src_format,
+            m_dst_image_shape, m_dst_format);
+    }
+}
 
 hailo_status InputTransformContext::transform(const MemoryView src, MemoryView dst)
 {
@@ -1831,8 +1871,15 @@ FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size,
     const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph) :
         OutputTransformContext(src_frame_size, src_format, dst_frame_size, dst_format, dst_quant_infos, should_quantize, 
             should_transpose, should_reorder, should_pad_periph), m_src_image_shape(src_image_shape), m_dst_image_shape(dst_image_shape), 
-            m_transpose_buffer(std::move(transpose_buffer))
+            m_transpose_buffer(std::move(transpose_buffer)), m_reorder_kernel(nullptr)
 {
+    if (m_should_reorder) {
+        // Same shape as given to reorder_output_stream by transform_inner
+        auto reorder_dst_shape = m_should_transpose ? transposed_shape(m_dst_image_shape) : m_dst_image_shape;
+        m_reorder_kernel = TransformKernels::get_output_reorder_kernel(m_src_image_shape, m_src_format,
+            reorder_dst_shape, m_dst_format);
+    }
+
     // TODO: Add verification that quant infos size equals to features count (HRT-11052)
 
     bool are_all_qps_the_same = true;
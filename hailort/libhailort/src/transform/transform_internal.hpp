@@ -20,6 +20,7 @@
 
 #include "stream_common/stream_internal.hpp"
 #include "hef/layer_info.hpp"
+#include "transform/transform_kernels.hpp"
 
 #include <map>
 #include <vector>
@@ -28,6 +29,12 @@
 namespace hailort
 {
 
+// Generic reorders, dispatching on the formats on every call
+hailo_status reorder_input_stream(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, hailo_format_t src_format,
+    void *dst_ptr, hailo_3d_image_shape_t dst_image_shape, hailo_format_t dst_format);
+hailo_status reorder_output_stream(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, hailo_format_t src_format,
+    void *dst_ptr, hailo_3d_image_shape_t dst_image_shape, hailo_format_t dst_format);
+
 class HAILORTAPI TransformContextUtils final
 {
 public:
@@ -144,6 +151,9 @@ public:
     virtual std::string description() const override;
 
 private:
+    template <typename T>
+    hailo_status dequantize_float_stream(T *dst_ptr, uint32_t shape_size);
+
     template <typename T, typename Q>
     static inline void dequantize_output_by_feature(T *dst_ptr, uint32_t buffer_elements_count,
         const std::vector<QuantInfoForDequantize> &quant_infos, uint32_t repetition_count)
@@ -164,6 +174,8 @@ private:
     bool m_are_all_qps_the_same;
     std::vector<QuantInfoForDequantize> m_quant_info_per_feature;
     uint32_t m_quant_infos_rep_count;
+    // Resolved on creation, nullptr if the generic reorder is used
+    ReorderKernel m_reorder_kernel;
 };
 
 class HAILORTAPI NMSOutputTransformContext final : public OutputTransformContext
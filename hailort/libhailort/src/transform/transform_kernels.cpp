@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transform_kernels.cpp
+ * @brief Resolution of the specialized reorder kernels
+ **/
+
+#include "transform/transform_kernels.hpp"
+
+
+namespace hailort
+{
+
+template<typename T, bool HAS_PADDING, template<typename, uint32_t, bool> class Kernel>
+static ReorderKernel get_kernel_by_features(uint32_t features)
+{
+    switch (features) {
+    case 1:
+        return Kernel<T, 1, HAS_PADDING>::run;
+    case 3:
+        return Kernel<T, 3, HAS_PADDING>::run;
+    case 4:
+        return Kernel<T, 4, HAS_PADDING>::run;
+    case 8:
+        return Kernel<T, 8, HAS_PADDING>::run;
+    case 16:
+        return Kernel<T, 16, HAS_PADDING>::run;
+    default:
+        return nullptr;
+    }
+}
+
+template<template<typename, uint32_t, bool> class Kernel>
+static ReorderKernel get_kernel(hailo_format_type_t type, uint32_t features, bool has_padding)
+{
+    switch (type) {
+    case HAILO_FORMAT_TYPE_UINT8:
+        return has_padding ? get_kernel_by_features<uint8_t, true, Kernel>(features) :
+            get_kernel_by_features<uint8_t, false, Kernel>(features);
+    case HAILO_FORMAT_TYPE_UINT16:
+        return has_padding ? get_kernel_by_features<uint16_t, true, Kernel>(features) :
+            get_kernel_by_features<uint16_t, false, Kernel>(features);
+    default:
+        return nullptr;
+    }
+}
+
+const std::vector<uint32_t> &TransformKernels::specialized_features()
+{
+    static const std::vector<uint32_t> features = {1, 3, 4, 8, 16};
+    return features;
+}
+
+ReorderKernel TransformKernels::get_input_reorder_kernel(const hailo_3d_image_shape_t &src_image_shape,
+    const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape, const hailo_format_t &dst_format)
+{
+    // reorder_input_stream switches on the dst type, the src is already quantized
+    if ((HAILO_FORMAT_ORDER_NHWC == src_format.order) && (HAILO_FORMAT_ORDER_NHCW == dst_format.order)) {
+        if ((src_image_shape.features != dst_image_shape.features) || (src_image_shape.height != dst_image_shape.height) ||
+            (src_image_shape.width > dst_image_shape.width)) {
+            return nullptr;
+        }
+        return get_kernel<H2dNhwcToNhcwKernel>(dst_format.type, src_image_shape.features,
+            (src_image_shape.width != dst_image_shape.width));
+    }
+
+    if (((HAILO_FORMAT_ORDER_FCR == src_format.order) || (HAILO_FORMAT_ORDER_NHWC == src_format.order)) &&
+        (HAILO_FORMAT_ORDER_FCR == dst_format.order)) {
+        if (src_image_shape.features > dst_image_shape.features) {
+            return nullptr;
+        }
+        return get_kernel<H2dFcrKernel>(dst_format.type, src_image_shape.features,
+            (src_image_shape.features != dst_image_shape.features));
+    }
+
+    return nullptr;
+}
+
+ReorderKernel TransformKernels::get_output_reorder_kernel(const hailo_3d_image_shape_t &src_image_shape,
+    const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape, const hailo_format_t &dst_format)
+{
+    // reorder_output_stream switches on the src type, the dst is dequantized afterwards
+    if ((HAILO_FORMAT_ORDER_NHCW == src_format.order) && (HAILO_FORMAT_ORDER_NHWC == dst_format.order)) {
+        if ((src_image_shape.features != dst_image_shape.features) || (src_image_shape.width < dst_image_shape.width)) {
+            return nullptr;
+        }
+        return get_kernel<D2hNhcwToNhwcKernel>(src_format.type, dst_image_shape.features,
+            (src_image_shape.width != dst_image_shape.width));
+    }
+
+    if (((HAILO_FORMAT_ORDER_FCR == src_format.order) &&
+            ((HAILO_FORMAT_ORDER_FCR == dst_format.order) || (HAILO_FORMAT_ORDER_NHWC == dst_format.order))) ||
+        ((HAILO_FORMAT_ORDER_NHWC == src_format.order) && (HAILO_FORMAT_ORDER_NHWC == dst_format.order))) {
+        if (src_image_shape.features < dst_image_shape.features) {
+            return nullptr;
+        }
+        return get_kernel<D2hNhwcToNhwcKernel>(src_format.type, dst_image_shape.features,
+            (src_image_shape.features != dst_image_shape.features));
+    }
+
+    return nullptr;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transform_kernels.hpp
+ * @brief Reorder kernels specialized by element type, features count and padding, resolved once when a transform
+ *        context is created instead of on every frame
+ **/
+
+#ifndef _HAILO_TRANSFORM_KERNELS_HPP_
+#define _HAILO_TRANSFORM_KERNELS_HPP_
+
+#include "hailo/hailort.h"
+
+#include <cstring>
+#include <vector>
+
+
+namespace hailort
+{
+
+using ReorderKernel = void(*)(const void *src_ptr, const hailo_3d_image_shape_t &src_image_shape, void *dst_ptr,
+    const hailo_3d_image_shape_t &dst_image_shape);
+
+// The kernels compute the same offsets as the generic transform__h2d_* / transform__d2h_* functions, but FEATURES and
+// HAS_PADDING are known at compile time, so the features loops are unrolled and the padding branches are removed.
+
+// NHWC -> NHCW, padding the width of the dst
+template<typename T, uint32_t FEATURES, bool HAS_PADDING>
+struct H2dNhwcToNhcwKernel final
+{
+    static void run(const void *src_ptr, const hailo_3d_image_shape_t &src_image_shape, void *dst_ptr,
+        const hailo_3d_image_shape_t &dst_image_shape)
+    {
+        const T *src = static_cast<const T*>(src_ptr);
+        T *dst = static_cast<T*>(dst_ptr);
+        const uint32_t src_width = src_image_shape.width;
+        const uint32_t dst_width = HAS_PADDING ? dst_image_shape.width : src_width;
+
+        for (uint32_t r = 0; r < src_image_shape.height; r++) {
+            const T *src_row = src + static_cast<size_t>(r) * src_width * FEATURES;
+            T *dst_row = dst + static_cast<size_t>(r) * dst_width * FEATURES;
+            for (uint32_t f = 0; f < FEATURES; f++) {
+                T *dst_line = dst_row + static_cast<size_t>(f) * dst_width;
+                for (uint32_t c = 0; c < src_width; c++) {
+                    dst_line[c] = src_row[static_cast<size_t>(c) * FEATURES + f];
+                }
+                if (HAS_PADDING) {
+                    memset(dst_line + src_width, 0, (dst_width - src_width) * sizeof(T));
+                }
+            }
+        }
+    }
+};
+
+// NHCW -> NHWC, dropping the width padding of the src
+template<typename T, uint32_t FEATURES, bool HAS_PADDING>
+struct D2hNhcwToNhwcKernel final
+{
+    static void run(const void *src_ptr, const hailo_3d_image_shape_t &src_image_shape, void *dst_ptr,
+        const hailo_3d_image_shape_t &dst_image_shape)
+    {
+        const T *src = static_cast<const T*>(src_ptr);
+        T *dst = static_cast<T*>(dst_ptr);
+        const uint32_t dst_width = dst_image_shape.width;
+        const uint32_t src_width = HAS_PADDING ? src_image_shape.width : dst_width;
+
+        for (uint32_t r = 0; r < dst_image_shape.height; r++) {
+            const T *src_row = src + static_cast<size_t>(r) * src_width * FEATURES;
+            T *dst_row = dst + static_cast<size_t>(r) * dst_width * FEATURES;
+            for (uint32_t c = 0; c < dst_width; c++) {
+                T *dst_pixel = dst_row + static_cast<size_t>(c) * FEATURES;
+                for (uint32_t f = 0; f < FEATURES; f++) {
+                    dst_pixel[f] = src_row[static_cast<size_t>(f) * src_width + c];
+                }
+            }
+        }
+    }
+};
+
+// NHWC/FCR -> FCR, padding the features of the dst. FEATURES is the src features count.
+template<typename T, uint32_t FEATURES, bool HAS_PADDING>
+struct H2dFcrKernel final
+{
+    static void run(const void *src_ptr, const hailo_3d_image_shape_t &src_image_shape, void *dst_ptr,
+        const hailo_3d_image_shape_t &dst_image_shape)
+    {
+        const T *src = static_cast<const T*>(src_ptr);
+        T *dst = static_cast<T*>(dst_ptr);
+        const uint32_t dst_features = HAS_PADDING ? dst_image_shape.features : FEATURES;
+        const size_t dst_row_size = static_cast<size_t>(dst_image_shape.width) * dst_features;
+
+        for (uint32_t r = 0; r < src_image_shape.height; r++) {
+            const T *src_pixel = src + static_cast<size_t>(r) * src_image_shape.width * FEATURES;
+            T *dst_pixel = dst + r * dst_row_size;
+            for (uint32_t c = 0; c < src_image_shape.width; c++) {
+                memcpy(dst_pixel, src_pixel, FEATURES * sizeof(T));
+                if (HAS_PADDING) {
+                    memset(dst_pixel + FEATURES, 0, (dst_features - FEATURES) * sizeof(T));
+                }
+                src_pixel += FEATURES;
+                dst_pixel += dst_features;
+            }
+        }
+    }
+};
+
+// NHWC/FCR -> NHWC, dropping the features padding of the src. FEATURES is the dst features count.
+template<typename T, uint32_t FEATURES, bool HAS_PADDING>
+struct D2hNhwcToNhwcKernel final
+{
+    static void run(const void *src_ptr, const hailo_3d_image_shape_t &src_image_shape, void *dst_ptr,
+        const hailo_3d_image_shape_t &dst_image_shape)
+    {
+        const T *src = static_cast<const T*>(src_ptr);
+        T *dst = static_cast<T*>(dst_ptr);
+        const uint32_t src_features = HAS_PADDING ? src_image_shape.features : FEATURES;
+        const size_t src_row_size = static_cast<size_t>(src_image_shape.width) * src_features;
+
+        for (uint32_t r = 0; r < dst_image_shape.height; r++) {
+            const T *src_pixel = src + r * src_row_size;
+            T *dst_pixel = dst + static_cast<size_t>(r) * dst_image_shape.width * FEATURES;
+            for (uint32_t c = 0; c < dst_image_shape.width; c++) {
+                memcpy(dst_pixel, src_pixel, FEATURES * sizeof(T));
+                src_pixel += src_features;
+                dst_pixel += FEATURES;
+            }
+        }
+    }
+};
+
+class TransformKernels final
+{
+public:
+    // Features counts that have specialized kernels
+    static const std::vector<uint32_t> &specialized_features();
+
+    // Return nullptr if the reorder has no specialized kernel, in which case the generic reorder should be used.
+    // The args are the ones given to reorder_input_stream / reorder_output_stream.
+    static ReorderKernel get_input_reorder_kernel(const hailo_3d_image_shape_t &src_image_shape,
+        const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape, const hailo_format_t &dst_format);
+    static ReorderKernel get_output_reorder_kernel(const hailo_3d_image_shape_t &src_image_shape,
+        const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape, const hailo_format_t &dst_format);
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TRANSFORM_KERNELS_HPP_ */
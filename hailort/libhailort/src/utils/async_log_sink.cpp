@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file async_log_sink.cpp
+ * @brief Implements AsyncLogSink
+ **/
+
+#include "utils/async_log_sink.hpp"
+#include "common/fork_support.hpp"
+#include "common/os_utils.hpp"
+
+#include <atomic>
+
+#ifdef HAILO_IS_FORK_SUPPORTED
+#include <pthread.h>
+#endif
+
+
+namespace hailort
+{
+
+#ifdef HAILO_IS_FORK_SUPPORTED
+// The writer thread doesn't exist in a forked child, so the child writes synchronously.
+static std::atomic<bool> g_is_forked_child(false);
+
+static void on_fork_child()
+{
+    g_is_forked_child = true;
+}
+#endif
+
+static bool is_writer_thread_available()
+{
+#ifdef HAILO_IS_FORK_SUPPORTED
+    return !g_is_forked_child.load(std::memory_order_relaxed);
+#else
+    return true;
+#endif
+}
+
+AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> &&sinks, size_t max_queue_size) :
+    m_sinks(std::move(sinks)),
+    m_max_queue_size(max_queue_size),
+    m_dropped_count(0),
+    m_is_flush_requested(false),
+    m_is_running(true)
+{
+#ifdef HAILO_IS_FORK_SUPPORTED
+    static std::once_flag register_atfork_once;
+    std::call_once(register_atfork_once, []() {
+        pthread_atfork(nullptr, nullptr, on_fork_child);
+    });
+#endif
+
+    m_writer_thread = std::thread([this]() {
+        OsUtils::set_current_thread_name("LOG_WRITER");
+        writer_thread_main();
+    });
+}
+
+AsyncLogSink::~AsyncLogSink()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_running = false;
+    }
+    m_cv.notify_one();
+
+    if (m_writer_thread.joinable()) {
+        if (is_writer_thread_available()) {
+            m_writer_thread.join();
+        } else {
+            m_writer_thread.detach();
+        }
+    }
+}
+
+void AsyncLogSink::log(const spdlog::details::log_msg &msg)
+{
+    if (!is_writer_thread_available()) {
+        write_to_sinks(msg);
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_queue.size() >= m_max_queue_size) {
+            m_dropped_count++;
+            return;
+        }
+        m_queue.emplace_back(msg);
+    }
+    m_cv.notify_one();
+}
+
+void AsyncLogSink::flush()
+{
+    if (!is_writer_thread_available()) {
+        flush_sinks();
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_flush_requested = true;
+    }
+    m_cv.notify_one();
+}
+
+void AsyncLogSink::set_pattern(const std::string &pattern)
+{
+    for (auto &sink : m_sinks) {
+        sink->set_pattern(pattern);
+    }
+}
+
+void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+{
+    for (auto &sink : m_sinks) {
+        sink->set_formatter(sink_formatter->clone());
+    }
+}
+
+void AsyncLogSink::writer_thread_main()
+{
+    // Swapped with m_queue on every batch, so both keep their capacity and the logging threads don't allocate
+    std::vector<spdlog::details::log_msg_buffer> batch;
+    bool is_running = true;
+    while (is_running) {
+        uint64_t dropped_count = 0;
+        bool is_flush_requested = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() {
+                return !m_queue.empty() || m_is_flush_requested || !m_is_running;
+            });
+            batch.swap(m_queue);
+            dropped_count = std::exchange(m_dropped_count, 0);
+            is_flush_requested = std::exchange(m_is_flush_requested, false);
+            is_running = m_is_running;
+        }
+
+        for (const auto &msg : batch) {
+            write_to_sinks(msg);
+        }
+
+        if (0 != dropped_count) {
+            // Messages are dropped only when the queue is full, so the batch isn't empty
+            const auto summary = fmt::format("{} log messages were dropped (log queue is full)", dropped_count);
+            write_to_sinks(spdlog::details::log_msg(batch.back().logger_name, spdlog::level::warn, summary));
+        }
+        batch.clear();
+
+        if (is_flush_requested || !is_running) {
+            flush_sinks();
+        }
+    }
+}
+
+void AsyncLogSink::write_to_sinks(const spdlog::details::log_msg &msg)
+{
+    for (auto &sink : m_sinks) {
+        if (sink->should_log(msg.level)) {
+            sink->log(msg);
+        }
+    }
+}
+
+void AsyncLogSink::flush_sinks()
+{
+    for (auto &sink : m_sinks) {
+        sink->flush();
+    }
+}
+
+} /* namespace hailort */
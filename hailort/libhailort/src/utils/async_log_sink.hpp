@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file async_log_sink.hpp
+ * @brief Log sink writing to other sinks from a background thread, so logging threads never wait on file I/O.
+ **/
+
+#ifndef _HAILO_ASYNC_LOG_SINK_HPP_
+#define _HAILO_ASYNC_LOG_SINK_HPP_
+
+#include "common/logger_macros.hpp"
+
+#include <spdlog/sinks/sink.h>
+#include <spdlog/details/log_msg_buffer.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hailort
+{
+
+// The queue is bounded and lossy - when it is full, new messages are dropped and counted, so a log storm never blocks
+// the logging threads. The number of dropped messages is written once the writer catches up.
+// The sink level should be the minimal level of the wrapped sinks (each wrapped sink still filters by its own level).
+class AsyncLogSink final : public spdlog::sinks::sink
+{
+public:
+    AsyncLogSink(std::vector<spdlog::sink_ptr> &&sinks, size_t max_queue_size);
+    virtual ~AsyncLogSink();
+
+    AsyncLogSink(const AsyncLogSink &) = delete;
+    AsyncLogSink &operator=(const AsyncLogSink &) = delete;
+    AsyncLogSink(AsyncLogSink &&) = delete;
+    AsyncLogSink &operator=(AsyncLogSink &&) = delete;
+
+    virtual void log(const spdlog::details::log_msg &msg) override;
+    // Doesn't wait - the writer thread flushes the wrapped sinks after writing the messages queued so far.
+    virtual void flush() override;
+    virtual void set_pattern(const std::string &pattern) override;
+    virtual void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+private:
+    void writer_thread_main();
+    void write_to_sinks(const spdlog::details::log_msg &msg);
+    void flush_sinks();
+
+    std::vector<spdlog::sink_ptr> m_sinks;
+    const size_t m_max_queue_size;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<spdlog::details::log_msg_buffer> m_queue;
+    uint64_t m_dropped_count;
+    bool m_is_flush_requested;
+    bool m_is_running;
+
+    std::thread m_writer_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_ASYNC_LOG_SINK_HPP_ */
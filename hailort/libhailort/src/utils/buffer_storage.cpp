@@ -14,6 +14,9 @@
 #include "vdma/memory/dma_able_buffer.hpp"
 #include "vdma/memory/mapped_buffer.hpp"
 #include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+#include <cstring>
 
 namespace hailort
 {
@@ -58,7 +61,11 @@ BufferStorageParams::BufferStorageParams() :
 
 Expected<BufferStoragePtr> BufferStorage::create(size_t size, const BufferStorageParams &params)
 {
-    if (params.flags == HAILO_BUFFER_FLAGS_NONE) {
+    if ((HAILO_BUFFER_FLAGS_NONE == params.flags) || (HAILO_BUFFER_FLAGS_POOLED_HEAP == params.flags)) {
+        if ((HAILO_BUFFER_FLAGS_POOLED_HEAP == params.flags) && PooledHeapStorage::is_pooled_size(size)) {
+            TRY(auto result, PooledHeapStorage::create(size));
+            return std::static_pointer_cast<BufferStorage>(result);
+        }
         auto result = HeapStorage::create(size);
         CHECK_EXPECTED(result);
         return std::static_pointer_cast<BufferStorage>(result.release());
@@ -135,6 +142,80 @@ Expected<void *> HeapStorage::release() noexcept
 }
 
 
+// The slab allocator is never destroyed, since blocks may be freed by static/thread_local destructors after the
+// allocator would have been destroyed. nullptr is returned only if the allocator allocation failed.
+static SlabAllocator<AlignedHeapBlockPtr> *heap_slab_allocator()
+{
+    static auto allocator = new (std::nothrow) SlabAllocator<AlignedHeapBlockPtr>(SlabAllocatorParams::create_default(),
+        OsUtils::get_page_size(), AlignedHeapBlock::create);
+    return allocator;
+}
+
+Expected<PooledHeapStoragePtr> PooledHeapStorage::create(size_t size)
+{
+    auto allocator = heap_slab_allocator();
+    CHECK_NOT_NULL_AS_EXPECTED(allocator, HAILO_OUT_OF_HOST_MEMORY);
+    TRY(auto block, allocator->allocate(size));
+
+    auto result = make_shared_nothrow<PooledHeapStorage>(std::move(block), size);
+    CHECK_NOT_NULL_AS_EXPECTED(result, HAILO_OUT_OF_HOST_MEMORY);
+
+    return result;
+}
+
+bool PooledHeapStorage::is_pooled_size(size_t size)
+{
+    auto allocator = heap_slab_allocator();
+    return (nullptr != allocator) && allocator->is_pooled_size(size);
+}
+
+SlabAllocatorStats PooledHeapStorage::get_slab_stats()
+{
+    auto allocator = heap_slab_allocator();
+    return (nullptr != allocator) ? allocator->get_stats() : SlabAllocatorStats{};
+}
+
+PooledHeapStorage::PooledHeapStorage(AlignedHeapBlockPtr &&block, size_t size) :
+    m_block(std::move(block)),
+    m_size(size)
+{}
+
+PooledHeapStorage::PooledHeapStorage(PooledHeapStorage &&other) noexcept :
+    BufferStorage(std::move(other)),
+    m_block(std::move(other.m_block)),
+    m_size(std::exchange(other.m_size, 0))
+{}
+
+PooledHeapStorage::~PooledHeapStorage()
+{
+    if (nullptr != m_block) {
+        heap_slab_allocator()->deallocate(std::move(m_block));
+    }
+}
+
+size_t PooledHeapStorage::size() const
+{
+    return m_size;
+}
+
+void *PooledHeapStorage::user_address()
+{
+    return (nullptr != m_block) ? m_block->user_address() : nullptr;
+}
+
+Expected<void *> PooledHeapStorage::release() noexcept
+{
+    CHECK_AS_EXPECTED(nullptr != m_block, HAILO_INVALID_OPERATION, "Storage was already released");
+
+    std::unique_ptr<uint8_t[]> data(new (std::nothrow) uint8_t[m_size]);
+    CHECK_NOT_NULL_AS_EXPECTED(data, HAILO_OUT_OF_HOST_MEMORY);
+    std::memcpy(data.get(), m_block->user_address(), m_size);
+
+    heap_slab_allocator()->deallocate(std::move(m_block));
+    m_size = 0;
+    return static_cast<void *>(data.release());
+}
+
 Expected<DmaStoragePtr> DmaStorage::create(size_t size)
 {
     // TODO: HRT-10283 support sharing low memory buffers for DART and similar systems.
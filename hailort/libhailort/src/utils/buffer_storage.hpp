@@ -17,6 +17,7 @@
 #include "common/shared_memory_buffer.hpp"
 
 #include "utils/exported_resource_manager.hpp"
+#include "utils/slab_allocator.hpp"
 #include "vdma/memory/continuous_buffer.hpp"
 
 #include <memory>
@@ -37,6 +38,7 @@ class VDevice;
 class VdmaDevice;
 class BufferStorage;
 class HeapStorage;
+class PooledHeapStorage;
 class DmaStorage;
 class ContinuousStorage;
 class SharedMemoryStorage;
@@ -121,6 +123,50 @@ private:
     size_t m_size;
 };
 
+using PooledHeapStoragePtr = std::shared_ptr<PooledHeapStorage>;
+
+// Internal buffer flag (not a hailo_buffer_flags_t enumerator, so BufferStorageParams stays ABI compatible) - a heap
+// buffer whose memory is taken from the heap slab allocator. Set by PooledHeapStorage::create_params().
+static const hailo_buffer_flags_t HAILO_BUFFER_FLAGS_POOLED_HEAP = static_cast<hailo_buffer_flags_t>(1 << 30);
+
+/**
+ * Heap storage allocated by the heap slab allocator - when freed, the memory is cached for reuse by following
+ * buffers of the same size class. Used for heap buffers in the slab allocator sizes range, if created with
+ * PooledHeapStorage::create_params().
+ */
+class PooledHeapStorage : public BufferStorage
+{
+public:
+    // Params for short-lived buffers allocated per frame or per message. Inline, so it can be used by the executables
+    // that link libhailort (where the slab allocator itself isn't exported).
+    static BufferStorageParams create_params()
+    {
+        BufferStorageParams params{};
+        params.flags = HAILO_BUFFER_FLAGS_POOLED_HEAP;
+        return params;
+    }
+
+    static Expected<PooledHeapStoragePtr> create(size_t size);
+    static bool is_pooled_size(size_t size);
+    static SlabAllocatorStats get_slab_stats();
+
+    PooledHeapStorage(AlignedHeapBlockPtr &&block, size_t size);
+    PooledHeapStorage(PooledHeapStorage &&other) noexcept;
+    PooledHeapStorage(const PooledHeapStorage &) = delete;
+    PooledHeapStorage &operator=(PooledHeapStorage &&) = delete;
+    PooledHeapStorage &operator=(const PooledHeapStorage &) = delete;
+    virtual ~PooledHeapStorage();
+
+    virtual size_t size() const override;
+    virtual void *user_address() override;
+    // The block is owned by the slab allocator, so the data is copied to a new heap allocation (freed with `delete`)
+    virtual Expected<void *> release() noexcept override;
+
+private:
+    AlignedHeapBlockPtr m_block;
+    size_t m_size;
+};
+
 using DmaStoragePtr = std::shared_ptr<DmaStorage>;
 
 /**
@@ -130,6 +176,8 @@ class DmaStorage : public BufferStorage
 {
 public:
     // Creates a DmaStorage instance holding a dma-able buffer size bytes large.
+    // Not pooled - the dma-able buffers are shared mappings (to allow python fork), so after a fork a cache of them
+    // would be shared by both processes.
     static Expected<DmaStoragePtr> create(size_t size);
 
     DmaStorage(const DmaStorage &other) = delete;
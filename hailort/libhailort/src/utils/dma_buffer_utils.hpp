@@ -24,6 +24,16 @@ class HAILORTAPI DmaBufferUtils
 public:
     static Expected<MemoryView> mmap_dma_buffer(hailo_dma_buffer_t dma_buffer, BufferProtection dma_buffer_protection);
     static hailo_status munmap_dma_buffer(hailo_dma_buffer_t dma_buffer, MemoryView dma_buffer_memview, BufferProtection dma_buffer_protection);
+
+    // Same as mmap_dma_buffer/munmap_dma_buffer, but the CPU mapping is kept in an LRU cache keyed by the dma-buf
+    // identity, so buffers that are recycled (e.g. a camera ring) only pay for the DMA_BUF_IOCTL_SYNC calls per frame.
+    // An idle cached mapping is dropped on the next cache miss after the fd it was last used with is closed (or right
+    // away by invalidate_cached_mappings).
+    static Expected<MemoryView> mmap_dma_buffer_cached(hailo_dma_buffer_t dma_buffer, BufferProtection dma_buffer_protection);
+    static hailo_status munmap_dma_buffer_cached(hailo_dma_buffer_t dma_buffer, MemoryView dma_buffer_memview,
+        BufferProtection dma_buffer_protection);
+    // Drops the cached CPU mappings of the dma-buf (mappings still in use are released once they are returned)
+    static void invalidate_cached_mappings(int dmabuf_fd);
 };
 
 } /* namespace hailort */
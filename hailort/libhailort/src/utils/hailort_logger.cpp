@@ -9,10 +9,12 @@
 
 #include "common/utils.hpp"
 #include "common/filesystem.hpp"
+#include "common/string_utils.hpp"
 #include "common/internal_env_vars.hpp"
 #include "common/env_vars.hpp"
 
 #include "utils/hailort_logger.hpp"
+#include "utils/async_log_sink.hpp"
 
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/rotating_file_sink.h>
@@ -48,6 +50,7 @@ namespace hailort
 #define HAILORT_ANDROID_LOGGER_PATTERN ("%v")               // Android logger will print only message (additional info are built-in)
 
 #define PERIODIC_FLUSH_INTERVAL_IN_SECONDS (5)
+#define DEFAULT_FILE_SINKS_QUEUE_SIZE (8192)
 
 
 std::string HailoRTLogger::parse_log_path(const char *log_path)
@@ -193,8 +196,24 @@ HailoRTLogger::HailoRTLogger(spdlog::level::level_enum console_level, spdlog::le
 #endif
 
     m_console_sink->set_pattern(HAILORT_CONSOLE_LOGGER_PATTERN);
-    spdlog::sinks_init_list sink_list = { m_console_sink, m_main_log_file_sink, m_local_log_file_sink };
-    m_hailort_logger = make_shared_nothrow<spdlog::logger>(HAILORT_NAME, sink_list.begin(), sink_list.end());
+
+    // The console stays synchronous, so warnings and errors are printed before the failing call returns
+    std::vector<spdlog::sink_ptr> sinks = { m_console_sink };
+    const auto queue_size = get_file_sinks_queue_size();
+    if (0 != queue_size) {
+        m_async_file_sink = make_shared_nothrow<AsyncLogSink>(
+            std::vector<spdlog::sink_ptr>{ m_main_log_file_sink, m_local_log_file_sink }, queue_size);
+        if (nullptr == m_async_file_sink) {
+            std::cerr << "HailoRT warning: Allocating async log sink has failed, writing the log files synchronously" << std::endl;
+        }
+    }
+    if (nullptr != m_async_file_sink) {
+        sinks.push_back(m_async_file_sink);
+    } else {
+        sinks.push_back(m_main_log_file_sink);
+        sinks.push_back(m_local_log_file_sink);
+    }
+    m_hailort_logger = make_shared_nothrow<spdlog::logger>(HAILORT_NAME, sinks.begin(), sinks.end());
     if (nullptr == m_hailort_logger) {
         std::cerr << "Allocating memory on heap for HailoRT logger has failed! Please check if this host has enough memory. Writing to log will result in a SEGFAULT!" << std::endl;
         return;
@@ -210,6 +229,9 @@ void HailoRTLogger::set_levels(spdlog::level::level_enum console_level, spdlog::
     m_console_sink->set_level(console_level);
     m_main_log_file_sink->set_level(file_level);
     m_local_log_file_sink->set_level(file_level);
+    if (nullptr != m_async_file_sink) {
+        m_async_file_sink->set_level(file_level);
+    }
 
     if (is_env_variable_on(HAILORT_LOGGER_FLUSH_EVERY_PRINT_ENV_VAR)) {
         m_hailort_logger->flush_on(spdlog::level::trace);
@@ -220,6 +242,27 @@ void HailoRTLogger::set_levels(spdlog::level::level_enum console_level, spdlog::
     spdlog::flush_every(std::chrono::seconds(PERIODIC_FLUSH_INTERVAL_IN_SECONDS));
 }
 
+size_t HailoRTLogger::get_file_sinks_queue_size()
+{
+    // Flushing on every print is used for debugging crashes, so the messages must be written before the print returns
+    if (is_env_variable_on(HAILORT_LOGGER_FLUSH_EVERY_PRINT_ENV_VAR)) {
+        return 0;
+    }
+
+    auto queue_size_str = get_env_variable(HAILORT_LOGGER_QUEUE_SIZE_ENV_VAR);
+    if (!queue_size_str) {
+        return DEFAULT_FILE_SINKS_QUEUE_SIZE;
+    }
+
+    auto queue_size = StringUtils::to_uint32(queue_size_str.value(), 10);
+    if (!queue_size) {
+        std::cerr << "HailoRT warning: Invalid " << HAILORT_LOGGER_QUEUE_SIZE_ENV_VAR << " value " <<
+            queue_size_str.value() << ", using the default" << std::endl;
+        return DEFAULT_FILE_SINKS_QUEUE_SIZE;
+    }
+    return queue_size.value();
+}
+
 Expected<spdlog::level::level_enum> HailoRTLogger::get_console_logger_level_from_string(const std::string &user_console_logger_level)
 {
     static const std::unordered_map<std::string, spdlog::level::level_enum> log_level_map = {
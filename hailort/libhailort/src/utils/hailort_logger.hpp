@@ -69,6 +69,7 @@ private:
     static std::string parse_log_path(const char *log_path);
     void set_levels(spdlog::level::level_enum console_level, spdlog::level::level_enum file_level, spdlog::level::level_enum flush_level);
     static Expected<spdlog::level::level_enum> get_console_logger_level_from_string(const std::string &user_console_logger_level);
+    static size_t get_file_sinks_queue_size();
 
     std::shared_ptr<spdlog::sinks::sink> m_console_sink;
 
@@ -76,6 +77,8 @@ private:
     // The local log will be written to the local directory or to the path the user has chosen (via $HAILORT_LOGGER_PATH)
     std::shared_ptr<spdlog::sinks::sink> m_main_log_file_sink;
     std::shared_ptr<spdlog::sinks::sink> m_local_log_file_sink;
+    // Writes to the file sinks from a background thread. nullptr if the files are written synchronously.
+    std::shared_ptr<spdlog::sinks::sink> m_async_file_sink;
     std::shared_ptr<spdlog::logger> m_hailort_logger;
 };
 
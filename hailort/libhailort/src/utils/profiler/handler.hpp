@@ -246,6 +246,20 @@ struct DumpProfilerStateTrace : Trace
     DumpProfilerStateTrace() : Trace("dump_profiler_state") {}
 };
 
+struct CompletionExecutorStatsTrace : Trace
+{
+    CompletionExecutorStatsTrace(const device_id_t &device_id, size_t queue_depth, size_t max_queue_depth,
+        uint64_t executed_count)
+        : Trace("completion_executor_stats"), device_id(device_id), queue_depth(queue_depth),
+          max_queue_depth(max_queue_depth), executed_count(executed_count)
+    {}
+
+    device_id_t device_id;
+    size_t queue_depth;
+    size_t max_queue_depth;
+    uint64_t executed_count;
+};
+
 class Handler
 {
 public:
@@ -271,6 +285,7 @@ public:
     virtual void handle_trace(const DumpProfilerStateTrace&) {};
     virtual void handle_trace(const InitProfilerProtoTrace&) {};
     virtual void handle_trace(const HefLoadedTrace&) {};
+    virtual void handle_trace(const CompletionExecutorStatsTrace&) {};
     virtual bool should_dump_trace_file() { return false; }
     virtual bool should_stop () { return false; }
     virtual hailo_status dump_trace_file() { return HAILO_SUCCESS; }
@@ -127,6 +127,17 @@ void SchedulerProfilerHandler::handle_trace(const HefLoadedTrace &trace)
     added_trace->mutable_loaded_hef()->set_time_stamp(trace.timestamp);
 }
 
+void SchedulerProfilerHandler::handle_trace(const CompletionExecutorStatsTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_proto_lock);
+    auto added_trace = m_profiler_trace_proto.add_added_trace();
+    added_trace->mutable_completion_executor_stats()->set_time_stamp(trace.timestamp);
+    added_trace->mutable_completion_executor_stats()->set_device_id(trace.device_id);
+    added_trace->mutable_completion_executor_stats()->set_queue_depth(trace.queue_depth);
+    added_trace->mutable_completion_executor_stats()->set_max_queue_depth(trace.max_queue_depth);
+    added_trace->mutable_completion_executor_stats()->set_executed_count(trace.executed_count);
+}
+
 void SchedulerProfilerHandler::handle_trace(const AddCoreOpTrace &trace)
 {
     std::lock_guard<std::mutex> lock(m_proto_lock);
@@ -57,6 +57,7 @@ public:
     virtual void handle_trace(const DumpProfilerStateTrace&) override;
     virtual void handle_trace(const InitProfilerProtoTrace&) override;
     virtual void handle_trace(const HefLoadedTrace&) override;
+    virtual void handle_trace(const CompletionExecutorStatsTrace&) override;
     virtual bool should_dump_trace_file() override;
     virtual bool should_stop () override { return m_file_already_dumped; }
     virtual hailo_status dump_trace_file() override { return serialize_and_dump_proto(); };
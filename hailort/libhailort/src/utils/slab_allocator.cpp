@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file slab_allocator.cpp
+ * @brief Size-class allocator caching freed memory blocks for reuse
+ **/
+
+#include "slab_allocator.hpp"
+#include "common/env_vars.hpp"
+#include "common/string_utils.hpp"
+#include "common/os_utils.hpp"
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#else
+#include <stdlib.h>
+#endif
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace hailort
+{
+
+static const size_t DEFAULT_SLAB_MAX_SIZE = 64 * 1024 * 1024;
+static const size_t DEFAULT_SLAB_MAX_CACHED_MB = 64;
+static const size_t DEFAULT_SLAB_THREAD_CACHE_BLOCKS = 4;
+static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+static size_t get_max_cached_bytes()
+{
+    auto env_var = get_env_variable(HAILO_BUFFER_SLAB_MAX_CACHED_MB_ENV_VAR);
+    if (!env_var) {
+        return DEFAULT_SLAB_MAX_CACHED_MB * 1024 * 1024;
+    }
+
+    auto max_cached_mb = StringUtils::to_uint32(env_var.value(), 10);
+    if (!max_cached_mb) {
+        LOGGER__WARNING("Invalid {} value '{}', using {}MB", HAILO_BUFFER_SLAB_MAX_CACHED_MB_ENV_VAR, env_var.value(),
+            DEFAULT_SLAB_MAX_CACHED_MB);
+        return DEFAULT_SLAB_MAX_CACHED_MB * 1024 * 1024;
+    }
+
+    return static_cast<size_t>(max_cached_mb.value()) * 1024 * 1024;
+}
+
+SlabAllocatorParams SlabAllocatorParams::create_default()
+{
+    SlabAllocatorParams params{};
+    params.min_size = OsUtils::get_page_size();
+    params.max_size = DEFAULT_SLAB_MAX_SIZE;
+    params.max_cached_bytes = get_max_cached_bytes();
+    params.thread_cache_blocks = DEFAULT_SLAB_THREAD_CACHE_BLOCKS;
+    return params;
+}
+
+SlabSizeClasses::SlabSizeClasses(size_t page_size, size_t max_size)
+{
+    // 1, 2, 3, 4 pages, then 4 classes per doubling - 5, 6, 7, 8 pages, 10, 12, 14, 16 pages, ...
+    const size_t STEPS_PER_DOUBLING = 4;
+    for (size_t pages = 1; pages <= STEPS_PER_DOUBLING; pages++) {
+        m_sizes.push_back(pages * page_size);
+    }
+    for (size_t base = STEPS_PER_DOUBLING * page_size; m_sizes.back() < max_size; base *= 2) {
+        for (size_t step = 1; step <= STEPS_PER_DOUBLING; step++) {
+            m_sizes.push_back(base + ((base / STEPS_PER_DOUBLING) * step));
+        }
+    }
+}
+
+static bool is_huge_pages_enabled()
+{
+    static const bool huge_pages_enabled = is_env_variable_on(HAILO_BUFFER_SLAB_HUGE_PAGES_ENV_VAR,
+        HAILO_BUFFER_SLAB_HUGE_PAGES_ENV_VAR_VALUE);
+    return huge_pages_enabled;
+}
+
+Expected<std::unique_ptr<AlignedHeapBlock>> AlignedHeapBlock::create(size_t size)
+{
+    CHECK_AS_EXPECTED(0 != size, HAILO_INVALID_ARGUMENT);
+
+    const bool use_huge_pages = is_huge_pages_enabled() && (size >= HUGE_PAGE_SIZE);
+    const auto alignment = use_huge_pages ? HUGE_PAGE_SIZE : OsUtils::get_page_size();
+
+#if defined(_MSC_VER)
+    void *address = _aligned_malloc(size, alignment);
+#else
+    void *address = nullptr;
+    if (0 != posix_memalign(&address, alignment, size)) {
+        address = nullptr;
+    }
+#endif
+    CHECK_NOT_NULL_AS_EXPECTED(address, HAILO_OUT_OF_HOST_MEMORY);
+
+#if defined(__linux__)
+    if (use_huge_pages && (0 != madvise(address, size, MADV_HUGEPAGE))) {
+        // Not fatal, the block is just backed by regular pages
+        LOGGER__DEBUG("madvise(MADV_HUGEPAGE) failed with errno {}", errno);
+    }
+#endif
+
+    auto block = make_unique_nothrow<AlignedHeapBlock>(address, size);
+    if (nullptr == block) {
+        LOGGER__ERROR("Failed allocating AlignedHeapBlock");
+#if defined(_MSC_VER)
+        _aligned_free(address);
+#else
+        free(address);
+#endif
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    return block;
+}
+
+AlignedHeapBlock::AlignedHeapBlock(void *address, size_t size) :
+    m_address(address),
+    m_size(size)
+{}
+
+AlignedHeapBlock::~AlignedHeapBlock()
+{
+#if defined(_MSC_VER)
+    _aligned_free(m_address);
+#else
+    free(m_address);
+#endif
+}
+
+} /* namespace hailort */
@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file slab_allocator.hpp
+ * @brief Size-class allocator caching freed memory blocks for reuse, used as the backing of short-lived Buffers.
+ *
+ * Requested sizes are rounded up to page-multiple size classes (4 classes per size doubling). Freed blocks are
+ * cached per class - first in a small per-thread cache (no locking), then in a central cache shared by all threads.
+ * The total size of the cached blocks is capped (see HAILO_BUFFER_SLAB_MAX_CACHED_MB_ENV_VAR), blocks freed above
+ * the cap are returned to the system.
+ **/
+
+#ifndef _HAILO_SLAB_ALLOCATOR_HPP_
+#define _HAILO_SLAB_ALLOCATOR_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include "common/utils.hpp"
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <functional>
+
+
+namespace hailort
+{
+
+struct SlabAllocatorStats {
+    // Allocations served from a cached block
+    uint64_t hits;
+    // Allocations that allocated a new block from the system
+    uint64_t misses;
+    // Allocations out of the size classes range (not counted as hits/misses)
+    uint64_t unpooled;
+    // Total size of the cached (free) blocks held by the allocator
+    size_t cached_bytes;
+    // Total size of the blocks currently given to the users
+    size_t in_use_bytes;
+};
+
+struct SlabAllocatorParams {
+    // Sizes in [min_size, max_size] are rounded up to a size class (at least one page) and pooled
+    size_t min_size;
+    size_t max_size;
+    // Upper bound on cached_bytes. 0 disables caching (every block is returned to the system when freed)
+    size_t max_cached_bytes;
+    // Max blocks cached per size class in each thread cache
+    size_t thread_cache_blocks;
+
+    // Reads the params from the env vars (or the defaults). min_size defaults to the page size.
+    static SlabAllocatorParams create_default();
+};
+
+// Page-multiple size classes, 4 classes per doubling of the size. The largest class is at least max_size.
+class SlabSizeClasses final {
+public:
+    SlabSizeClasses(size_t page_size, size_t max_size);
+
+    size_t count() const { return m_sizes.size(); }
+    size_t min_class_size() const { return m_sizes.front(); }
+    size_t max_class_size() const { return m_sizes.back(); }
+    size_t class_size(size_t class_index) const { return m_sizes[class_index]; }
+    // Index of the smallest class that can hold size. Must be called with size <= max class size.
+    size_t class_index(size_t size) const
+    {
+        auto it = std::lower_bound(m_sizes.begin(), m_sizes.end(), size);
+        assert(it != m_sizes.end());
+        return static_cast<size_t>(std::distance(m_sizes.begin(), it));
+    }
+
+private:
+    std::vector<size_t> m_sizes;
+};
+
+/**
+ * Block is a movable owning handle to a memory block (unique_ptr/shared_ptr like), exposing block->size().
+ * There must be a single SlabAllocator per Block type, since the thread caches are per Block type. The allocator
+ * must outlive all threads and blocks (allocators are never destroyed).
+ */
+template<typename Block>
+class SlabAllocator final {
+public:
+    // Allocates a new block, block_size bytes large.
+    using AllocateBlockFunc = std::function<Expected<Block>(size_t block_size)>;
+
+    SlabAllocator(const SlabAllocatorParams &params, size_t page_size, AllocateBlockFunc allocate_block) :
+        m_params(params),
+        m_size_classes(page_size, params.max_size),
+        m_allocate_block(allocate_block),
+        m_central_cache(m_size_classes.count()),
+        m_hits(0),
+        m_misses(0),
+        m_unpooled(0),
+        m_cached_bytes(0),
+        m_in_use_bytes(0)
+    {}
+
+    SlabAllocator(const SlabAllocator &) = delete;
+    SlabAllocator &operator=(const SlabAllocator &) = delete;
+    SlabAllocator(SlabAllocator &&) = delete;
+    SlabAllocator &operator=(SlabAllocator &&) = delete;
+
+    bool is_pooled_size(size_t size) const
+    {
+        return (size >= m_params.min_size) && (size <= m_size_classes.max_class_size());
+    }
+
+    // Returns a block at least size bytes large. The block must be returned with deallocate.
+    // Sizes out of the pooled range are allocated with their exact size.
+    Expected<Block> allocate(size_t size)
+    {
+        if (!is_pooled_size(size)) {
+            m_unpooled++;
+            return m_allocate_block(size);
+        }
+
+        const auto class_index = m_size_classes.class_index(size);
+        const auto block_size = m_size_classes.class_size(class_index);
+
+        auto thread_cache = get_thread_cache();
+        if ((nullptr != thread_cache) && !thread_cache->blocks[class_index].empty()) {
+            auto &blocks = thread_cache->blocks[class_index];
+            auto block = std::move(blocks.back());
+            blocks.pop_back();
+            on_cached_block_used(block_size);
+            return block;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_central_cache_mutex);
+            auto &central_cache = m_central_cache[class_index];
+            if (!central_cache.empty()) {
+                auto block = std::move(central_cache.back());
+                central_cache.pop_back();
+                on_cached_block_used(block_size);
+                return block;
+            }
+        }
+
+        TRY(auto block, m_allocate_block(block_size));
+        m_misses++;
+        m_in_use_bytes += block_size;
+        return block;
+    }
+
+    void deallocate(Block &&block)
+    {
+        const auto block_size = block->size();
+        if (!is_pooled_size(block_size)) {
+            // Unpooled block, just free it
+            return;
+        }
+
+        const auto class_index = m_size_classes.class_index(block_size);
+        assert(m_size_classes.class_size(class_index) == block_size);
+        m_in_use_bytes -= block_size;
+
+        // Reserve the block size in the cache, freeing the block if the cache is full
+        auto cached_bytes = m_cached_bytes.load();
+        do {
+            if ((cached_bytes + block_size) > m_params.max_cached_bytes) {
+                return;
+            }
+        } while (!m_cached_bytes.compare_exchange_weak(cached_bytes, cached_bytes + block_size));
+
+        auto thread_cache = get_thread_cache();
+        if ((nullptr != thread_cache) && (thread_cache->blocks[class_index].size() < m_params.thread_cache_blocks)) {
+            thread_cache->blocks[class_index].emplace_back(std::move(block));
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_central_cache_mutex);
+        m_central_cache[class_index].emplace_back(std::move(block));
+    }
+
+    SlabAllocatorStats get_stats() const
+    {
+        SlabAllocatorStats stats{};
+        stats.hits = m_hits.load();
+        stats.misses = m_misses.load();
+        stats.unpooled = m_unpooled.load();
+        stats.cached_bytes = m_cached_bytes.load();
+        stats.in_use_bytes = m_in_use_bytes.load();
+        return stats;
+    }
+
+private:
+    struct ThreadCache {
+        ThreadCache(SlabAllocator &allocator_arg, bool &destroyed_arg) :
+            allocator(allocator_arg),
+            destroyed(destroyed_arg),
+            blocks(allocator_arg.m_size_classes.count())
+        {}
+
+        // On thread exit, the cached blocks move to the central cache (they are already counted in cached_bytes)
+        ~ThreadCache()
+        {
+            destroyed = true;
+            std::lock_guard<std::mutex> lock(allocator.m_central_cache_mutex);
+            for (size_t class_index = 0; class_index < blocks.size(); class_index++) {
+                for (auto &block : blocks[class_index]) {
+                    allocator.m_central_cache[class_index].emplace_back(std::move(block));
+                }
+            }
+        }
+
+        SlabAllocator &allocator;
+        bool &destroyed;
+        std::vector<std::vector<Block>> blocks;
+    };
+
+    // Returns nullptr if the thread cache was already destroyed (Blocks freed by other thread_local destructors).
+    ThreadCache *get_thread_cache()
+    {
+        // Trivially destructible, so it stays valid after the thread cache is destroyed
+        thread_local bool thread_cache_destroyed = false;
+        if (thread_cache_destroyed) {
+            return nullptr;
+        }
+        thread_local ThreadCache thread_cache(*this, thread_cache_destroyed);
+        assert(&thread_cache.allocator == this);
+        return &thread_cache;
+    }
+
+    void on_cached_block_used(size_t block_size)
+    {
+        m_hits++;
+        m_cached_bytes -= block_size;
+        m_in_use_bytes += block_size;
+    }
+
+    const SlabAllocatorParams m_params;
+    const SlabSizeClasses m_size_classes;
+    AllocateBlockFunc m_allocate_block;
+
+    std::mutex m_central_cache_mutex;
+    std::vector<std::vector<Block>> m_central_cache;
+
+    std::atomic<uint64_t> m_hits;
+    std::atomic<uint64_t> m_misses;
+    std::atomic<uint64_t> m_unpooled;
+    std::atomic<size_t> m_cached_bytes;
+    std::atomic<size_t> m_in_use_bytes;
+};
+
+/**
+ * Page aligned heap memory block, used as the Block of the heap storage slab allocator.
+ * If huge pages are enabled (HAILO_BUFFER_SLAB_HUGE_PAGES_ENV_VAR), large blocks are aligned to the huge page size
+ * and advised to be backed by huge pages (linux only).
+ */
+class AlignedHeapBlock final {
+public:
+    static Expected<std::unique_ptr<AlignedHeapBlock>> create(size_t size);
+
+    AlignedHeapBlock(void *address, size_t size);
+    ~AlignedHeapBlock();
+    AlignedHeapBlock(const AlignedHeapBlock &) = delete;
+    AlignedHeapBlock &operator=(const AlignedHeapBlock &) = delete;
+    AlignedHeapBlock(AlignedHeapBlock &&) = delete;
+    AlignedHeapBlock &operator=(AlignedHeapBlock &&) = delete;
+
+    void *user_address() { return m_address; }
+    size_t size() const { return m_size; }
+
+private:
+    void *m_address;
+    const size_t m_size;
+};
+
+using AlignedHeapBlockPtr = std::unique_ptr<AlignedHeapBlock>;
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SLAB_ALLOCATOR_HPP_ */
@@ -11,64 +11,71 @@
 namespace hailort
 {
 
-TransferDoneCallback CallbackReorderQueue::wrap_callback(const TransferDoneCallback &original)
+Expected<TransferDoneCallback> CallbackReorderQueue::wrap_callback(const TransferDoneCallback &original)
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    const uint64_t current_callback_index = m_registered_callbacks++;
+    std::lock_guard<std::mutex> lock_guard(m_register_mutex);
+    const uint64_t current_callback_index = m_registered_callbacks;
 
-    return [this, original, current_callback_index](hailo_status status) {
-        // Push callback without calling it yet.
-        push_callback(std::make_pair(current_callback_index, [original, status]() {
-            return original(status);
-        }));
+    // The slot is free once the callback that used it before was called (acquire, so its release is visible here).
+    if ((current_callback_index - m_called_callbacks.load(std::memory_order_acquire)) >= m_slots.size()) {
+        return make_unexpected(HAILO_QUEUE_IS_FULL);
+    }
+
+    m_slots[current_callback_index % m_slots.size()].callback = original;
+    m_registered_callbacks++;
 
-        // Then, call the queued callbacks in order (if there is ready callback).
-        call_queued_callbacks_in_order();
-    };
+    return TransferDoneCallback([this, current_callback_index](hailo_status status) {
+        on_callback_done(current_callback_index, status);
+    });
 }
 
 void CallbackReorderQueue::cancel_last_callback()
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    assert(m_called_callbacks < m_registered_callbacks);
+    std::lock_guard<std::mutex> lock_guard(m_register_mutex);
+    assert(m_called_callbacks.load() < m_registered_callbacks);
     m_registered_callbacks--;
+    m_slots[m_registered_callbacks % m_slots.size()].callback = nullptr;
 }
 
-void CallbackReorderQueue::push_callback(const Callback &callback)
-{
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    assert(m_callbacks_queue.size() < m_max_size);
-    m_callbacks_queue.push(callback);
-}
-
-void CallbackReorderQueue::call_queued_callbacks_in_order()
+void CallbackReorderQueue::on_callback_done(uint64_t callback_index, hailo_status status)
 {
-    // Allow only one thread to execute the callbacks.
-    std::lock_guard<std::mutex> callbacks_lock(m_callbacks_mutex);
+    // Mark the callback as ready without calling it yet.
+    auto &slot = m_slots[callback_index % m_slots.size()];
+    slot.status = status;
+    slot.is_ready.store(true);
 
-    while (auto callback = pop_ready_callback()) {
-        callback->second();
-    }
+    // Then, call the ready callbacks in order (if the next expected callback is ready).
+    call_ready_callbacks_in_order();
 }
 
-Expected<CallbackReorderQueue::Callback> CallbackReorderQueue::pop_ready_callback()
+void CallbackReorderQueue::call_ready_callbacks_in_order()
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
+    // Allow only one thread to execute the callbacks. A thread that finds another one draining leaves its callback to
+    // it - the draining thread checks the next slot again after it stops draining, so a callback that became ready
+    // meanwhile isn't left behind (all the accesses to is_ready/m_is_draining here are sequentially consistent).
+    while (!m_is_draining.exchange(true)) {
+        uint64_t next_callback_index = m_called_callbacks.load(std::memory_order_relaxed);
+        while (true) {
+            auto &slot = m_slots[next_callback_index % m_slots.size()];
+            if (!slot.is_ready.load()) {
+                break;
+            }
 
-    if (m_callbacks_queue.empty()) {
-        return make_unexpected(HAILO_NOT_AVAILABLE);
-    }
+            // The slot is released before the callback is called, so the callback may wrap new callbacks.
+            auto callback = std::move(slot.callback);
+            slot.callback = nullptr;
+            const auto status = slot.status;
+            slot.is_ready.store(false, std::memory_order_relaxed);
+            m_called_callbacks.store(++next_callback_index, std::memory_order_release);
 
-    if (m_callbacks_queue.top().first != m_called_callbacks) {
-        // We need to wait until top() contains callback with index - m_called_callbacks.
-        return make_unexpected(HAILO_NOT_AVAILABLE);
-    }
+            callback(status);
+        }
 
-    auto next_callback = m_callbacks_queue.top();
-    m_callbacks_queue.pop();
-
-    m_called_callbacks++;
-    return next_callback;
+        m_is_draining.store(false);
+        if (!m_slots[next_callback_index % m_slots.size()].is_ready.load()) {
+            return;
+        }
+    }
 }
 
 } /* namespace hailort */
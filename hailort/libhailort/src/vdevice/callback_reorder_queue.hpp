@@ -14,21 +14,24 @@
 
 #include "vdma/channel/transfer_common.hpp"
 
+#include <atomic>
 #include <mutex>
-#include <queue>
+#include <vector>
 
 namespace hailort
 {
 
 class CallbackReorderQueue final {
 public:
+    // The queue holds 2 * max_size callbacks - up to max_size transfers are ongoing, and up to max_size more may be
+    // done while waiting for an earlier one.
     CallbackReorderQueue(size_t max_size) :
-        m_max_size(max_size),
-        m_callbacks_queue(compare_callbacks{}, make_queue_storage(m_max_size))
+        m_slots(max_size * 2)
     {}
 
     // Wraps the given original callback so it will be called in the same wrap_callback order.
-    TransferDoneCallback wrap_callback(const TransferDoneCallback &original);
+    // Returns HAILO_QUEUE_IS_FULL if there is no free slot for the callback.
+    Expected<TransferDoneCallback> wrap_callback(const TransferDoneCallback &original);
 
     // If some wrapped callback wasn't registered to some async API (for example because the queue is full), we need to
     // remove the counters we added in `wrap_callback` (otherwise, next callback will wait forever).
@@ -38,52 +41,32 @@ public:
     void cancel_last_callback();
 
 private:
-    // must be called with m_lock held
-    void call_queued_callbacks_in_order();
-
-    // Each callback has a function pointer and its index
-    using Callback = std::pair<uint64_t, std::function<void()>>;
-
-    void push_callback(const Callback &callback);
-
-    // Pop next callback ready to be called. Can return HAILO_NOT_AVAILABLE if there is no callback ready.
-    Expected<Callback> pop_ready_callback();
+    // The callback of index i is kept in slot i % slots count, until it is called.
+    struct Slot {
+        TransferDoneCallback callback;
+        hailo_status status = HAILO_UNINITIALIZED;
+        // Set once the wrapped callback was called, cleared just before the original callback is called
+        std::atomic<bool> is_ready{false};
+    };
 
-    // We don't want to have any memory allocations in runtime, so we init the priority queue with a reserved vector.
-    static std::vector<Callback> make_queue_storage(size_t max_size)
-    {
-        std::vector<Callback> storage;
-        storage.reserve(max_size);
-        return storage;
-    }
+    void on_callback_done(uint64_t callback_index, hailo_status status);
+    void call_ready_callbacks_in_order();
 
-    const size_t m_max_size;
+    std::vector<Slot> m_slots;
 
-    // Guards access to m_callbacks_queue and the counters.
-    std::mutex m_queue_mutex;
+    // Guards the registration of the callbacks (wrap_callback and cancel_last_callback), the completions don't take it.
+    std::mutex m_register_mutex;
 
     // Increasing counter for the index on next register callback. We don't worry about overflow (Even if we assume
     // extreme value of 1,000,000 per second)
     uint64_t m_registered_callbacks = 0;
 
     // Amount of callback that have called. Because the callbacks are called in order, this counter contains the index
-    // of the next callback expected to be executed.
-    uint64_t m_called_callbacks = 0;
-
-    struct compare_callbacks {
-        bool operator()(const Callback &a, const Callback &b)
-        {
-            // We want to pop the lower index first
-            return a.first > b.first;
-        }
-    };
-
-    // Callbacks are stored inside a priority_queue data-structure.
-    // The queue is sorted by the callbacks index (so we pop the callbacks with the smallest index first).
-    std::priority_queue<Callback, std::vector<Callback>, compare_callbacks> m_callbacks_queue;
+    // of the next callback expected to be executed. Only the draining thread advances it.
+    std::atomic<uint64_t> m_called_callbacks{0};
 
-    // This lock guarantee that only one thread is executing the callbacks.
-    std::mutex m_callbacks_mutex;
+    // Guarantees that only one thread is executing the callbacks.
+    std::atomic<bool> m_is_draining{false};
 };
 
 } /* namespace hailort */
@@ -17,10 +17,13 @@ InferRequestAccumulator::InferRequestAccumulator(size_t streams_count, size_t ma
         m_max_queue_size(max_queue_size),
         m_frame_accumulated(frame_accumulated),
         m_shutdown(false),
-        m_ongoing_infer_requests(0)
+        m_ongoing_infer_requests(0),
+        m_partial_infer_requests(max_queue_size, PartialInferRequest(streams_count)),
+        m_partial_infer_requests_head(0),
+        m_partial_infer_requests_count(0)
 {}
 
-hailo_status InferRequestAccumulator::add_transfer_request(const std::string &stream_name, TransferRequest &&request)
+hailo_status InferRequestAccumulator::add_transfer_request(stream_index_t stream_index, TransferRequest &&request)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
@@ -29,18 +32,20 @@ hailo_status InferRequestAccumulator::add_transfer_request(const std::string &st
     }
 
     // Insert the transfer to next available infer request
-    auto infer_request = get_infer_request(stream_name);
+    CHECK(stream_index < m_streams_count, HAILO_INTERNAL_FAILURE, "Invalid stream index {}", stream_index);
+    auto infer_request = get_infer_request(stream_index);
     if (!infer_request) {
         return infer_request.status();
     }
-    infer_request->get().emplace(stream_name, std::move(request));
+    infer_request->get().emplace(stream_index, std::move(request));
 
     // If first infer request was finished, call m_frame_accumulated on it
-    if (m_partial_infer_requests.front().size() == m_streams_count) {
+    auto &first_infer_request = m_partial_infer_requests[m_partial_infer_requests_head];
+    if (first_infer_request.size() == m_streams_count) {
 
         m_ongoing_infer_requests++;
         m_frame_accumulated(InferRequest{
-            std::move(m_partial_infer_requests.front()),
+            std::move(first_infer_request),
             [this](hailo_status) {
                 {
                     std::lock_guard<std::mutex> lock(m_mutex);
@@ -49,7 +54,10 @@ hailo_status InferRequestAccumulator::add_transfer_request(const std::string &st
                 m_cv.notify_all();
             }
         });
-        m_partial_infer_requests.pop_front();
+        // The entry was moved from, so it's reset before it's reused
+        first_infer_request = PartialInferRequest(m_streams_count);
+        m_partial_infer_requests_head = (m_partial_infer_requests_head + 1) % m_max_queue_size;
+        m_partial_infer_requests_count--;
     }
 
     return HAILO_SUCCESS;
@@ -67,33 +75,39 @@ hailo_status InferRequestAccumulator::shutdown(std::chrono::milliseconds timeout
     CHECK(done, HAILO_TIMEOUT, "Failed shutdown, ongoing infer requests - {}", m_ongoing_infer_requests);
 
     // Now cancel all partial request
-    for (auto &partial_request : m_partial_infer_requests) {
-        for (auto &stream_transfer_request : partial_request) {
-            stream_transfer_request.second.callback(HAILO_STREAM_ABORT);
-        }
+    for (size_t i = 0; i < m_partial_infer_requests_count; i++) {
+        auto &partial_request = m_partial_infer_requests[(m_partial_infer_requests_head + i) % m_max_queue_size];
+        partial_request.for_each([](stream_index_t, TransferRequest &stream_transfer_request) {
+            stream_transfer_request.callback(HAILO_STREAM_ABORT);
+        });
+        partial_request.clear();
     }
-    m_partial_infer_requests.clear();
+    m_partial_infer_requests_head = 0;
+    m_partial_infer_requests_count = 0;
 
     return HAILO_SUCCESS;
 }
 
 ExpectedRef<InferRequestAccumulator::PartialInferRequest> InferRequestAccumulator::get_infer_request(
-    const std::string &stream_name)
+    stream_index_t stream_index)
 {
-    // Try find infer request that doesn't contain transfer for stream name.
-    for (auto &partial_infer_request : m_partial_infer_requests) {
-        if (!contains(partial_infer_request, stream_name)) {
+    // Try find infer request that doesn't contain transfer for the stream.
+    for (size_t i = 0; i < m_partial_infer_requests_count; i++) {
+        auto &partial_infer_request = m_partial_infer_requests[(m_partial_infer_requests_head + i) % m_max_queue_size];
+        if (!partial_infer_request.contains(stream_index)) {
             return std::ref(partial_infer_request);
         }
     }
 
-    // Create new infer request (only if there is place in the queue)
-    if (m_partial_infer_requests.size() >= m_max_queue_size) {
+    // Start new infer request (only if there is place in the queue)
+    if (m_partial_infer_requests_count >= m_max_queue_size) {
         return make_unexpected(HAILO_QUEUE_IS_FULL);
     }
 
-    m_partial_infer_requests.emplace_back();
-    return std::ref(m_partial_infer_requests.back());
+    auto &partial_infer_request =
+        m_partial_infer_requests[(m_partial_infer_requests_head + m_partial_infer_requests_count) % m_max_queue_size];
+    m_partial_infer_requests_count++;
+    return std::ref(partial_infer_request);
 }
 
 } /* namespace hailort */
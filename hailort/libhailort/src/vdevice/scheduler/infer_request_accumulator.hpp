@@ -15,7 +15,7 @@
 
 #include <mutex>
 #include <condition_variable>
-#include <list>
+#include <vector>
 
 namespace hailort
 {
@@ -25,7 +25,7 @@ public:
     InferRequestAccumulator(size_t streams_count, size_t max_queue_size,
         std::function<void(InferRequest&&)> frame_accumulated);
 
-    hailo_status add_transfer_request(const std::string &stream_name, TransferRequest &&request);
+    hailo_status add_transfer_request(stream_index_t stream_index, TransferRequest &&request);
 
     // All new add_transfer_request call will fail. Waits until all accumulated infer requests are done, cancel all
     // partial requests.
@@ -35,10 +35,10 @@ public:
 
 private:
 
-    using PartialInferRequest = std::unordered_map<std::string, TransferRequest>;
+    using PartialInferRequest = StreamsTransfers;
 
-    // Find an infer request that can contain transfer request for the given stream name.
-    ExpectedRef<PartialInferRequest> get_infer_request(const std::string &stream_name);
+    // Find an infer request that can contain transfer request for the given stream.
+    ExpectedRef<PartialInferRequest> get_infer_request(stream_index_t stream_index);
 
     const size_t m_streams_count;
     const size_t m_max_queue_size;
@@ -53,7 +53,11 @@ private:
 
     // A partial infer request contains TransferRequest from subset of the core op streams.
     // When a partial infer request is completed (all streams are filled), the m_frame_accumulated is called.
-    std::list<PartialInferRequest> m_partial_infer_requests;
+    // The partial infer requests are kept in a ring of m_max_queue_size entries (from the oldest, at
+    // m_partial_infer_requests_head), allocated once, so accumulating a frame doesn't allocate.
+    std::vector<PartialInferRequest> m_partial_infer_requests;
+    size_t m_partial_infer_requests_head;
+    size_t m_partial_infer_requests_count;
 };
 
 } /* namespace hailort */
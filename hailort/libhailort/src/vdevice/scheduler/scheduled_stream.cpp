@@ -25,6 +25,7 @@ Expected<std::unique_ptr<ScheduledInputStream>> ScheduledInputStream::create(
     std::map<device_id_t, std::reference_wrapper<InputStreamBase>> &&streams,
     const LayerInfo &layer_info,
     const scheduler_core_op_handle_t &core_op_handle,
+    stream_index_t stream_index,
     EventPtr core_op_activated_event,
     std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator)
 {
@@ -37,7 +38,7 @@ Expected<std::unique_ptr<ScheduledInputStream>> ScheduledInputStream::create(
 
     auto status = HAILO_UNINITIALIZED;
     auto local_vdevice_stream = make_unique_nothrow<ScheduledInputStream>(vdevice, std::move(streams), core_op_handle,
-        std::move(core_op_activated_event), layer_info, std::move(infer_requests_accumulator), status);
+        stream_index, std::move(core_op_activated_event), layer_info, std::move(infer_requests_accumulator), status);
     CHECK_NOT_NULL_AS_EXPECTED(local_vdevice_stream, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -69,8 +70,8 @@ hailo_status ScheduledInputStream::write_async_impl(TransferRequest &&transfer_r
 {
     TRACE(FrameEnqueueH2DTrace, m_core_op_handle, name());
 
-    transfer_request.callback = m_callback_reorder_queue.wrap_callback(transfer_request.callback);
-    auto status = m_infer_requests_accumulator->add_transfer_request(name(), std::move(transfer_request));
+    TRY(transfer_request.callback, m_callback_reorder_queue.wrap_callback(transfer_request.callback));
+    auto status = m_infer_requests_accumulator->add_transfer_request(m_stream_index, std::move(transfer_request));
     if (HAILO_SUCCESS != status) {
         m_callback_reorder_queue.cancel_last_callback();
         if (HAILO_QUEUE_IS_FULL == status) {
@@ -87,6 +88,7 @@ Expected<std::unique_ptr<ScheduledOutputStream>> ScheduledOutputStream::create(
     VDevice &vdevice,
     std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> &&streams,
     const scheduler_core_op_handle_t &core_op_handle,
+    stream_index_t stream_index,
     const LayerInfo &layer_info,
     EventPtr core_op_activated_event,
     std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator)
@@ -101,7 +103,7 @@ Expected<std::unique_ptr<ScheduledOutputStream>> ScheduledOutputStream::create(
 
     auto status = HAILO_UNINITIALIZED;
     auto stream = make_unique_nothrow<ScheduledOutputStream>(vdevice, std::move(streams), core_op_handle,
-        layer_info, std::move(core_op_activated_event), std::move(infer_requests_accumulator), status);
+        stream_index, layer_info, std::move(core_op_activated_event), std::move(infer_requests_accumulator), status);
     CHECK_NOT_NULL_AS_EXPECTED(stream, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -131,8 +133,8 @@ size_t ScheduledOutputStream::get_max_ongoing_transfers() const
 
 hailo_status ScheduledOutputStream::read_async_impl(TransferRequest &&transfer_request)
 {
-    transfer_request.callback = m_callback_reorder_queue.wrap_callback(transfer_request.callback);
-    auto status = m_infer_requests_accumulator->add_transfer_request(name(), std::move(transfer_request));
+    TRY(transfer_request.callback, m_callback_reorder_queue.wrap_callback(transfer_request.callback));
+    auto status = m_infer_requests_accumulator->add_transfer_request(m_stream_index, std::move(transfer_request));
     if (HAILO_SUCCESS != status) {
         m_callback_reorder_queue.cancel_last_callback();
         if (HAILO_QUEUE_IS_FULL == status) {
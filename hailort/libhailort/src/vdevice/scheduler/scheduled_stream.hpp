@@ -35,6 +35,7 @@ public:
         std::map<device_id_t, std::reference_wrapper<InputStreamBase>> &&streams,
         const LayerInfo &layer_info,
         const scheduler_core_op_handle_t &core_op_handle,
+        stream_index_t stream_index,
         EventPtr core_op_activated_event,
         std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator);
 
@@ -42,6 +43,7 @@ public:
         VDevice &vdevice,
         std::map<device_id_t, std::reference_wrapper<InputStreamBase>> &&streams,
         const scheduler_core_op_handle_t &core_op_handle,
+        stream_index_t stream_index,
         EventPtr &&core_op_activated_event,
         const LayerInfo &layer_info,
         std::shared_ptr<InferRequestAccumulator> &&infer_requests_accumulator,
@@ -50,6 +52,7 @@ public:
             m_vdevice(vdevice),
             m_streams(std::move(streams)),
             m_core_op_handle(core_op_handle),
+            m_stream_index(stream_index),
             m_infer_requests_accumulator(infer_requests_accumulator),
             m_callback_reorder_queue(infer_requests_accumulator->queue_size()) // TODO HRT-1058 - use reorder queue only when needed
     {}
@@ -67,6 +70,8 @@ private:
     VDevice &m_vdevice;
     std::map<device_id_t, std::reference_wrapper<InputStreamBase>> m_streams;
     scheduler_core_op_handle_t m_core_op_handle;
+    // Index of the stream in the core op infer requests
+    const stream_index_t m_stream_index;
     std::shared_ptr<InferRequestAccumulator> m_infer_requests_accumulator;
 
     CallbackReorderQueue m_callback_reorder_queue;
@@ -78,6 +83,7 @@ public:
         VDevice &vdevice,
         std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> &&streams,
         const scheduler_core_op_handle_t &core_op_handle,
+        stream_index_t stream_index,
         const LayerInfo &layer_info,
         EventPtr core_op_activated_event,
         std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator);
@@ -86,6 +92,7 @@ public:
         VDevice &vdevice,
         std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> &&streams,
         const scheduler_core_op_handle_t &core_op_handle,
+        stream_index_t stream_index,
         const LayerInfo &layer_info,
         EventPtr &&core_op_activated_event,
         std::shared_ptr<InferRequestAccumulator> &&infer_requests_accumulator,
@@ -94,6 +101,7 @@ public:
             m_vdevice(vdevice),
             m_streams(std::move(streams)),
             m_core_op_handle(core_op_handle),
+            m_stream_index(stream_index),
             m_infer_requests_accumulator(infer_requests_accumulator),
             m_callback_reorder_queue(infer_requests_accumulator->queue_size()) // TODO HRT-1058 - use reorder queue only when needed
     {}
@@ -131,6 +139,8 @@ private:
     VDevice &m_vdevice;
     std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> m_streams;
     scheduler_core_op_handle_t m_core_op_handle;
+    // Index of the stream in the core op infer requests
+    const stream_index_t m_stream_index;
     std::shared_ptr<InferRequestAccumulator> m_infer_requests_accumulator;
 
     CallbackReorderQueue m_callback_reorder_queue;
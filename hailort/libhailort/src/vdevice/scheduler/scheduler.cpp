@@ -399,9 +399,9 @@ void CoreOpsScheduler::shutdown_core_op(scheduler_core_op_handle_t core_op_handl
     while (core_op->requested_infer_requests() > 0) {
         auto request = dequeue_infer_request(core_op_handle);
         assert(request);
-        for (auto &transfer : request->transfers) {
-            transfer.second.callback(HAILO_STREAM_ABORT);
-        }
+        request->transfers.for_each([](stream_index_t, TransferRequest &transfer) {
+            transfer.callback(HAILO_STREAM_ABORT);
+        });
 
         // Before calling infer_callback, we must ensure all stream callbacks were called and released (since the
         // user may capture some variables in the callbacks).
@@ -411,6 +411,11 @@ hailo_status VDeviceClient::start_listener_thread(VDeviceIdentifier identifier)
     return HAILO_SUCCESS;
 }
 
+// Max callbacks returned by a single VDevice_get_callback_ids request, and how long the service waits for more
+// callbacks before replying (0 - reply with the callbacks that are already ready).
+static const uint32_t MAX_CALLBACKS_PER_LISTENER_BATCH = 64;
+static const std::chrono::milliseconds CALLBACKS_LISTENER_LINGER(0);
+
 hailo_status VDeviceClient::listener_run_in_thread(VDeviceIdentifier identifier)
 {
     grpc::ChannelArguments ch_args;
@@ -419,32 +424,41 @@ hailo_status VDeviceClient::listener_run_in_thread(VDeviceIdentifier identifier)
     auto client = make_unique_nothrow<HailoRtRpcClient>(channel);
     CHECK_NOT_NULL(client, HAILO_OUT_OF_HOST_MEMORY);
 
+    std::vector<std::shared_ptr<ConfiguredNetworkGroupClient>> ng_ptrs;
+    ng_ptrs.reserve(MAX_CALLBACKS_PER_LISTENER_BATCH);
     while (m_is_listener_thread_running) {
-        auto callback_id = client->VDevice_get_callback_id(identifier);
-        if (HAILO_SUCCESS != callback_id.status()) {
+        // Each request returns all the callbacks that are ready (up to MAX_CALLBACKS_PER_LISTENER_BATCH), so at high
+        // FPS a single round trip serves the callbacks of many transfers.
+        auto callback_ids = client->VDevice_get_callback_ids(identifier, MAX_CALLBACKS_PER_LISTENER_BATCH,
+            CALLBACKS_LISTENER_LINGER);
+        if (HAILO_SUCCESS != callback_ids.status()) {
             std::unique_lock<std::mutex> lock(m_mutex);
             for (auto &ng_ptr_pair : m_network_groups) {
-                ng_ptr_pair.second->execute_callbacks_on_error(callback_id.status());
+                ng_ptr_pair.second->execute_callbacks_on_error(callback_ids.status());
             }
-            if (callback_id.status() == HAILO_SHUTDOWN_EVENT_SIGNALED) {
+            if (callback_ids.status() == HAILO_SHUTDOWN_EVENT_SIGNALED) {
                 LOGGER__INFO("Shutdown event was signaled in listener_run_in_thread");
-            } else if (callback_id.status() == HAILO_RPC_FAILED) {
+            } else if (callback_ids.status() == HAILO_RPC_FAILED) {
                 LOGGER__ERROR("Lost communication with the service..");
             } else {
-                LOGGER__ERROR("Failed to get callback_id from listener thread with {}", callback_id.status());
+                LOGGER__ERROR("Failed to get callback_ids from listener thread with {}", callback_ids.status());
             }
             break;
         }
-        CHECK_EXPECTED_AS_STATUS(callback_id);
+        CHECK_EXPECTED_AS_STATUS(callback_ids);
 
-        std::shared_ptr<ConfiguredNetworkGroupClient> ng_ptr;
+        ng_ptrs.clear();
         {
             std::unique_lock<std::mutex> lock(m_mutex);
-            assert(contains(m_network_groups, callback_id->network_group_handle()));
-            ng_ptr = m_network_groups.at(callback_id->network_group_handle());
+            for (const auto &callback_id : callback_ids.value()) {
+                assert(contains(m_network_groups, callback_id.network_group_handle()));
+                ng_ptrs.emplace_back(m_network_groups.at(callback_id.network_group_handle()));
+            }
+        }
+        for (size_t i = 0; i < ng_ptrs.size(); i++) {
+            auto status = ng_ptrs[i]->execute_callback(callback_ids.value()[i]);
+            CHECK_SUCCESS(status);
         }
-        auto status = ng_ptr->execute_callback(callback_id.value());
-        CHECK_SUCCESS(status);
     }
 
     return HAILO_SUCCESS;
@@ -108,9 +108,8 @@ VDeviceCoreOp::VDeviceCoreOp(VDevice &vdevice,
     }
 
     if (m_core_ops_scheduler.lock() && (max_queue_size > 0)) {
-        const auto streams_count = m_config_params.stream_params_by_name.size();
         auto infer_request_accumulator =
-            make_shared_nothrow<InferRequestAccumulator>(streams_count, max_queue_size,
+            make_shared_nothrow<InferRequestAccumulator>(streams_count(), max_queue_size,
                 [this](InferRequest &&infer_request) {
                     auto scheduler = m_core_ops_scheduler.lock();
                     if (!scheduler) {
@@ -221,8 +220,9 @@ hailo_status VDeviceCoreOp::create_input_vdevice_stream_from_config_params(const
 
     if (m_core_ops_scheduler.lock()) {
         assert(m_infer_requests_accumulator);
+        TRY(const auto stream_index, get_stream_index(stream_name));
         auto scheduled_stream = ScheduledInputStream::create(m_vdevice, std::move(low_level_streams),
-            edge_layer.value(), m_core_op_handle, m_core_op_activated_event, m_infer_requests_accumulator);
+            edge_layer.value(), m_core_op_handle, stream_index, m_core_op_activated_event, m_infer_requests_accumulator);
         CHECK_EXPECTED_AS_STATUS(scheduled_stream);
 
         input_stream = scheduled_stream.release();
@@ -262,8 +262,9 @@ hailo_status VDeviceCoreOp::create_output_vdevice_stream_from_config_params(cons
 
     if (m_core_ops_scheduler.lock()) {
         assert(m_infer_requests_accumulator);
+        TRY(const auto stream_index, get_stream_index(stream_name));
         auto scheduled_stream = ScheduledOutputStream::create(m_vdevice, std::move(low_level_streams),
-            m_core_op_handle, edge_layer.value(), m_core_op_activated_event, m_infer_requests_accumulator);
+            m_core_op_handle, stream_index, edge_layer.value(), m_core_op_activated_event, m_infer_requests_accumulator);
         CHECK_EXPECTED_AS_STATUS(scheduled_stream);
 
         output_stream = scheduled_stream.release();
@@ -187,7 +187,7 @@ hailo_status VDeviceNativeInputStream::write_async(TransferRequest &&transfer_re
 {
     // TODO HRT-10583 - allow option to remove reorder queue
     CHECK(m_callback_reorder_queue, HAILO_INVALID_OPERATION, "Stream does not support async api");
-    transfer_request.callback = m_callback_reorder_queue->wrap_callback(transfer_request.callback);
+    TRY(transfer_request.callback, m_callback_reorder_queue->wrap_callback(transfer_request.callback));
 
     TRACE(FrameEnqueueH2DTrace, m_core_op_handle, name());
 
@@ -382,7 +382,7 @@ hailo_status VDeviceNativeOutputStream::read_async(TransferRequest &&transfer_re
     CHECK(m_callback_reorder_queue, HAILO_INVALID_OPERATION, "Stream does not support async api");
 
 
-    auto reorder_queue_callback = m_callback_reorder_queue->wrap_callback(transfer_request.callback);
+    TRY(auto reorder_queue_callback, m_callback_reorder_queue->wrap_callback(transfer_request.callback));
 
     transfer_request.callback = [this, callback=reorder_queue_callback](hailo_status status) {
         callback(status);
@@ -10,6 +10,8 @@
 #include "hailo/hailort_common.hpp"
 
 #include "common/os_utils.hpp"
+#include "common/utils.hpp"
+#include "common/internal_env_vars.hpp"
 
 #include "vdma/channel/boundary_channel.hpp"
 
@@ -23,11 +25,13 @@ namespace hailort {
 namespace vdma {
 Expected<BoundaryChannelPtr> BoundaryChannel::create(HailoRTDriver &driver, vdma::ChannelId channel_id,
     Direction direction, vdma::DescriptorList &&desc_list, TransferLauncher &transfer_launcher,
-    size_t ongoing_transfers, size_t pending_transfers, const std::string &stream_name, LatencyMeterPtr latency_meter)
+    CompletionExecutor &completion_executor, size_t ongoing_transfers, size_t pending_transfers,
+    const std::string &stream_name, LatencyMeterPtr latency_meter)
 {
     hailo_status status = HAILO_UNINITIALIZED;
     auto channel_ptr = make_shared_nothrow<BoundaryChannel>(driver, channel_id, direction, std::move(desc_list),
-        transfer_launcher, ongoing_transfers, pending_transfers, stream_name, latency_meter, status);
+        transfer_launcher, completion_executor, ongoing_transfers, pending_transfers, stream_name, latency_meter,
+        status);
     CHECK_NOT_NULL_AS_EXPECTED(channel_ptr, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status, "Failed creating BoundaryChannel");
     return channel_ptr;
@@ -35,12 +39,14 @@ Expected<BoundaryChannelPtr> BoundaryChannel::create(HailoRTDriver &driver, vdma
 
 BoundaryChannel::BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction,
                                  DescriptorList &&desc_list, TransferLauncher &transfer_launcher,
+                                 CompletionExecutor &completion_executor,
                                  size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
                                  const std::string &stream_name, LatencyMeterPtr latency_meter, hailo_status &status) :
     m_channel_id(channel_id),
     m_direction(direction),
     m_driver(driver),
     m_transfer_launcher(transfer_launcher),
+    m_completion_executor(completion_executor),
     m_desc_list(std::move(desc_list)),
     m_stream_name(stream_name),
     m_descs(m_desc_list.count()),
@@ -52,7 +58,9 @@ BoundaryChannel::BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_
     m_latency_meter(latency_meter),
     m_pending_latency_measurements(ONGOING_TRANSFERS_SIZE), // Make sure there will always be place for latency measure
     m_last_timestamp_num_processed(0),
-    m_bounded_buffer(nullptr)
+    m_bounded_buffer(nullptr),
+    m_should_cache_desc_programs(is_env_variable_on(HAILO_CACHE_DESC_PROGRAMS_ENV_VAR)),
+    m_desc_programs()
 {
     if (Direction::BOTH == direction) {
         LOGGER__ERROR("Boundary channels must be unidirectional");
@@ -75,6 +83,12 @@ BoundaryChannel::BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_
     status = HAILO_SUCCESS;
 }
 
+BoundaryChannel::~BoundaryChannel()
+{
+    // Callbacks that were already handed to the completion executor may still reference the stream objects
+    m_completion_executor.flush(completion_ordering_key());
+}
+
 // Function that based off the irq data returns the status to be sent to the callbak functions
 static hailo_status get_callback_status(vdma::ChannelId channel_id, const ChannelIrqData &irq_data)
 {
@@ -187,6 +201,9 @@ void BoundaryChannel::deactivate()
 {
     std::unique_lock<std::mutex> lock(m_channel_mutex);
     m_is_channel_activated = false;
+
+    // Release the mappings held by the cached programs, the next activation will program the descriptors again.
+    m_desc_programs.clear();
 }
 
 hailo_status BoundaryChannel::launch_transfer(TransferRequest &&transfer_request)
@@ -252,10 +269,14 @@ Expected<uint16_t> BoundaryChannel::launch_transfer_impl(TransferRequest &transf
     }
 
     std::vector<HailoRTDriver::TransferBuffer> driver_transfer_buffers;
+    MappedBufferPtr first_mapped_buffer = nullptr;
 
     auto current_num_available = num_available;
     for (auto &transfer_buffer : transfer_request.transfer_buffers) {
         TRY(auto mapped_buffer, transfer_buffer.map_buffer(m_driver, m_direction));
+        if (nullptr == first_mapped_buffer) {
+            first_mapped_buffer = mapped_buffer;
+        }
         driver_transfer_buffers.emplace_back(HailoRTDriver::TransferBuffer{
             mapped_buffer->handle(),
             transfer_buffer.offset(),
@@ -291,18 +312,36 @@ Expected<uint16_t> BoundaryChannel::launch_transfer_impl(TransferRequest &transf
     }
     m_descs.enqueue(total_descs_count);
 
+    // If the descriptors are already programmed to point to the same buffer, we only need to launch the transfer.
+    auto should_program = should_bind;
+    const bool is_cacheable = m_should_cache_desc_programs && (1 == transfer_request.transfer_buffers.size());
+    if (should_bind && m_should_cache_desc_programs) {
+        if (is_cacheable && is_desc_program_cached(first_desc, first_mapped_buffer, transfer_request.transfer_buffers[0])) {
+            should_program = false;
+        } else {
+            // The descriptors are about to be re-programmed (even if the launch fails).
+            invalidate_desc_programs(first_desc, total_descs_count);
+        }
+    }
+
     TRY_WITH_ACCEPTABLE_STATUS(HAILO_STREAM_ABORT, const auto desc_programmed, m_driver.launch_transfer(
         m_channel_id,
         m_desc_list.handle(),
         num_available,
         driver_transfer_buffers,
-        should_bind,
+        should_program,
         first_desc_interrupts,
         last_desc_interrupts
         ));
     CHECK(total_descs_count == desc_programmed, HAILO_INTERNAL_FAILURE,
         "Inconsistent desc programed expecting {} got {}", total_descs_count, desc_programmed);
 
+    if (should_program && is_cacheable) {
+        const auto &transfer_buffer = transfer_request.transfer_buffers[0];
+        m_desc_programs[first_desc] = DescProgram{first_mapped_buffer, transfer_buffer.offset(), transfer_buffer.size(),
+            total_descs_count};
+    }
+
     return last_desc;
 }
 
@@ -318,6 +357,7 @@ hailo_status BoundaryChannel::bind_buffer(MappedBufferPtr buffer)
     static const size_t DEFAULT_BUFFER_OFFSET = 0;
     CHECK_SUCCESS(m_desc_list.program(*buffer, buffer->size(), DEFAULT_BUFFER_OFFSET, m_channel_id));
     m_bounded_buffer = buffer;
+    m_desc_programs.clear();
     return HAILO_SUCCESS;
 }
 
@@ -331,6 +371,7 @@ void BoundaryChannel::remove_buffer_binding()
 {
     std::lock_guard<std::mutex> lock(m_channel_mutex);
     m_bounded_buffer = nullptr;
+    m_desc_programs.clear();
 }
 
 void BoundaryChannel::cancel_pending_transfers()
@@ -352,6 +393,10 @@ void BoundaryChannel::cancel_pending_transfers()
 
         on_request_complete(lock, pending_transfer, HAILO_STREAM_ABORT);
     }
+
+    // Make sure all the callbacks were called before the caller frees the transfers resources
+    lock.unlock();
+    m_completion_executor.flush(completion_ordering_key());
 }
 
 size_t BoundaryChannel::get_max_ongoing_transfers(size_t /* transfer_size */) const
@@ -412,9 +457,23 @@ hailo_status BoundaryChannel::update_latency_meter()
 void BoundaryChannel::on_request_complete(std::unique_lock<std::mutex> &lock, TransferRequest &request,
     hailo_status complete_status)
 {
-    lock.unlock();
-    request.callback(complete_status);
-    lock.lock();
+    if (m_completion_executor.is_inline()) {
+        lock.unlock();
+        request.callback(complete_status);
+        lock.lock();
+        return;
+    }
+
+    // Only hand the callback off, so the interrupts thread won't be blocked by it
+    m_completion_executor.enqueue(completion_ordering_key(),
+        [callback=std::move(request.callback), complete_status]() {
+            callback(complete_status);
+        });
+}
+
+size_t BoundaryChannel::completion_ordering_key() const
+{
+    return (static_cast<size_t>(m_channel_id.engine_index) * VDMA_CHANNELS_PER_ENGINE) + m_channel_id.channel_index;
 }
 
 bool BoundaryChannel::is_desc_between(uint16_t begin, uint16_t end, uint16_t desc)
@@ -484,5 +543,38 @@ Expected<bool> BoundaryChannel::should_bind_buffer(TransferRequest &transfer_req
     return false;
 }
 
+// Assumes m_channel_mutex is locked
+bool BoundaryChannel::is_desc_program_cached(uint16_t first_desc, const MappedBufferPtr &mapped_buffer,
+    const TransferBuffer &transfer_buffer) const
+{
+    const auto desc_program = m_desc_programs.find(first_desc);
+    if (m_desc_programs.end() == desc_program) {
+        return false;
+    }
+
+    // An expired entry (its buffer was unmapped) never matches, even if the new mapping got the same handle.
+    const auto &program = desc_program->second;
+    return (program.mapped_buffer.lock() == mapped_buffer) &&
+        (program.offset == transfer_buffer.offset()) &&
+        (program.size == transfer_buffer.size());
+}
+
+// Assumes m_channel_mutex is locked
+void BoundaryChannel::invalidate_desc_programs(uint16_t first_desc, uint16_t descs_count)
+{
+    // Both regions may wrap around the end of the descriptors list, so the distances are taken modulo the list size.
+    for (auto it = m_desc_programs.begin(); it != m_desc_programs.end();) {
+        const auto cached_first_desc = it->first;
+        const auto cached_descs_count = it->second.descs_count;
+        const auto distance_from_cached = static_cast<uint16_t>((first_desc - cached_first_desc) & m_descs.size_mask());
+        const auto distance_to_cached = static_cast<uint16_t>((cached_first_desc - first_desc) & m_descs.size_mask());
+        if ((distance_from_cached < cached_descs_count) || (distance_to_cached < descs_count)) {
+            it = m_desc_programs.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
 } /* namespace vdma */
 } /* namespace hailort */
@@ -12,12 +12,14 @@
 
 #include "vdma/channel/channel_id.hpp"
 #include "vdma/channel/transfer_launcher.hpp"
+#include "vdma/channel/completion_executor.hpp"
 #include "vdma/channel/transfer_common.hpp"
 #include "vdma/memory/descriptor_list.hpp"
 
 #include "common/latency_meter.hpp"
 
 #include <memory>
+#include <map>
 
 
 namespace hailort {
@@ -38,17 +40,19 @@ public:
     using Direction = HailoRTDriver::DmaDirection;
 
     static Expected<BoundaryChannelPtr> create(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction,
-        vdma::DescriptorList &&desc_list, TransferLauncher &transfer_launcher, size_t ongoing_transfers,
-        size_t pending_transfers = 0, const std::string &stream_name = "", LatencyMeterPtr latency_meter = nullptr);
+        vdma::DescriptorList &&desc_list, TransferLauncher &transfer_launcher, CompletionExecutor &completion_executor,
+        size_t ongoing_transfers, size_t pending_transfers = 0, const std::string &stream_name = "",
+        LatencyMeterPtr latency_meter = nullptr);
 
     BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction, DescriptorList &&desc_list,
-        TransferLauncher &transfer_launcher, size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
+        TransferLauncher &transfer_launcher, CompletionExecutor &completion_executor,
+        size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
         const std::string &stream_name, LatencyMeterPtr latency_meter, hailo_status &status);
     BoundaryChannel(const BoundaryChannel &other) = delete;
     BoundaryChannel &operator=(const BoundaryChannel &other) = delete;
     BoundaryChannel(BoundaryChannel &&other) = delete;
     BoundaryChannel &operator=(BoundaryChannel &&other) = delete;
-    virtual ~BoundaryChannel() = default;
+    virtual ~BoundaryChannel();
 
     /**
      * Activates the channel object, assume the vDMA channel registers are already in activated state.
@@ -61,7 +65,7 @@ public:
     void deactivate();
 
     // Calls all pending transfer callbacks (if they exist), marking them as canceled by passing
-    // HAILO_STREAM_ABORT as a status to the callbacks.
+    // HAILO_STREAM_ABORT as a status to the callbacks. Returns after all the channel's callbacks were called.
     // Note: This function is to be called on a deactivated channel object. Calling on an active channel will lead to
     // unexpected results
     void cancel_pending_transfers();
@@ -110,16 +114,25 @@ private:
     hailo_status launch_and_enqueue_transfer(TransferRequest &&transfer_request, bool queue_failed_transfer = false);
     Expected<uint16_t> launch_transfer_impl(TransferRequest &transfer_request);
 
+    size_t completion_ordering_key() const;
+
     static bool is_desc_between(uint16_t begin, uint16_t end, uint16_t desc);
     hailo_status validate_bound_buffer(TransferRequest &transfer_request);
 
     Expected<bool> should_bind_buffer(TransferRequest &transfer_request);
     static Expected<bool> is_same_buffer(MappedBufferPtr mapped_buff, TransferBuffer &transfer_buffer);
 
+    bool is_desc_program_cached(uint16_t first_desc, const MappedBufferPtr &mapped_buffer,
+        const TransferBuffer &transfer_buffer) const;
+    void invalidate_desc_programs(uint16_t first_desc, uint16_t descs_count);
+
     const vdma::ChannelId m_channel_id;
     const Direction m_direction;
     HailoRTDriver &m_driver;
     TransferLauncher &m_transfer_launcher;
+    // Transfer callbacks are executed by m_completion_executor (and not on the interrupts thread), keyed by the
+    // channel so the callbacks of each channel are called in order.
+    CompletionExecutor &m_completion_executor;
     DescriptorList m_desc_list; // Host side descriptor list
     const std::string m_stream_name;
     // Since all desc list sizes are a power of 2, we can use IsPow2Tag to optimize the circular buffer
@@ -155,6 +168,24 @@ private:
 
     // When bind_buffer is called, we keep a reference to the buffer here. This is used to avoid buffer bindings.
     std::shared_ptr<MappedBuffer> m_bounded_buffer;
+
+    // About descriptor program caching (enabled by HAILO_CACHE_DESC_PROGRAMS_ENV_VAR):
+    //  - Each entry describes a descriptors region (keyed by its first descriptor) that is currently programmed to
+    //    point to some (buffer, offset, size). Regions in the map never overlap.
+    //  - When a single buffer transfer is launched at the start of a region that already points to the same buffer,
+    //    the transfer is launched without re-binding the buffer, so the driver only updates the channel pointers.
+    //  - Each entry holds a weak reference to its mapped buffer, so the cache doesn't keep the user mappings pinned.
+    //    Once a buffer is unmapped (and its last transfer is done), its entries expire and the descriptors are
+    //    re-programmed on their next use - even if a new mapping got the same handle.
+    //    The cache is cleared when the channel is deactivated or when a buffer is bound to the whole list.
+    struct DescProgram {
+        std::weak_ptr<MappedBuffer> mapped_buffer;
+        size_t offset;
+        size_t size;
+        uint16_t descs_count;
+    };
+    const bool m_should_cache_desc_programs;
+    std::map<uint16_t, DescProgram> m_desc_programs;
 };
 
 } /* namespace vdma */
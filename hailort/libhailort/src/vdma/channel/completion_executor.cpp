@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file completion_executor.cpp
+ * @brief Manages the threads that run vdma transfer completion callbacks, so the interrupts thread is not blocked
+ *        by the callbacks.
+ **/
+
+#include "completion_executor.hpp"
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+#include "common/string_utils.hpp"
+#include "common/env_vars.hpp"
+#include "utils/profiler/tracer_macros.hpp"
+
+namespace hailort {
+namespace vdma {
+
+static const size_t DEFAULT_COMPLETION_THREADS_COUNT = 1;
+static const size_t MAX_COMPLETION_THREADS_COUNT = 16;
+
+static size_t get_completion_threads_count()
+{
+    auto env_var = get_env_variable(HAILO_COMPLETION_THREADS_ENV_VAR);
+    if (!env_var) {
+        return DEFAULT_COMPLETION_THREADS_COUNT;
+    }
+
+    auto threads_count = StringUtils::to_uint32(env_var.value(), 10);
+    if ((!threads_count) || (threads_count.value() > MAX_COMPLETION_THREADS_COUNT)) {
+        LOGGER__WARNING("Invalid {} value '{}' (expected 0-{}), using {} completion threads",
+            HAILO_COMPLETION_THREADS_ENV_VAR, env_var.value(), MAX_COMPLETION_THREADS_COUNT,
+            DEFAULT_COMPLETION_THREADS_COUNT);
+        return DEFAULT_COMPLETION_THREADS_COUNT;
+    }
+
+    return threads_count.value();
+}
+
+Expected<std::unique_ptr<CompletionExecutor>> CompletionExecutor::create(const device_id_t &device_id)
+{
+    return create(get_completion_threads_count(), device_id);
+}
+
+Expected<std::unique_ptr<CompletionExecutor>> CompletionExecutor::create(size_t threads_count,
+    const device_id_t &device_id)
+{
+    hailo_status status = HAILO_UNINITIALIZED;
+    auto executor = make_unique_nothrow<CompletionExecutor>(threads_count, device_id, status);
+    CHECK_NOT_NULL_AS_EXPECTED(executor, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status, "Failed creating CompletionExecutor");
+    return executor;
+}
+
+CompletionExecutor::CompletionExecutor(size_t threads_count, const device_id_t &device_id, hailo_status &status) :
+    m_device_id(device_id),
+    m_workers(),
+    m_queue_depth(0),
+    m_max_queue_depth(0),
+    m_executed_count(0)
+{
+    m_workers.reserve(threads_count);
+    for (size_t i = 0; i < threads_count; i++) {
+        auto worker = make_unique_nothrow<Worker>();
+        if (nullptr == worker) {
+            LOGGER__ERROR("Failed allocating completion executor worker");
+            status = HAILO_OUT_OF_HOST_MEMORY;
+            return;
+        }
+        m_workers.emplace_back(std::move(worker));
+    }
+
+    // The threads are started only after all workers were allocated, so a failure won't leave running threads behind
+    for (auto &worker : m_workers) {
+        auto &worker_ref = *worker;
+        worker->thread = std::thread([this, &worker_ref] { worker_thread(worker_ref); });
+    }
+
+    status = HAILO_SUCCESS;
+}
+
+CompletionExecutor::~CompletionExecutor()
+{
+    for (auto &worker : m_workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->should_quit = true;
+        }
+        worker->cond.notify_all();
+    }
+
+    for (auto &worker : m_workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    const auto stats = get_stats();
+    TRACE(CompletionExecutorStatsTrace, m_device_id, stats.queue_depth, stats.max_queue_depth, stats.executed_count);
+    LOGGER__DEBUG("Completion executor executed {} completions, max queue depth {}", stats.executed_count,
+        stats.max_queue_depth);
+}
+
+void CompletionExecutor::enqueue(size_t ordering_key, Completion &&completion)
+{
+    if (is_inline()) {
+        completion();
+        m_executed_count++;
+        return;
+    }
+
+    const auto queue_depth = ++m_queue_depth;
+    auto max_queue_depth = m_max_queue_depth.load();
+    while (queue_depth > max_queue_depth) {
+        if (m_max_queue_depth.compare_exchange_weak(max_queue_depth, queue_depth)) {
+            // Traced only on a new maximum, so the interrupts thread isn't slowed down by tracing every completion
+            TRACE(CompletionExecutorStatsTrace, m_device_id, queue_depth, queue_depth, m_executed_count.load());
+            break;
+        }
+    }
+
+    auto &worker = get_worker(ordering_key);
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        const auto sequence = ++worker.enqueued_sequence;
+        worker.last_sequences[ordering_key] = sequence;
+        worker.queue.emplace(QueuedCompletion{sequence, std::move(completion)});
+    }
+    worker.cond.notify_all();
+}
+
+void CompletionExecutor::flush(size_t ordering_key)
+{
+    if (is_inline() || is_worker_thread()) {
+        // Waiting from a worker thread may wait for the completion that is currently running on it.
+        return;
+    }
+
+    auto &worker = get_worker(ordering_key);
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    const auto last_sequence = worker.last_sequences.find(ordering_key);
+    if (worker.last_sequences.end() == last_sequence) {
+        // Nothing was enqueued with this ordering key
+        return;
+    }
+
+    // The worker executes its completions in order, so reaching the sequence of the last completion of this key means
+    // all of them were executed
+    const auto sequence = last_sequence->second;
+    worker.flush_waiters++;
+    worker.cond.wait(lock, [&worker, sequence] { return worker.should_quit || (worker.executed_sequence >= sequence); });
+    worker.flush_waiters--;
+}
+
+CompletionExecutor::Stats CompletionExecutor::get_stats() const
+{
+    return Stats{m_queue_depth.load(), m_max_queue_depth.load(), m_executed_count.load()};
+}
+
+void CompletionExecutor::worker_thread(Worker &worker)
+{
+    OsUtils::set_current_thread_name("CHANNEL_CMPLT");
+
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    while (true) {
+        worker.cond.wait(lock, [&worker] { return worker.should_quit || !worker.queue.empty(); });
+        if (worker.queue.empty()) {
+            // should_quit is set and all enqueued completions were executed
+            return;
+        }
+
+        auto queued_completion = std::move(worker.queue.front());
+        worker.queue.pop();
+        lock.unlock();
+
+        m_queue_depth--;
+        queued_completion.completion();
+        m_executed_count++;
+
+        lock.lock();
+        worker.executed_sequence = queued_completion.sequence;
+        if (0 < worker.flush_waiters) {
+            worker.cond.notify_all(); // Wake up flush()
+        }
+    }
+}
+
+CompletionExecutor::Worker &CompletionExecutor::get_worker(size_t ordering_key)
+{
+    assert(!m_workers.empty());
+    return *m_workers[ordering_key % m_workers.size()];
+}
+
+bool CompletionExecutor::is_worker_thread() const
+{
+    const auto this_thread_id = std::this_thread::get_id();
+    for (const auto &worker : m_workers) {
+        if (worker->thread.get_id() == this_thread_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} /* namespace vdma */
+} /* namespace hailort */
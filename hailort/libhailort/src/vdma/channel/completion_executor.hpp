@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file completion_executor.hpp
+ * @brief Manages the threads that run vdma transfer completion callbacks, so the interrupts thread is not blocked
+ *        by the callbacks.
+ **/
+
+#ifndef _HAILO_COMPLETION_EXECUTOR_HPP_
+#define _HAILO_COMPLETION_EXECUTOR_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/stream.hpp"
+
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <vector>
+#include <unordered_map>
+#include <atomic>
+
+namespace hailort {
+namespace vdma {
+
+class CompletionExecutor final
+{
+public:
+    using Completion = std::function<void()>;
+
+    struct Stats {
+        // Completions waiting to be executed
+        size_t queue_depth;
+        // Highest queue_depth seen since the executor was created
+        size_t max_queue_depth;
+        // Total completions executed
+        uint64_t executed_count;
+    };
+
+    // Creates an executor with the threads count given by HAILO_COMPLETION_THREADS_ENV_VAR (or the default).
+    // device_id identifies the executor in the CompletionExecutorStatsTrace traces.
+    static Expected<std::unique_ptr<CompletionExecutor>> create(const device_id_t &device_id);
+    // threads_count 0 means inline mode - completions are executed on the calling (interrupts) thread, so they must
+    // be cheap.
+    static Expected<std::unique_ptr<CompletionExecutor>> create(size_t threads_count, const device_id_t &device_id);
+    CompletionExecutor(size_t threads_count, const device_id_t &device_id, hailo_status &status);
+    ~CompletionExecutor();
+
+    CompletionExecutor(CompletionExecutor &&) = delete;
+    CompletionExecutor(const CompletionExecutor &) = delete;
+    CompletionExecutor &operator=(CompletionExecutor &&) = delete;
+    CompletionExecutor &operator=(const CompletionExecutor &) = delete;
+
+    bool is_inline() const { return m_workers.empty(); }
+
+    // Completions enqueued with the same ordering_key are executed one after the other, in the enqueue order.
+    void enqueue(size_t ordering_key, Completion &&completion);
+
+    // Waits until all completions enqueued so far with the given ordering_key were executed. Completions of other
+    // ordering keys that were enqueued later are not waited for.
+    // Returns immediately in inline mode, or when called from one of the executor threads.
+    void flush(size_t ordering_key);
+
+    // The stats are also traced (CompletionExecutorStatsTrace) whenever max_queue_depth grows, and on destruction
+    Stats get_stats() const;
+
+private:
+    struct QueuedCompletion {
+        // Sequence number of the completion in its worker, starting from 1
+        uint64_t sequence;
+        Completion completion;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::queue<QueuedCompletion> queue;
+        uint64_t enqueued_sequence = 0;
+        // Sequence number of the last completion that finished executing
+        uint64_t executed_sequence = 0;
+        // Sequence number of the last completion enqueued with each ordering key, used by flush()
+        std::unordered_map<size_t, uint64_t> last_sequences;
+        size_t flush_waiters = 0;
+        // should_quit is used to quit the thread (called on destruction)
+        bool should_quit = false;
+        std::thread thread;
+    };
+
+    void worker_thread(Worker &worker);
+    Worker &get_worker(size_t ordering_key);
+    bool is_worker_thread() const;
+
+    const device_id_t m_device_id;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<size_t> m_queue_depth;
+    std::atomic<size_t> m_max_queue_depth;
+    std::atomic<uint64_t> m_executed_count;
+};
+
+} /* namespace vdma */
+} /* namespace hailort */
+
+#endif /* _HAILO_COMPLETION_EXECUTOR_HPP_ */
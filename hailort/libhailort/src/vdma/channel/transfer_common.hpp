@@ -17,6 +17,8 @@
 #include "vdma/memory/mapped_buffer.hpp"
 #include "common/os_utils.hpp"
 
+#include <array>
+
 namespace hailort
 {
 
@@ -113,9 +115,97 @@ struct TransferRequest {
     }
 };
 
+// Index of a stream inside its core op. Stream names are interned into indices when the core op is configured (see
+// CoreOp::get_stream_index), so the per-frame containers don't hash, compare or copy stream names.
+using stream_index_t = uint32_t;
+
+// Transfer requests of a single frame, indexed by stream index. A stream without a transfer (for example, while the
+// frame is being accumulated) holds an empty TransferRequest.
+// The transfers of the first INLINE_STREAMS_COUNT streams are stored inline, so a frame of a core op with up to
+// INLINE_STREAMS_COUNT streams doesn't allocate.
+class StreamsTransfers final {
+public:
+    static constexpr size_t INLINE_STREAMS_COUNT = 8;
+
+    explicit StreamsTransfers(size_t streams_count = 0) :
+        m_streams_count(streams_count),
+        m_overflow_transfers((streams_count > INLINE_STREAMS_COUNT) ? (streams_count - INLINE_STREAMS_COUNT) : 0),
+        m_count(0)
+    {}
+
+    // Number of streams that have a transfer
+    size_t size() const { return m_count; }
+    bool empty() const { return 0 == m_count; }
+    size_t streams_count() const { return m_streams_count; }
+
+    bool contains(stream_index_t stream_index) const
+    {
+        return (stream_index < m_streams_count) && !transfer(stream_index).transfer_buffers.empty();
+    }
+
+    TransferRequest &at(stream_index_t stream_index)
+    {
+        assert(contains(stream_index));
+        return transfer(stream_index);
+    }
+
+    void emplace(stream_index_t stream_index, TransferRequest &&transfer_request)
+    {
+        assert(stream_index < m_streams_count);
+        assert(!contains(stream_index));
+        assert(!transfer_request.transfer_buffers.empty());
+        transfer(stream_index) = std::move(transfer_request);
+        m_count++;
+    }
+
+    void erase(stream_index_t stream_index)
+    {
+        assert(contains(stream_index));
+        transfer(stream_index) = TransferRequest();
+        m_count--;
+    }
+
+    // Releases all transfers (and their callbacks), keeping the streams count
+    void clear()
+    {
+        for (stream_index_t stream_index = 0; stream_index < m_streams_count; stream_index++) {
+            transfer(stream_index) = TransferRequest();
+        }
+        m_count = 0;
+    }
+
+    // Calls func(stream_index, transfer) for every stream that has a transfer
+    template<typename Func>
+    void for_each(Func func)
+    {
+        for (stream_index_t stream_index = 0; stream_index < m_streams_count; stream_index++) {
+            if (contains(stream_index)) {
+                func(stream_index, transfer(stream_index));
+            }
+        }
+    }
+
+private:
+    TransferRequest &transfer(stream_index_t stream_index)
+    {
+        return (stream_index < INLINE_STREAMS_COUNT) ? m_inline_transfers[stream_index] :
+            m_overflow_transfers[stream_index - INLINE_STREAMS_COUNT];
+    }
+    const TransferRequest &transfer(stream_index_t stream_index) const
+    {
+        return (stream_index < INLINE_STREAMS_COUNT) ? m_inline_transfers[stream_index] :
+            m_overflow_transfers[stream_index - INLINE_STREAMS_COUNT];
+    }
+
+    size_t m_streams_count;
+    std::array<TransferRequest, INLINE_STREAMS_COUNT> m_inline_transfers;
+    std::vector<TransferRequest> m_overflow_transfers;
+    size_t m_count;
+};
+
 struct InferRequest {
     // Transfer for each stream
-    std::unordered_map<std::string, TransferRequest> transfers;
+    StreamsTransfers transfers;
 
     // Callback to be called when all transfer finishes
     TransferDoneCallback callback;
@@ -42,10 +42,13 @@ Expected<PcieSession> PcieSession::create(std::shared_ptr<HailoRTDriver> driver,
 {
     TRY(auto interrupts_dispatcher, vdma::InterruptsDispatcher::create(*driver));
     TRY(auto transfer_launcher, vdma::TransferLauncher::create());
+    // The session callbacks only signal the hrpc transport, so they run inline to keep the transport latency low
+    static const size_t INLINE_COMPLETIONS = 0;
+    TRY(auto completion_executor, vdma::CompletionExecutor::create(INLINE_COMPLETIONS, driver->device_id()));
 
     auto create_channel = [&](vdma::ChannelId id, vdma::BoundaryChannel::Direction dir, vdma::DescriptorList &&desc_list) {
         return vdma::BoundaryChannel::create(*driver, id, dir, std::move(desc_list), *transfer_launcher,
-            MAX_ONGOING_TRANSFERS);
+            *completion_executor, MAX_ONGOING_TRANSFERS);
     };
 
     TRY(auto input_channel, create_channel(input_channel_id, vdma::BoundaryChannel::Direction::H2D, std::move(input_desc_list)));
@@ -58,7 +61,7 @@ Expected<PcieSession> PcieSession::create(std::shared_ptr<HailoRTDriver> driver,
     CHECK_SUCCESS(output_channel->activate());
 
     return PcieSession(std::move(driver), std::move(interrupts_dispatcher), std::move(transfer_launcher),
-        std::move(input_channel), std::move(output_channel), session_type);
+        std::move(completion_executor), std::move(input_channel), std::move(output_channel), session_type);
 }
 
 hailo_status PcieSession::write(const void *buffer, size_t size, std::chrono::milliseconds timeout)
@@ -81,6 +84,16 @@ hailo_status PcieSession::read_async(void *buffer, size_t size, std::function<vo
     return launch_transfer_async(*m_output, buffer, size, std::move(callback));
 }
 
+hailo_status PcieSession::write_async(TransferRequest &&request)
+{
+    return m_input->launch_transfer(std::move(request));
+}
+
+hailo_status PcieSession::read_async(TransferRequest &&request)
+{
+    return m_output->launch_transfer(std::move(request));
+}
+
 hailo_status PcieSession::close()
 {
     hailo_status status = HAILO_SUCCESS; // Success orietnted
@@ -129,17 +142,23 @@ uint64_t PcieSession::max_transfer_size()
 hailo_status PcieSession::launch_transfer_sync(vdma::BoundaryChannel &channel,
     void *buffer, size_t size, std::chrono::milliseconds timeout)
 {
-    std::mutex mutex;
-    std::condition_variable cv;
-    hailo_status transfer_status = HAILO_UNINITIALIZED;
-    auto callback = [&](hailo_status status) mutable {
-        // TODO: HRT-14965 - when the wait_for returns on timeout, this reference capture will be invalid and cause a SEGFAULT
+    // The state is shared with the callback, so it stays valid if the wait returns on timeout before the transfer
+    // completes.
+    struct TransferState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        hailo_status status = HAILO_UNINITIALIZED;
+    };
+    auto state = make_shared_nothrow<TransferState>();
+    CHECK_NOT_NULL(state, HAILO_OUT_OF_HOST_MEMORY);
+
+    auto callback = [state](hailo_status status) {
         {
-            std::unique_lock<std::mutex> lock(mutex);
+            std::unique_lock<std::mutex> lock(state->mutex);
             assert(status != HAILO_UNINITIALIZED);
-            transfer_status = status;
+            state->status = status;
         }
-        cv.notify_one();
+        state->cv.notify_one();
     };
 
     auto status = launch_transfer_async(channel, buffer, size, std::move(callback));
@@ -148,10 +167,10 @@ hailo_status PcieSession::launch_transfer_sync(vdma::BoundaryChannel &channel,
     }
     CHECK_SUCCESS(status);
 
-    std::unique_lock<std::mutex> lock(mutex);
-    CHECK(cv.wait_for(lock, timeout, [&] { return transfer_status != HAILO_UNINITIALIZED; }),
+    std::unique_lock<std::mutex> lock(state->mutex);
+    CHECK(state->cv.wait_for(lock, timeout, [&] { return state->status != HAILO_UNINITIALIZED; }),
         HAILO_TIMEOUT, "Timeout waiting for transfer completion");
-    return transfer_status;
+    return state->status;
 }
 
 hailo_status PcieSession::launch_transfer_async(vdma::BoundaryChannel &channel,
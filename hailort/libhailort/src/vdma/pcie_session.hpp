@@ -65,6 +65,11 @@ public:
     hailo_status write_async(const void *buffer, size_t size, std::function<void(hailo_status)> &&callback);
     hailo_status read_async(void *buffer, size_t size, std::function<void(hailo_status)> &&callback);
 
+    // Requests of multiple buffers (at most 2, each starting at a new descriptor). Only the total size of the request
+    // is part of the size pattern, so a buffer can be split differently on each edge.
+    hailo_status write_async(TransferRequest &&request);
+    hailo_status read_async(TransferRequest &&request);
+
     hailo_status close();
 
     inline PcieSessionType session_type() const
@@ -79,6 +84,7 @@ public:
         m_driver(std::move(other.m_driver)),
         m_interrupts_dispatcher(std::move(other.m_interrupts_dispatcher)),
         m_transfer_launcher(std::move(other.m_transfer_launcher)),
+        m_completion_executor(std::move(other.m_completion_executor)),
         m_input(std::move(other.m_input)),
         m_output(std::move(other.m_output)),
         m_session_type(other.m_session_type)
@@ -96,10 +102,12 @@ private:
     PcieSession(std::shared_ptr<HailoRTDriver> &&driver,
         std::unique_ptr<vdma::InterruptsDispatcher> &&interrupts_dispatcher,
         std::unique_ptr<vdma::TransferLauncher> &&transfer_launcher,
+        std::unique_ptr<vdma::CompletionExecutor> &&completion_executor,
         vdma::BoundaryChannelPtr &&input, vdma::BoundaryChannelPtr &&output, PcieSessionType session_type) :
         m_driver(std::move(driver)),
         m_interrupts_dispatcher(std::move(interrupts_dispatcher)),
         m_transfer_launcher(std::move(transfer_launcher)),
+        m_completion_executor(std::move(completion_executor)),
         m_input(std::move(input)),
         m_output(std::move(output)),
         m_session_type(session_type)
@@ -116,6 +124,8 @@ private:
 
     std::unique_ptr<vdma::InterruptsDispatcher> m_interrupts_dispatcher;
     std::unique_ptr<vdma::TransferLauncher> m_transfer_launcher;
+    // Declared before the channels, since the channels flush it on destruction
+    std::unique_ptr<vdma::CompletionExecutor> m_completion_executor;
 
     vdma::BoundaryChannelPtr m_input;
     vdma::BoundaryChannelPtr m_output;
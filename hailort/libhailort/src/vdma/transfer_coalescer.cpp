@@ -0,0 +1,347 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transfer_coalescer.cpp
+ * @brief Implements TransferCoalescer
+ **/
+
+#include "vdma/transfer_coalescer.hpp"
+#include "vdma/memory/dma_able_buffer.hpp"
+#include "utils/buffer_storage.hpp"
+
+#include "common/utils.hpp"
+#include "common/string_utils.hpp"
+#include "common/env_vars.hpp"
+
+
+namespace hailort {
+namespace vdma {
+
+static const std::chrono::microseconds DEFAULT_COALESCING_LATENCY(1000);
+
+static size_t get_coalescing_max_frames()
+{
+    auto env_var = get_env_variable(HAILO_TRANSFER_COALESCING_MAX_FRAMES_ENV_VAR);
+    if (!env_var) {
+        return 1;
+    }
+
+    auto max_frames = StringUtils::to_uint32(env_var.value(), 10);
+    if (!max_frames) {
+        LOGGER__WARNING("Invalid {} value '{}', transfer coalescing is disabled",
+            HAILO_TRANSFER_COALESCING_MAX_FRAMES_ENV_VAR, env_var.value());
+        return 1;
+    }
+    return max_frames.value();
+}
+
+static std::chrono::microseconds get_coalescing_latency_cap()
+{
+    auto env_var = get_env_variable(HAILO_TRANSFER_COALESCING_LATENCY_US_ENV_VAR);
+    if (!env_var) {
+        return DEFAULT_COALESCING_LATENCY;
+    }
+
+    auto latency_us = StringUtils::to_uint32(env_var.value(), 10);
+    if ((!latency_us) || (0 == latency_us.value())) {
+        LOGGER__WARNING("Invalid {} value '{}', using {}us", HAILO_TRANSFER_COALESCING_LATENCY_US_ENV_VAR,
+            env_var.value(), DEFAULT_COALESCING_LATENCY.count());
+        return DEFAULT_COALESCING_LATENCY;
+    }
+    return std::chrono::microseconds(latency_us.value());
+}
+
+Expected<std::unique_ptr<TransferCoalescer>> TransferCoalescer::create(VdmaDevice &device, BoundaryChannelPtr channel,
+    size_t frame_size, hailo_dma_buffer_direction_t direction)
+{
+    const auto max_frames = get_coalescing_max_frames();
+    if (max_frames <= 1) {
+        return std::unique_ptr<TransferCoalescer>();
+    }
+
+    if (channel->should_measure_timestamp()) {
+        // The latency meter pairs the first H2D descriptor of a frame with the last D2H descriptor of the frame
+        LOGGER__INFO("Transfer coalescing is disabled for {} since latency is measured", channel->stream_name());
+        return std::unique_ptr<TransferCoalescer>();
+    }
+
+    const auto desc_page_size = channel->get_desc_list().desc_page_size();
+    if ((0 == frame_size) || (0 != (frame_size % desc_page_size))) {
+        LOGGER__INFO("Transfer coalescing is disabled for {} since its frame size {} is not a multiple of the desc page size {}",
+            channel->stream_name(), frame_size, desc_page_size);
+        return std::unique_ptr<TransferCoalescer>();
+    }
+
+    const auto slots_count = channel->get_max_ongoing_transfers(frame_size);
+    if (slots_count < MIN_GROUPS_IN_FLIGHT * 2) {
+        LOGGER__INFO("Transfer coalescing is disabled for {} since only {} transfers can be ongoing",
+            channel->stream_name(), slots_count);
+        return std::unique_ptr<TransferCoalescer>();
+    }
+
+    TRY(auto dma_able_buffer, DmaAbleBuffer::create_by_allocation(slots_count * frame_size));
+    auto dma_storage = make_shared_nothrow<DmaStorage>(std::move(dma_able_buffer));
+    CHECK_NOT_NULL(dma_storage, HAILO_OUT_OF_HOST_MEMORY);
+    TRY(auto staging_buffer, Buffer::create(std::move(dma_storage)));
+    TRY(auto staging_mapping, DmaMappedBuffer::create(device, staging_buffer.data(), staging_buffer.size(), direction));
+
+    TRY(auto transfer_launcher, device.get_vdma_transfer_launcher());
+    const auto max_group_frames = std::min(max_frames, slots_count / MIN_GROUPS_IN_FLIGHT);
+    const auto latency_cap = get_coalescing_latency_cap();
+
+    auto coalescer = make_unique_nothrow<TransferCoalescer>(channel, transfer_launcher.get(), frame_size, slots_count,
+        max_group_frames, latency_cap, (HAILO_DMA_BUFFER_DIRECTION_H2D == direction), std::move(staging_buffer),
+        std::move(staging_mapping));
+    CHECK_NOT_NULL(coalescer, HAILO_OUT_OF_HOST_MEMORY);
+
+    LOGGER__INFO("Transfer coalescing is enabled for {} (up to {} frames, latency cap {}us)", channel->stream_name(),
+        max_group_frames, latency_cap.count());
+    return coalescer;
+}
+
+TransferCoalescer::TransferCoalescer(BoundaryChannelPtr channel, TransferLauncher &transfer_launcher,
+    size_t frame_size, size_t slots_count, size_t max_frames, std::chrono::nanoseconds latency_cap, bool is_h2d,
+    Buffer &&staging_buffer, DmaMappedBuffer &&staging_mapping) :
+    m_channel(std::move(channel)),
+    m_transfer_launcher(transfer_launcher),
+    m_frame_size(frame_size),
+    m_slots_count(slots_count),
+    m_max_frames(max_frames),
+    m_latency_cap(latency_cap),
+    m_is_h2d(is_h2d),
+    m_staging_buffer(std::move(staging_buffer)),
+    m_staging_mapping(std::move(staging_mapping)),
+    m_group(),
+    m_next_slot(0),
+    m_free_slots(slots_count),
+    m_groups_in_flight(0),
+    // Starts without coalescing, until the frame time is measured
+    m_coalescing_factor(1),
+    m_frame_time(0),
+    m_last_group_done_time()
+{}
+
+bool TransferCoalescer::can_coalesce(TransferRequest &transfer_request) const
+{
+    for (const auto &transfer_buffer : transfer_request.transfer_buffers) {
+        if (TransferBufferType::MEMORYVIEW != transfer_buffer.type()) {
+            return false;
+        }
+    }
+    return m_frame_size == transfer_request.get_total_transfer_size();
+}
+
+hailo_status TransferCoalescer::launch_transfer(TransferRequest &&transfer_request)
+{
+    assert(can_coalesce(transfer_request));
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (0 == m_free_slots) {
+        return HAILO_QUEUE_IS_FULL;
+    }
+
+    if (m_slots_count == m_next_slot) {
+        // The previous group ended at the end of the staging buffer (so it was launched)
+        assert(m_group.requests.empty());
+        m_next_slot = 0;
+    }
+
+    if (m_is_h2d) {
+        CHECK_SUCCESS(copy_to_slot(transfer_request, slot_view(m_next_slot)));
+    }
+
+    if (m_group.requests.empty()) {
+        m_group.first_slot = m_next_slot;
+    }
+    m_group.requests.emplace_back(std::move(transfer_request));
+    m_next_slot++;
+    m_free_slots--;
+
+    if (!should_launch_group()) {
+        return HAILO_SUCCESS;
+    }
+
+    std::vector<TransferRequest> failed_requests;
+    auto status = launch_group(failed_requests);
+    if (HAILO_SUCCESS != status) {
+        // The caller gets the status of its own frame, the frames queued before it were already accepted
+        failed_requests.pop_back();
+        complete_async(std::move(failed_requests), status);
+    }
+    return status;
+}
+
+void TransferCoalescer::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_group.requests.empty()) {
+        return;
+    }
+
+    std::vector<TransferRequest> failed_requests;
+    auto status = launch_group(failed_requests);
+    if (HAILO_SUCCESS != status) {
+        complete_async(std::move(failed_requests), status);
+    }
+}
+
+void TransferCoalescer::cancel_pending_transfers()
+{
+    std::vector<TransferRequest> canceled_requests;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        take_group_requests(canceled_requests);
+    }
+    call_callbacks(canceled_requests, HAILO_STREAM_ABORT);
+}
+
+bool TransferCoalescer::should_launch_group() const
+{
+    // A group can't wrap around the end of the staging buffer
+    return (m_group.requests.size() >= m_coalescing_factor) || (m_groups_in_flight < MIN_GROUPS_IN_FLIGHT) ||
+        (m_slots_count == m_next_slot);
+}
+
+hailo_status TransferCoalescer::launch_group(std::vector<TransferRequest> &failed_requests)
+{
+    assert(!m_group.requests.empty());
+
+    auto group = make_shared_nothrow<Group>();
+    if (nullptr == group) {
+        take_group_requests(failed_requests);
+        return HAILO_OUT_OF_HOST_MEMORY;
+    }
+    std::swap(*group, m_group);
+
+    const auto frames_count = group->requests.size();
+    TransferBuffer staging(MemoryView(m_staging_buffer), frames_count * m_frame_size, group->first_slot * m_frame_size);
+    const auto launch_time = Clock::now();
+    auto status = m_channel->launch_transfer(TransferRequest(std::move(staging),
+        [this, group, launch_time](hailo_status complete_status) {
+            on_group_done(*group, launch_time, complete_status);
+        }));
+    if (HAILO_SUCCESS != status) {
+        std::swap(*group, m_group);
+        take_group_requests(failed_requests);
+        return status;
+    }
+
+    m_groups_in_flight++;
+    return HAILO_SUCCESS;
+}
+
+void TransferCoalescer::take_group_requests(std::vector<TransferRequest> &requests)
+{
+    if (m_group.requests.empty()) {
+        return;
+    }
+
+    // The queued group holds the newest slots
+    m_next_slot = m_group.first_slot;
+    m_free_slots += m_group.requests.size();
+    requests = std::move(m_group.requests);
+    m_group = Group();
+}
+
+void TransferCoalescer::on_group_done(Group &group, Clock::time_point launch_time, hailo_status status)
+{
+    if ((HAILO_SUCCESS == status) && !m_is_h2d) {
+        for (size_t i = 0; i < group.requests.size(); i++) {
+            auto copy_status = copy_from_slot(group.requests[i], slot_view(group.first_slot + i));
+            if (HAILO_SUCCESS != copy_status) {
+                status = copy_status;
+            }
+        }
+    }
+
+    std::vector<TransferRequest> failed_requests;
+    auto launch_status = HAILO_SUCCESS;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_groups_in_flight--;
+        m_free_slots += group.requests.size();
+
+        if (HAILO_SUCCESS == status) {
+            const auto now = Clock::now();
+            update_coalescing_factor(group.requests.size(), now - std::max(launch_time, m_last_group_done_time));
+            m_last_group_done_time = now;
+
+            // Frames queued while the groups were in flight
+            if (!m_group.requests.empty() && should_launch_group()) {
+                launch_status = launch_group(failed_requests);
+            }
+        }
+    }
+
+    call_callbacks(group.requests, status);
+    call_callbacks(failed_requests, launch_status);
+}
+
+void TransferCoalescer::update_coalescing_factor(size_t frames_count, Clock::duration group_time)
+{
+    const auto frame_time = std::chrono::duration_cast<std::chrono::nanoseconds>(group_time) / frames_count;
+    // Moving average, so a single slow group doesn't shrink the groups
+    m_frame_time = (0 == m_frame_time.count()) ? frame_time : ((m_frame_time * 7) + frame_time) / 8;
+
+    const auto frames_in_latency_cap = (0 == m_frame_time.count()) ? m_max_frames :
+        static_cast<size_t>(m_latency_cap / m_frame_time);
+    m_coalescing_factor = std::max(static_cast<size_t>(1), std::min(frames_in_latency_cap, m_max_frames));
+}
+
+void TransferCoalescer::complete_async(std::vector<TransferRequest> &&requests, hailo_status status)
+{
+    if (requests.empty()) {
+        return;
+    }
+
+    auto requests_ptr = make_shared_nothrow<std::vector<TransferRequest>>(std::move(requests));
+    if (nullptr == requests_ptr) {
+        LOGGER__CRITICAL("Failed completing failed transfers of {}, out of memory", m_channel->stream_name());
+        return;
+    }
+    auto status_to_report = m_transfer_launcher.enqueue_transfer([requests_ptr, status]() {
+        call_callbacks(*requests_ptr, status);
+    });
+    if (HAILO_SUCCESS != status_to_report) {
+        LOGGER__CRITICAL("Failed completing failed transfers of {} with status {}", m_channel->stream_name(),
+            status_to_report);
+    }
+}
+
+MemoryView TransferCoalescer::slot_view(size_t slot)
+{
+    assert(slot < m_slots_count);
+    return MemoryView(m_staging_buffer.data() + (slot * m_frame_size), m_frame_size);
+}
+
+hailo_status TransferCoalescer::copy_to_slot(TransferRequest &transfer_request, MemoryView slot)
+{
+    size_t offset = 0;
+    for (auto &transfer_buffer : transfer_request.transfer_buffers) {
+        CHECK_SUCCESS(transfer_buffer.copy_to(MemoryView(slot.data() + offset, transfer_buffer.size())));
+        offset += transfer_buffer.size();
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status TransferCoalescer::copy_from_slot(TransferRequest &transfer_request, MemoryView slot)
+{
+    size_t offset = 0;
+    for (auto &transfer_buffer : transfer_request.transfer_buffers) {
+        CHECK_SUCCESS(transfer_buffer.copy_from(MemoryView(slot.data() + offset, transfer_buffer.size())));
+        offset += transfer_buffer.size();
+    }
+    return HAILO_SUCCESS;
+}
+
+void TransferCoalescer::call_callbacks(std::vector<TransferRequest> &requests, hailo_status status)
+{
+    for (auto &request : requests) {
+        request.callback(status);
+    }
+}
+
+} /* namespace vdma */
+} /* namespace hailort */
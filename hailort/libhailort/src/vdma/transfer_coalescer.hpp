@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transfer_coalescer.hpp
+ * @brief Packs consecutive frames of a vdma stream into a single DMA transfer, so small frames don't pay for a
+ *        descriptors programming, an interrupt and a callback dispatch each.
+ **/
+
+#ifndef _HAILO_VDMA_TRANSFER_COALESCER_HPP_
+#define _HAILO_VDMA_TRANSFER_COALESCER_HPP_
+
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+#include "hailo/dma_mapped_buffer.hpp"
+
+#include "vdma/vdma_device.hpp"
+#include "vdma/channel/boundary_channel.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+
+namespace hailort {
+namespace vdma {
+
+// About transfer coalescing (enabled by HAILO_TRANSFER_COALESCING_MAX_FRAMES_ENV_VAR):
+//  - The frames are copied to (H2D) or from (D2H) a staging buffer of max_ongoing_transfers frame slots, mapped once
+//    when the coalescer is created. A group of consecutive frames occupies consecutive slots, so it is launched as a
+//    single buffer transfer with a single interrupt. The driver can't chain more than 2 buffers in a transfer, so the
+//    user buffers can't be launched together as is.
+//  - A group is launched when it reaches the coalescing factor, or when less than MIN_GROUPS_IN_FLIGHT groups are in
+//    flight (so the device is never starved while frames wait for a group to fill).
+//  - Once the group is done, the frames callbacks are called one after the other, in order.
+//  - The coalescing factor is tuned by the device time of a frame (measured on the groups completions), so a group
+//    takes at most the latency cap.
+//  - The frames are transferred by the same descriptors as separate transfers would use, hence the coalescer is only
+//    created for streams whose frame size is a multiple of the descriptor page size.
+class TransferCoalescer final
+{
+public:
+    // Returns nullptr if coalescing is disabled, or can't be used by the channel
+    static Expected<std::unique_ptr<TransferCoalescer>> create(VdmaDevice &device, BoundaryChannelPtr channel,
+        size_t frame_size, hailo_dma_buffer_direction_t direction);
+
+    TransferCoalescer(BoundaryChannelPtr channel, TransferLauncher &transfer_launcher, size_t frame_size,
+        size_t slots_count, size_t max_frames, std::chrono::nanoseconds latency_cap, bool is_h2d,
+        Buffer &&staging_buffer, DmaMappedBuffer &&staging_mapping);
+
+    TransferCoalescer(const TransferCoalescer &) = delete;
+    TransferCoalescer &operator=(const TransferCoalescer &) = delete;
+    TransferCoalescer(TransferCoalescer &&) = delete;
+    TransferCoalescer &operator=(TransferCoalescer &&) = delete;
+
+    // Only a single frame in host memory can be copied to/from the staging buffer (dmabufs are launched on their own)
+    bool can_coalesce(TransferRequest &transfer_request) const;
+
+    // Queues a frame transfer (can_coalesce must be true). The frame may be launched together with the next frames.
+    // If an error is returned, the request callback won't be called.
+    hailo_status launch_transfer(TransferRequest &&transfer_request);
+
+    // Launches the queued frames. Must be called before a transfer is launched on the channel directly.
+    void flush();
+
+    // Calls the callbacks of the frames that weren't launched yet with HAILO_STREAM_ABORT. Should be called after the
+    // channel transfers were canceled, so the callbacks are called in order.
+    void cancel_pending_transfers();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Keeps at least 2 groups in flight, so the device has a queued transfer while a completed group is handled
+    static constexpr size_t MIN_GROUPS_IN_FLIGHT = 2;
+
+    struct Group {
+        size_t first_slot = 0;
+        std::vector<TransferRequest> requests;
+    };
+
+    bool should_launch_group() const;
+
+    // Assumes m_mutex is locked. If the launch fails, the group requests are moved to failed_requests.
+    hailo_status launch_group(std::vector<TransferRequest> &failed_requests);
+    // Assumes m_mutex is locked. Moves the requests of the queued group to requests and releases its slots.
+    void take_group_requests(std::vector<TransferRequest> &requests);
+    void on_group_done(Group &group, Clock::time_point launch_time, hailo_status status);
+    // Assumes m_mutex is locked
+    void update_coalescing_factor(size_t frames_count, Clock::duration group_time);
+    // Calls the callbacks on the transfer launcher thread, for requests that failed while the caller holds the stream
+    void complete_async(std::vector<TransferRequest> &&requests, hailo_status status);
+
+    MemoryView slot_view(size_t slot);
+    static hailo_status copy_to_slot(TransferRequest &transfer_request, MemoryView slot);
+    static hailo_status copy_from_slot(TransferRequest &transfer_request, MemoryView slot);
+    static void call_callbacks(std::vector<TransferRequest> &requests, hailo_status status);
+
+    BoundaryChannelPtr m_channel;
+    TransferLauncher &m_transfer_launcher;
+    const size_t m_frame_size;
+    const size_t m_slots_count;
+    // The coalescing factor limit, leaving room in the staging buffer for MIN_GROUPS_IN_FLIGHT groups
+    const size_t m_max_frames;
+    const std::chrono::nanoseconds m_latency_cap;
+    const bool m_is_h2d;
+    Buffer m_staging_buffer;
+    DmaMappedBuffer m_staging_mapping;
+
+    std::mutex m_mutex;
+    // Frames that weren't launched yet
+    Group m_group;
+    // Slot of the next frame. Groups are completed in order, so the free slots always start at m_next_slot.
+    size_t m_next_slot;
+    size_t m_free_slots;
+    size_t m_groups_in_flight;
+    size_t m_coalescing_factor;
+    // Moving average of the device time of a single frame
+    std::chrono::nanoseconds m_frame_time;
+    Clock::time_point m_last_group_done_time;
+};
+
+} /* namespace vdma */
+} /* namespace hailort */
+
+#endif /* _HAILO_VDMA_TRANSFER_COALESCER_HPP_ */
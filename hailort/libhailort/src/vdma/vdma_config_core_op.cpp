@@ -230,24 +230,28 @@ hailo_status VdmaConfigCoreOp::set_scheduler_priority(uint8_t /*priority*/, cons
     return HAILO_INVALID_OPERATION;
 }
 
-hailo_status VdmaConfigCoreOp::bind_buffers(std::unordered_map<std::string, TransferRequest> &transfers)
+hailo_status VdmaConfigCoreOp::bind_buffers(StreamsTransfers &transfers)
 {
+    auto input_stream_index = m_input_streams_indices.begin();
     for (auto &input : m_input_streams) {
-        auto transfer = transfers.find(input.second->name());
-        CHECK(transfer != transfers.end(), HAILO_INTERNAL_FAILURE, "Invalid stream {}", input.second->name());
-        if (transfer->second.transfer_buffers.size() > 1) {
+        const auto stream_index = *(input_stream_index++);
+        CHECK(transfers.contains(stream_index), HAILO_INTERNAL_FAILURE, "Invalid stream {}", input.second->name());
+        auto &transfer = transfers.at(stream_index);
+        if (transfer.transfer_buffers.size() > 1) {
             break;
         }
-        CHECK_SUCCESS(input.second->bind_buffer(TransferRequest{transfer->second}));
+        CHECK_SUCCESS(input.second->bind_buffer(TransferRequest{transfer}));
     }
 
+    auto output_stream_index = m_output_streams_indices.begin();
     for (auto &output : m_output_streams) {
-        auto transfer = transfers.find(output.second->name());
-        CHECK(transfer != transfers.end(), HAILO_INTERNAL_FAILURE, "Invalid stream {}", output.second->name());
-        if (transfer->second.transfer_buffers.size() > 1) {
+        const auto stream_index = *(output_stream_index++);
+        CHECK(transfers.contains(stream_index), HAILO_INTERNAL_FAILURE, "Invalid stream {}", output.second->name());
+        auto &transfer = transfers.at(stream_index);
+        if (transfer.transfer_buffers.size() > 1) {
             break;
         }
-        CHECK_SUCCESS(output.second->bind_buffer(TransferRequest{transfer->second}));
+        CHECK_SUCCESS(output.second->bind_buffer(TransferRequest{transfer}));
     }
 
     return HAILO_SUCCESS;
@@ -69,7 +69,7 @@ public:
     hailo_status register_cache_update_callback();
     hailo_status unregister_cache_update_callback();
 
-    hailo_status bind_buffers(std::unordered_map<std::string, TransferRequest> &transfers);
+    hailo_status bind_buffers(StreamsTransfers &transfers);
 
     virtual Expected<hailo_stream_interface_t> get_default_streams_interface() override;
 
@@ -20,6 +20,7 @@
 #include "core_op/core_op.hpp"
 #include "common/os_utils.hpp"
 #include "utils/buffer_storage.hpp"
+#include "utils/dma_buffer_utils.hpp"
 #include "hef/hef_internal.hpp"
 
 #include <new>
@@ -137,6 +138,9 @@ Expected<ConfiguredNetworkGroupVector> VdmaDevice::add_hef(Hef &hef, const Netwo
         assert(nullptr == m_vdma_transfer_launcher);
         TRY(m_vdma_transfer_launcher, vdma::TransferLauncher::create());
 
+        assert(nullptr == m_vdma_completion_executor);
+        TRY(m_vdma_completion_executor, vdma::CompletionExecutor::create(get_dev_id()));
+
         m_is_configured = true;
     }
 
@@ -239,6 +243,12 @@ ExpectedRef<vdma::TransferLauncher> VdmaDevice::get_vdma_transfer_launcher()
     return std::ref(*m_vdma_transfer_launcher);
 }
 
+ExpectedRef<vdma::CompletionExecutor> VdmaDevice::get_vdma_completion_executor()
+{
+    CHECK_AS_EXPECTED(m_vdma_completion_executor, HAILO_INTERNAL_FAILURE, "vDMA completion executor wasn't created");
+    return std::ref(*m_vdma_completion_executor);
+}
+
 VdmaDevice::~VdmaDevice()
 {
     auto status = stop_notification_fetch_thread();
@@ -311,6 +321,8 @@ hailo_status VdmaDevice::dma_map_dmabuf(int dmabuf_fd, size_t size, hailo_dma_bu
 
 hailo_status VdmaDevice::dma_unmap_dmabuf(int dmabuf_fd, size_t size, hailo_dma_buffer_direction_t data_direction)
 {
+    // The user is done with this dmabuf, so host-side mappings of it shouldn't be kept alive
+    DmaBufferUtils::invalidate_cached_mappings(dmabuf_fd);
     return m_driver->vdma_buffer_unmap(dmabuf_fd, size, to_hailo_driver_direction(data_direction));
 }
 
@@ -25,10 +25,12 @@ Expected<std::shared_ptr<VdmaInputStream>> VdmaInputStream::create(hailo_stream_
     assert((interface == HAILO_STREAM_INTERFACE_PCIE) || (interface == HAILO_STREAM_INTERFACE_INTEGRATED));
 
     TRY(auto bounce_buffers_pool, init_dma_bounce_buffer_pool(device, channel, edge_layer));
+    TRY(auto transfer_coalescer, vdma::TransferCoalescer::create(device, channel,
+        LayerInfoUtils::get_layer_transfer_size(edge_layer), HAILO_DMA_BUFFER_DIRECTION_H2D));
 
     hailo_status status = HAILO_UNINITIALIZED;
     auto result = make_shared_nothrow<VdmaInputStream>(device, channel, edge_layer,
-        core_op_activated_event, interface, std::move(bounce_buffers_pool), status);
+        core_op_activated_event, interface, std::move(bounce_buffers_pool), std::move(transfer_coalescer), status);
     CHECK_NOT_NULL_AS_EXPECTED(result, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
     return result;
@@ -67,11 +69,12 @@ Expected<BounceBufferQueuePtr> VdmaInputStream::init_dma_bounce_buffer_pool(
 VdmaInputStream::VdmaInputStream(VdmaDevice &device, vdma::BoundaryChannelPtr channel,
                                  const LayerInfo &edge_layer, EventPtr core_op_activated_event,
                                  hailo_stream_interface_t stream_interface, BounceBufferQueuePtr &&bounce_buffers_pool,
-                                 hailo_status &status) :
+                                 std::unique_ptr<vdma::TransferCoalescer> &&transfer_coalescer, hailo_status &status) :
     AsyncInputStreamBase(edge_layer, std::move(core_op_activated_event), status),
     m_device(device),
     m_bounce_buffers_pool(std::move(bounce_buffers_pool)),
     m_channel(std::move(channel)),
+    m_transfer_coalescer(std::move(transfer_coalescer)),
     m_interface(stream_interface),
     m_core_op_handle(INVALID_CORE_OP_HANDLE)
 {
@@ -186,6 +189,14 @@ hailo_status VdmaInputStream::write_async_impl(TransferRequest &&transfer_reques
 {
     TRACE(FrameDequeueH2DTrace, m_device.get_dev_id(), m_core_op_handle, name());
 
+    if ((nullptr != m_transfer_coalescer) && (StreamBufferMode::NOT_OWNING == buffer_mode())) {
+        if (m_transfer_coalescer->can_coalesce(transfer_request)) {
+            return m_transfer_coalescer->launch_transfer(std::move(transfer_request));
+        }
+        // Launched on its own, after the frames queued by the coalescer
+        m_transfer_coalescer->flush();
+    }
+
     if (transfer_request.transfer_buffers[0].type() == TransferBufferType::DMABUF) {
         return m_channel->launch_transfer(std::move(transfer_request));
     } else {
@@ -214,6 +225,9 @@ hailo_status VdmaInputStream::deactivate_stream_impl()
 hailo_status VdmaInputStream::cancel_pending_transfers()
 {
     m_channel->cancel_pending_transfers();
+    if (nullptr != m_transfer_coalescer) {
+        m_transfer_coalescer->cancel_pending_transfers();
+    }
 
     return HAILO_SUCCESS;
 }
@@ -225,9 +239,16 @@ Expected<std::shared_ptr<VdmaOutputStream>> VdmaOutputStream::create(hailo_strea
 {
     assert((interface == HAILO_STREAM_INTERFACE_PCIE) || (interface == HAILO_STREAM_INTERFACE_INTEGRATED));
 
+    std::unique_ptr<vdma::TransferCoalescer> transfer_coalescer;
+    if (!HailoRTCommon::is_nms(edge_layer.format.order)) {
+        // NMS streams are read in bursts (see NmsOutputStream)
+        TRY(transfer_coalescer, vdma::TransferCoalescer::create(device, channel,
+            LayerInfoUtils::get_layer_transfer_size(edge_layer), HAILO_DMA_BUFFER_DIRECTION_D2H));
+    }
+
     hailo_status status = HAILO_UNINITIALIZED;
     auto result = make_shared_nothrow<VdmaOutputStream>(device, channel, edge_layer,
-        core_op_activated_event, interface, status);
+        core_op_activated_event, interface, std::move(transfer_coalescer), status);
     CHECK_NOT_NULL_AS_EXPECTED(result, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -237,10 +258,12 @@ Expected<std::shared_ptr<VdmaOutputStream>> VdmaOutputStream::create(hailo_strea
 VdmaOutputStream::VdmaOutputStream(VdmaDevice &device, vdma::BoundaryChannelPtr channel, const LayerInfo &edge_layer,
                                    EventPtr core_op_activated_event,
                                    hailo_stream_interface_t interface,
+                                   std::unique_ptr<vdma::TransferCoalescer> &&transfer_coalescer,
                                    hailo_status &status) :
     AsyncOutputStreamBase(edge_layer, std::move(core_op_activated_event), status),
     m_device(device),
     m_channel(std::move(channel)),
+    m_transfer_coalescer(std::move(transfer_coalescer)),
     m_interface(interface),
     m_transfer_size(get_transfer_size(m_stream_info, get_layer_info())),
     m_core_op_handle(INVALID_CORE_OP_HANDLE),
@@ -321,6 +344,15 @@ hailo_status VdmaOutputStream::read_async_impl(TransferRequest &&transfer_reques
             original_callback(status);
         };
     }
+
+    if ((nullptr != m_transfer_coalescer) && (StreamBufferMode::NOT_OWNING == buffer_mode())) {
+        if (m_transfer_coalescer->can_coalesce(transfer_request)) {
+            return m_transfer_coalescer->launch_transfer(std::move(transfer_request));
+        }
+        // Launched on its own, after the frames queued by the coalescer
+        m_transfer_coalescer->flush();
+    }
+
     if (transfer_request.transfer_buffers[0].type() == TransferBufferType::DMABUF) {
         return m_channel->launch_transfer(std::move(transfer_request));
     } else {
@@ -378,6 +410,9 @@ uint32_t VdmaOutputStream::get_transfer_size(const hailo_stream_info_t &stream_i
 hailo_status VdmaOutputStream::cancel_pending_transfers()
 {
     m_channel->cancel_pending_transfers();
+    if (nullptr != m_transfer_coalescer) {
+        m_transfer_coalescer->cancel_pending_transfers();
+    }
 
     return HAILO_SUCCESS;
 }
@@ -15,6 +15,7 @@
 #include "stream_common/async_stream_base.hpp"
 #include "vdma/vdma_device.hpp"
 #include "vdma/channel/boundary_channel.hpp"
+#include "vdma/transfer_coalescer.hpp"
 
 
 namespace hailort
@@ -38,7 +39,8 @@ public:
 
     VdmaInputStream(VdmaDevice &device, vdma::BoundaryChannelPtr channel, const LayerInfo &edge_layer,
                     EventPtr core_op_activated_event, hailo_stream_interface_t stream_interface,
-                    BounceBufferQueuePtr &&bounce_buffers_pool, hailo_status &status);
+                    BounceBufferQueuePtr &&bounce_buffers_pool,
+                    std::unique_ptr<vdma::TransferCoalescer> &&transfer_coalescer, hailo_status &status);
     virtual ~VdmaInputStream();
 
     virtual hailo_stream_interface_t get_interface() const override;
@@ -61,6 +63,8 @@ private:
     BounceBufferQueuePtr m_bounce_buffers_pool;
 
     vdma::BoundaryChannelPtr m_channel;
+    // nullptr if transfer coalescing is disabled
+    std::unique_ptr<vdma::TransferCoalescer> m_transfer_coalescer;
     const hailo_stream_interface_t m_interface;
     vdevice_core_op_handle_t m_core_op_handle;
 };
@@ -74,7 +78,7 @@ public:
 
     VdmaOutputStream(VdmaDevice &device, vdma::BoundaryChannelPtr channel, const LayerInfo &edge_layer,
                      EventPtr core_op_activated_event, hailo_stream_interface_t interface,
-                     hailo_status &status);
+                     std::unique_ptr<vdma::TransferCoalescer> &&transfer_coalescer, hailo_status &status);
     virtual ~VdmaOutputStream();
 
     virtual hailo_stream_interface_t get_interface() const override;
@@ -101,6 +105,8 @@ private:
 
     VdmaDevice &m_device;
     vdma::BoundaryChannelPtr m_channel;
+    // nullptr if transfer coalescing is disabled
+    std::unique_ptr<vdma::TransferCoalescer> m_transfer_coalescer;
     const hailo_stream_interface_t m_interface;
     const uint32_t m_transfer_size;
     vdevice_core_op_handle_t m_core_op_handle;